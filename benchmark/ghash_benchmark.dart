@@ -0,0 +1,135 @@
+// dart format width=5000
+// Benchmark de GHASH: tabelas de 4 bits em int de 64 bits (utils/ghash.dart)
+// vs a versão BigInt anterior vs PCLMULQDQ, e AES-GCM Dart completo
+//
+// Mede MB/s; a versão BigInt é reproduzida aqui só como referência.
+
+import 'dart:typed_data';
+
+import 'package:tlslite/src/experimental/aesgcm_asm_x86_64.dart';
+import 'package:tlslite/src/utils/aesgcm.dart';
+import 'package:tlslite/src/utils/dart_aesgcm.dart';
+import 'package:tlslite/src/utils/ghash.dart';
+import 'package:tlslite/src/utils/rijndael_fast.dart';
+
+/// Mede o throughput de [op] sobre [bytes] por chamada
+double _megabytesPerSecond(int bytes, void Function() op, {int minMillis = 1000}) {
+  for (int i = 0; i < 20; i++) {
+    op();
+  }
+  var iterations = 0;
+  final sw = Stopwatch()..start();
+  while (sw.elapsedMilliseconds < minMillis) {
+    op();
+    iterations++;
+  }
+  sw.stop();
+  return iterations * bytes / sw.elapsedMicroseconds;
+}
+
+/// GHASH com BigInt e tabela de 4 bits, como o AESGCM fazia antes
+class _BigIntGhash {
+  _BigIntGhash(Uint8List h) {
+    final hv = _toBigInt(h);
+    _table[_reverse(1)] = hv;
+    for (var i = 2; i < 16; i += 2) {
+      _table[_reverse(i)] = _shift(_table[_reverse(i ~/ 2)]);
+      _table[_reverse(i + 1)] = _table[_reverse(i)] ^ hv;
+    }
+  }
+
+  static const _reduction = [0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0, 0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0];
+  final List<BigInt> _table = List<BigInt>.filled(16, BigInt.zero);
+
+  static BigInt _toBigInt(Uint8List bytes) {
+    var result = BigInt.zero;
+    for (final b in bytes) {
+      result = (result << 8) | BigInt.from(b);
+    }
+    return result;
+  }
+
+  static int _reverse(int v) {
+    var i = v & 0xf;
+    i = ((i << 2) & 0xc) | ((i >> 2) & 0x3);
+    return ((i << 1) & 0xa) | ((i >> 1) & 0x5);
+  }
+
+  static BigInt _shift(BigInt x) {
+    final carry = (x & BigInt.one) == BigInt.one;
+    var result = x >> 1;
+    if (carry) {
+      result ^= BigInt.from(0xe1) << 120;
+    }
+    return result;
+  }
+
+  BigInt _mul(BigInt y) {
+    var ret = BigInt.zero;
+    var val = y;
+    for (var i = 0; i < 128; i += 4) {
+      final high = (ret & BigInt.from(0xf)).toInt();
+      ret >>= 4;
+      ret ^= BigInt.from(_reduction[high]) << 112;
+      ret ^= _table[(val & BigInt.from(0xf)).toInt()];
+      val >>= 4;
+    }
+    return ret;
+  }
+
+  BigInt hash(Uint8List data) {
+    var y = BigInt.zero;
+    for (var i = 0; i < data.length; i += 16) {
+      y = _mul(y ^ _toBigInt(data.sublist(i, i + 16)));
+    }
+    return _mul(y ^ BigInt.from(data.length * 8));
+  }
+}
+
+void main() {
+  print('=== GHASH Benchmark ===\n');
+  final pclmul = PclmulqdqSupport.isSupported;
+  print('PCLMULQDQ: ${pclmul ? 'Suportado' : 'não suportado'}\n');
+
+  final h = Uint8List.fromList(List.generate(16, (i) => i * 13 + 0x66));
+  final ghash = Ghash(h);
+  final bigInt = _BigIntGhash(h);
+  final asm = pclmul ? GhashAsm(h) : null;
+
+  print('${'Tamanho'.padRight(10)} | ${'BigInt'.padRight(12)} | ${'int64 4-bit'.padRight(12)} | ${'PCLMULQDQ'.padRight(12)} (MB/s)');
+  print('─' * 60);
+  for (final size in [64, 1024, 16384]) {
+    final data = Uint8List.fromList(List.generate(size, (i) => i & 0xff));
+    final bigIntRate = _megabytesPerSecond(size, () => bigInt.hash(data), minMillis: 500);
+    final tableRate = _megabytesPerSecond(size, () {
+      ghash.reset();
+      ghash.update(data);
+      ghash.finalize(0, size);
+    });
+    var asmRate = 'N/A';
+    if (asm != null) {
+      asmRate = _megabytesPerSecond(size, () {
+        asm.reset();
+        asm.update(data);
+        asm.finalize(0, size);
+      }).toStringAsFixed(1);
+    }
+    print('${'${size}B'.padRight(10)} | ${bigIntRate.toStringAsFixed(1).padRight(12)} | ${tableRate.toStringAsFixed(1).padRight(12)} | $asmRate');
+  }
+  asm?.dispose();
+
+  print('\n=== AES-GCM Dart (GHASH int64) ===\n');
+  final key = Uint8List.fromList(List.generate(16, (i) => i));
+  final nonce = Uint8List(12);
+  final aad = Uint8List(13);
+  final aes = RijndaelFast(key);
+  final gcm = AESGCM(key, 'dart', aes.encrypt);
+  final record = Uint8List(16384);
+  final out = Uint8List(record.length + 16);
+  final sealRate = _megabytesPerSecond(record.length, () => gcm.sealInto(nonce, record, aad, out, 0));
+  print('seal 16 KiB (RijndaelFast por bloco): ${sealRate.toStringAsFixed(1)} MB/s');
+  final engineGcm = newAESGCM(key);
+  final engineRate = _megabytesPerSecond(record.length, () => engineGcm.sealInto(nonce, record, aad, out, 0));
+  print('seal 16 KiB (AesEngine):              ${engineRate.toStringAsFixed(1)} MB/s');
+  aes.dispose();
+}
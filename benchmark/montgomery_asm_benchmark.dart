@@ -23,8 +23,14 @@ void main() {
   _benchmarkSize('RSA-512', 512);
   _benchmarkSize('RSA-1024', 1024);
   _benchmarkSize('RSA-2048', 2048);
+  _benchmarkSize('RSA-3072', 3072);
   _benchmarkSize('RSA-4096', 4096);
 
+  // Expoente do tamanho do módulo (operação privada sem CRT, FFDHE)
+  _benchmarkFullExponent('RSA-2048 / FFDHE-2048', 2048);
+  _benchmarkFullExponent('RSA-3072 / FFDHE-3072', 3072);
+  _benchmarkFullExponent('RSA-4096 / FFDHE-4096', 4096);
+
   print('');
   print('='.padRight(70, '='));
 }
@@ -71,7 +77,7 @@ void _benchmarkSize(String name, int bits) {
       ctx.dispose();
       return;
     }
-    print('✓ Montgomery ASM Context: OK ${bits == 256 ? "(usando shellcode 4-limbs)" : "(usando shellcode genérico)"}');
+    print('✓ Montgomery ASM Context: OK ${bits == 256 ? "(usando shellcode 4-limbs)" : ctx.usesMulxKernel ? "(usando kernel MULX)" : "(usando shellcode genérico)"}');
   } catch (e, st) {
     print('ERRO Montgomery ASM: excecao!');
     print('  $e');
@@ -143,6 +149,64 @@ void _benchmarkSize(String name, int bits) {
   }
 }
 
+/// Kernel MULX contra BigInt.modPow com expoente de [bits] bits
+void _benchmarkFullExponent(String name, int bits) {
+  print('');
+  print('-'.padRight(70, '-'));
+  print('$name ($bits bits, expoente de $bits bits)');
+  print('-'.padRight(70, '-'));
+
+  final modBytes = _generateOddNumber(bits ~/ 8);
+  final baseBytes = _generateRandomBytes((bits ~/ 8) - 1);
+  final expBytes = _generateRandomBytes(bits ~/ 8)..[0] |= 0x80;
+  final modBigInt = _bytesToBigInt(modBytes);
+  final baseBigInt = _bytesToBigInt(baseBytes);
+  final expBigInt = _bytesToBigInt(expBytes);
+  final expected = baseBigInt.modPow(expBigInt, modBigInt);
+
+  final ctx = MontgomeryAsmContext.fromModulus(modBytes);
+  try {
+    if (!ctx.usesMulxKernel) {
+      print('Kernel MULX indisponível (requer BMI2 + ADX); pulando');
+      return;
+    }
+    if (_bytesToBigInt(ctx.modPow(baseBytes, expBytes)) != expected) {
+      print('ERRO Montgomery MULX: resultado incorreto!');
+      return;
+    }
+    print('✓ Montgomery MULX: OK');
+
+    final iterations = bits <= 2048 ? 50 : 10;
+    for (int i = 0; i < 2; i++) {
+      baseBigInt.modPow(expBigInt, modBigInt);
+      ctx.modPow(baseBytes, expBytes);
+    }
+
+    final bigIntStopwatch = Stopwatch()..start();
+    for (int i = 0; i < iterations; i++) {
+      baseBigInt.modPow(expBigInt, modBigInt);
+    }
+    bigIntStopwatch.stop();
+    final bigIntTimeUs = bigIntStopwatch.elapsedMicroseconds / iterations;
+
+    final mulxStopwatch = Stopwatch()..start();
+    for (int i = 0; i < iterations; i++) {
+      ctx.modPow(baseBytes, expBytes);
+    }
+    mulxStopwatch.stop();
+    final mulxTimeUs = mulxStopwatch.elapsedMicroseconds / iterations;
+
+    print('');
+    print('Resultados ($iterations iterações):');
+    print('');
+    print('  BigInt.modPow:        ${(bigIntTimeUs / 1000).toStringAsFixed(2)} ms/op');
+    print('  Montgomery MULX:      ${(mulxTimeUs / 1000).toStringAsFixed(2)} ms/op');
+    print('  MULX vs BigInt:       ${(bigIntTimeUs / mulxTimeUs).toStringAsFixed(2)}x');
+  } finally {
+    ctx.dispose();
+  }
+}
+
 Uint8List _generateOddNumber(int byteLength) {
   final bytes = Uint8List(byteLength);
   for (int i = 0; i < byteLength; i++) {
@@ -0,0 +1,62 @@
+// dart format width=5000
+// Benchmark P-256/P-384: motor dedicado (NistCurve, limbs de 30 bits em
+// Jacobiano) vs curvas BigInt genéricas do pointycastle, para geração de
+// chave (k·G), ECDH (k·Q), assinatura e verificação ECDSA
+
+import 'dart:typed_data';
+
+import 'package:pointycastle/api.dart' as pc show PrivateKeyParameter, PublicKeyParameter;
+import 'package:pointycastle/digests/sha256.dart';
+import 'package:pointycastle/ecc/api.dart' as ecc;
+import 'package:pointycastle/macs/hmac.dart';
+import 'package:pointycastle/signers/ecdsa_signer.dart';
+import 'package:tlslite/src/utils/cryptomath.dart';
+import 'package:tlslite/src/utils/ecc.dart';
+import 'package:tlslite/src/utils/nist_curves.dart';
+
+double _opsPerSecond(void Function() op, {int minMillis = 2000}) {
+  for (int i = 0; i < 10; i++) {
+    op();
+  }
+  var iterations = 0;
+  final sw = Stopwatch()..start();
+  while (sw.elapsedMilliseconds < minMillis) {
+    op();
+    iterations++;
+  }
+  sw.stop();
+  return iterations / (sw.elapsedMicroseconds / 1000000);
+}
+
+void _report(String label, double pointyCastle, double nist) {
+  print('${label.padRight(10)} | ${pointyCastle.toStringAsFixed(0).padLeft(12)} | ${nist.toStringAsFixed(0).padLeft(12)} | ${(nist / pointyCastle).toStringAsFixed(2)}x');
+}
+
+void main() {
+  for (final curve in [NistCurve.p256, NistCurve.p384]) {
+    final domain = getCurveByName(curve.name);
+    final d = bytesToNumber(getRandomBytes(curve.scalarLength)) % curve.n;
+    final k = bytesToNumber(getRandomBytes(curve.scalarLength)) % curve.n;
+    final q = (domain.G * d)!;
+    final qx = q.x!.toBigInteger()!;
+    final qy = q.y!.toBigInteger()!;
+    final hash = secureHash(Uint8List.fromList([1, 2, 3]), 'sha256');
+
+    print('\n=== ${curve.name} (ops/s) ===');
+    print('${'Operação'.padRight(10)} | ${'pointycastle'.padLeft(12)} | ${'NistCurve'.padLeft(12)} | Speedup');
+    print('─' * 56);
+
+    // Na primeira chamada a tabela fixa de G é construída; fica fora da medição
+    curve.mulBase(k);
+    _report('k·G', _opsPerSecond(() => domain.G * k), _opsPerSecond(() => curve.mulBase(k)));
+    _report('ECDH', _opsPerSecond(() => q * k), _opsPerSecond(() => curve.sharedSecret(k, qx, qy)));
+
+    final signer = ECDSASigner(null, HMac(SHA256Digest(), 64))..init(true, pc.PrivateKeyParameter(ecc.ECPrivateKey(d, domain)));
+    _report('sign', _opsPerSecond(() => signer.generateSignature(hash)), _opsPerSecond(() => curve.sign(d, hash, 'sha256')));
+
+    final (r, s) = curve.sign(d, hash, 'sha256');
+    final verifier = ECDSASigner()..init(false, pc.PublicKeyParameter(ecc.ECPublicKey(q, domain)));
+    final signature = ecc.ECSignature(r, s);
+    _report('verify', _opsPerSecond(() => verifier.verifySignature(hash, signature)), _opsPerSecond(() => curve.verify(qx, qy, hash, r, s)));
+  }
+}
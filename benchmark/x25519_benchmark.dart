@@ -0,0 +1,60 @@
+// dart format width=5000
+// Benchmark X25519: escada em Dart (limbs 2^25.5) vs kernel MULX/ADX, e
+// handshakes por segundo via ECDHKeyExchange (calcPublicValue +
+// calcSharedKey, o custo de X25519 de um handshake TLS 1.3 do servidor)
+
+import 'dart:typed_data';
+
+import 'package:tlslite/src/constants.dart';
+import 'package:tlslite/src/experimental/x25519_mulx_x86_64.dart';
+import 'package:tlslite/src/keyexchange.dart';
+import 'package:tlslite/src/utils/x25519.dart';
+
+double _opsPerSecond(void Function() op, {int minMillis = 2000}) {
+  for (int i = 0; i < 50; i++) {
+    op();
+  }
+  var iterations = 0;
+  final sw = Stopwatch()..start();
+  while (sw.elapsedMilliseconds < minMillis) {
+    op();
+    iterations++;
+  }
+  sw.stop();
+  return iterations / (sw.elapsedMicroseconds / 1000000);
+}
+
+void main() {
+  print('=== X25519 Benchmark ===\n');
+  print('MULX/ADX: ${X25519Mulx.isSupported ? 'Suportado' : 'não suportado'}\n');
+
+  final k = Uint8List.fromList(List.generate(32, (i) => i * 7 + 1));
+  var u = Uint8List.fromList(X25519_G);
+
+  final dartRate = _opsPerSecond(() {
+    u = x25519(k, u);
+  });
+  print('x25519 (Dart, limbs 2^25.5): ${dartRate.toStringAsFixed(0)} ops/s '
+      '(${(1000000 / dartRate).toStringAsFixed(1)} µs/op)');
+
+  if (X25519Mulx.isSupported) {
+    u = Uint8List.fromList(X25519_G);
+    final asmRate = _opsPerSecond(() {
+      u = X25519Mulx.scalarMult(k, u);
+    });
+    print('x25519 (MULX/ADX):           ${asmRate.toStringAsFixed(0)} ops/s '
+        '(${(1000000 / asmRate).toStringAsFixed(1)} µs/op)');
+    print('Speedup: ${(asmRate / dartRate).toStringAsFixed(2)}x');
+  }
+
+  print('\n=== Handshakes (ECDHKeyExchange, x25519) ===');
+  final client = ECDHKeyExchange(GroupName.x25519, (3, 4));
+  final clientShare = client.calcPublicValue(client.getRandomPrivateKey());
+  final server = ECDHKeyExchange(GroupName.x25519, (3, 4));
+  final handshakes = _opsPerSecond(() {
+    final private = server.getRandomPrivateKey();
+    server.calcPublicValue(private);
+    server.calcSharedKey(private, clientShare);
+  });
+  print('${handshakes.toStringAsFixed(0)} handshakes/s');
+}
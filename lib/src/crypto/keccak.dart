@@ -0,0 +1,400 @@
+/// Keccak-f[1600] and the FIPS 202 sponges (SHA3-256, SHA3-512,
+/// SHAKE128, SHAKE256) shared by ML-KEM, Ed448 and the SHA-3 helpers.
+///
+/// The state is 25 little-endian 64-bit lanes in a [Uint64List]; the
+/// permutation keeps them in locals for all 24 rounds. Relies on 64-bit
+/// integers, like the SHA-512 code in streaming_digest.dart.
+library;
+
+import 'dart:typed_data';
+
+import '../experimental/keccak_x4_avx2_x86_64.dart' show KeccakX4Avx2;
+import '../utils/cipher_backends.dart' show CpuFeatures;
+
+final Uint64List _roundConstants = Uint64List.fromList(const [
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a,
+    0x8000000080008000, 0x000000000000808b, 0x0000000080000001,
+    0x8000000080008081, 0x8000000000008009, 0x000000000000008a,
+    0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+    0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+    0x8000000000008003, 0x8000000000008002, 0x8000000000000080,
+    0x000000000000800a, 0x800000008000000a, 0x8000000080008081,
+    0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+]);
+
+/// Applies Keccak-f[1600] to the 25 lanes at [offset] in [lanes].
+void keccakF1600(Uint64List lanes, [int offset = 0]) {
+  var a00 = lanes[offset];
+  var a01 = lanes[offset + 1];
+  var a02 = lanes[offset + 2];
+  var a03 = lanes[offset + 3];
+  var a04 = lanes[offset + 4];
+  var a05 = lanes[offset + 5];
+  var a06 = lanes[offset + 6];
+  var a07 = lanes[offset + 7];
+  var a08 = lanes[offset + 8];
+  var a09 = lanes[offset + 9];
+  var a10 = lanes[offset + 10];
+  var a11 = lanes[offset + 11];
+  var a12 = lanes[offset + 12];
+  var a13 = lanes[offset + 13];
+  var a14 = lanes[offset + 14];
+  var a15 = lanes[offset + 15];
+  var a16 = lanes[offset + 16];
+  var a17 = lanes[offset + 17];
+  var a18 = lanes[offset + 18];
+  var a19 = lanes[offset + 19];
+  var a20 = lanes[offset + 20];
+  var a21 = lanes[offset + 21];
+  var a22 = lanes[offset + 22];
+  var a23 = lanes[offset + 23];
+  var a24 = lanes[offset + 24];
+
+  for (var round = 0; round < 24; round++) {
+    final c0 = a00 ^ a05 ^ a10 ^ a15 ^ a20;
+    final c1 = a01 ^ a06 ^ a11 ^ a16 ^ a21;
+    final c2 = a02 ^ a07 ^ a12 ^ a17 ^ a22;
+    final c3 = a03 ^ a08 ^ a13 ^ a18 ^ a23;
+    final c4 = a04 ^ a09 ^ a14 ^ a19 ^ a24;
+    final d0 = c4 ^ ((c1 << 1) | (c1 >>> 63));
+    final d1 = c0 ^ ((c2 << 1) | (c2 >>> 63));
+    final d2 = c1 ^ ((c3 << 1) | (c3 >>> 63));
+    final d3 = c2 ^ ((c4 << 1) | (c4 >>> 63));
+    final d4 = c3 ^ ((c0 << 1) | (c0 >>> 63));
+    final b00 = (a00 ^ d0);
+    final b16t = (a05 ^ d0);
+    final b16 = (b16t << 36) | (b16t >>> 28);
+    final b07t = (a10 ^ d0);
+    final b07 = (b07t << 3) | (b07t >>> 61);
+    final b23t = (a15 ^ d0);
+    final b23 = (b23t << 41) | (b23t >>> 23);
+    final b14t = (a20 ^ d0);
+    final b14 = (b14t << 18) | (b14t >>> 46);
+    final b10t = (a01 ^ d1);
+    final b10 = (b10t << 1) | (b10t >>> 63);
+    final b01t = (a06 ^ d1);
+    final b01 = (b01t << 44) | (b01t >>> 20);
+    final b17t = (a11 ^ d1);
+    final b17 = (b17t << 10) | (b17t >>> 54);
+    final b08t = (a16 ^ d1);
+    final b08 = (b08t << 45) | (b08t >>> 19);
+    final b24t = (a21 ^ d1);
+    final b24 = (b24t << 2) | (b24t >>> 62);
+    final b20t = (a02 ^ d2);
+    final b20 = (b20t << 62) | (b20t >>> 2);
+    final b11t = (a07 ^ d2);
+    final b11 = (b11t << 6) | (b11t >>> 58);
+    final b02t = (a12 ^ d2);
+    final b02 = (b02t << 43) | (b02t >>> 21);
+    final b18t = (a17 ^ d2);
+    final b18 = (b18t << 15) | (b18t >>> 49);
+    final b09t = (a22 ^ d2);
+    final b09 = (b09t << 61) | (b09t >>> 3);
+    final b05t = (a03 ^ d3);
+    final b05 = (b05t << 28) | (b05t >>> 36);
+    final b21t = (a08 ^ d3);
+    final b21 = (b21t << 55) | (b21t >>> 9);
+    final b12t = (a13 ^ d3);
+    final b12 = (b12t << 25) | (b12t >>> 39);
+    final b03t = (a18 ^ d3);
+    final b03 = (b03t << 21) | (b03t >>> 43);
+    final b19t = (a23 ^ d3);
+    final b19 = (b19t << 56) | (b19t >>> 8);
+    final b15t = (a04 ^ d4);
+    final b15 = (b15t << 27) | (b15t >>> 37);
+    final b06t = (a09 ^ d4);
+    final b06 = (b06t << 20) | (b06t >>> 44);
+    final b22t = (a14 ^ d4);
+    final b22 = (b22t << 39) | (b22t >>> 25);
+    final b13t = (a19 ^ d4);
+    final b13 = (b13t << 8) | (b13t >>> 56);
+    final b04t = (a24 ^ d4);
+    final b04 = (b04t << 14) | (b04t >>> 50);
+    a00 = b00 ^ (~b01 & b02);
+    a01 = b01 ^ (~b02 & b03);
+    a02 = b02 ^ (~b03 & b04);
+    a03 = b03 ^ (~b04 & b00);
+    a04 = b04 ^ (~b00 & b01);
+    a05 = b05 ^ (~b06 & b07);
+    a06 = b06 ^ (~b07 & b08);
+    a07 = b07 ^ (~b08 & b09);
+    a08 = b08 ^ (~b09 & b05);
+    a09 = b09 ^ (~b05 & b06);
+    a10 = b10 ^ (~b11 & b12);
+    a11 = b11 ^ (~b12 & b13);
+    a12 = b12 ^ (~b13 & b14);
+    a13 = b13 ^ (~b14 & b10);
+    a14 = b14 ^ (~b10 & b11);
+    a15 = b15 ^ (~b16 & b17);
+    a16 = b16 ^ (~b17 & b18);
+    a17 = b17 ^ (~b18 & b19);
+    a18 = b18 ^ (~b19 & b15);
+    a19 = b19 ^ (~b15 & b16);
+    a20 = b20 ^ (~b21 & b22);
+    a21 = b21 ^ (~b22 & b23);
+    a22 = b22 ^ (~b23 & b24);
+    a23 = b23 ^ (~b24 & b20);
+    a24 = b24 ^ (~b20 & b21);
+    a00 ^= _roundConstants[round];
+  }
+
+  lanes[offset] = a00;
+  lanes[offset + 1] = a01;
+  lanes[offset + 2] = a02;
+  lanes[offset + 3] = a03;
+  lanes[offset + 4] = a04;
+  lanes[offset + 5] = a05;
+  lanes[offset + 6] = a06;
+  lanes[offset + 7] = a07;
+  lanes[offset + 8] = a08;
+  lanes[offset + 9] = a09;
+  lanes[offset + 10] = a10;
+  lanes[offset + 11] = a11;
+  lanes[offset + 12] = a12;
+  lanes[offset + 13] = a13;
+  lanes[offset + 14] = a14;
+  lanes[offset + 15] = a15;
+  lanes[offset + 16] = a16;
+  lanes[offset + 17] = a17;
+  lanes[offset + 18] = a18;
+  lanes[offset + 19] = a19;
+  lanes[offset + 20] = a20;
+  lanes[offset + 21] = a21;
+  lanes[offset + 22] = a22;
+  lanes[offset + 23] = a23;
+  lanes[offset + 24] = a24;
+}
+
+/// XORs `data[start:end]` into the sponge at byte position [pos] of the
+/// state at [base], permuting whenever a block is full. Returns the new
+/// position.
+int _absorbInto(Uint64List lanes, int base, int rate, int pos, List<int> data,
+    int start, int end) {
+  var i = start;
+  while (i < end) {
+    if ((pos & 7) == 0 && end - i >= 8) {
+      lanes[base + (pos >> 3)] ^= data[i] |
+          (data[i + 1] << 8) |
+          (data[i + 2] << 16) |
+          (data[i + 3] << 24) |
+          (data[i + 4] << 32) |
+          (data[i + 5] << 40) |
+          (data[i + 6] << 48) |
+          (data[i + 7] << 56);
+      i += 8;
+      pos += 8;
+    } else {
+      lanes[base + (pos >> 3)] ^= data[i] << ((pos & 7) << 3);
+      i++;
+      pos++;
+    }
+    if (pos == rate) {
+      keccakF1600(lanes, base);
+      pos = 0;
+    }
+  }
+  return pos;
+}
+
+/// Applies the FIPS 202 padding (domain bits, then pad10*1) at [pos].
+void _pad(Uint64List lanes, int base, int rate, int pos, int domain) {
+  lanes[base + (pos >> 3)] ^= domain << ((pos & 7) << 3);
+  lanes[base + ((rate - 1) >> 3)] ^= 0x80 << (((rate - 1) & 7) << 3);
+}
+
+/// Copies the output stream into `out[start:end]` from byte position [pos],
+/// permuting before each new block. Returns the new position.
+int _squeezeFrom(Uint64List lanes, int base, int rate, int pos, Uint8List out,
+    int start, int end) {
+  var o = start;
+  while (o < end) {
+    if (pos == rate) {
+      keccakF1600(lanes, base);
+      pos = 0;
+    }
+    final lane = lanes[base + (pos >> 3)];
+    if ((pos & 7) == 0 && end - o >= 8) {
+      // Uint8List keeps the low byte of each value.
+      out[o] = lane;
+      out[o + 1] = lane >>> 8;
+      out[o + 2] = lane >>> 16;
+      out[o + 3] = lane >>> 24;
+      out[o + 4] = lane >>> 32;
+      out[o + 5] = lane >>> 40;
+      out[o + 6] = lane >>> 48;
+      out[o + 7] = lane >>> 56;
+      o += 8;
+      pos += 8;
+    } else {
+      out[o++] = lane >>> ((pos & 7) << 3);
+      pos++;
+    }
+  }
+  return pos;
+}
+
+/// A FIPS 202 sponge with incremental [absorb] and [squeeze].
+///
+/// Absorbing is only allowed before the first squeeze; [reset] starts a
+/// new message.
+class KeccakSponge {
+  KeccakSponge(this.rate, this.domain)
+      : assert(rate > 0 && rate < 200 && rate % 8 == 0);
+
+  KeccakSponge.shake128() : this(168, 0x1f);
+  KeccakSponge.shake256() : this(136, 0x1f);
+  KeccakSponge.sha3_256() : this(136, 0x06);
+  KeccakSponge.sha3_512() : this(72, 0x06);
+
+  /// Block size in bytes.
+  final int rate;
+
+  /// Domain separation suffix with the first padding bit (0x1f for SHAKE,
+  /// 0x06 for SHA-3).
+  final int domain;
+
+  final Uint64List _lanes = Uint64List(25);
+  int _pos = 0;
+  bool _squeezing = false;
+
+  /// Forgets everything absorbed or squeezed so far.
+  void reset() {
+    _lanes.fillRange(0, 25, 0);
+    _pos = 0;
+    _squeezing = false;
+  }
+
+  /// Absorbs `data[start:end]`.
+  void absorb(List<int> data, [int start = 0, int? end]) {
+    if (_squeezing) {
+      throw StateError('Cannot absorb after squeezing');
+    }
+    _pos = _absorbInto(_lanes, 0, rate, _pos, data, start, end ?? data.length);
+  }
+
+  /// Writes the next [length] output bytes (the rest of [out] by default)
+  /// into [out] at [offset]. The first call finishes absorbing.
+  void squeeze(Uint8List out, [int offset = 0, int? length]) {
+    if (!_squeezing) {
+      _pad(_lanes, 0, rate, _pos, domain);
+      keccakF1600(_lanes);
+      _pos = 0;
+      _squeezing = true;
+    }
+    _pos = _squeezeFrom(_lanes, 0, rate, _pos, out, offset,
+        offset + (length ?? out.length - offset));
+  }
+
+  /// Returns the next [length] output bytes.
+  Uint8List read(int length) {
+    final out = Uint8List(length);
+    squeeze(out);
+    return out;
+  }
+}
+
+/// Up to four sponges of the same kind driven in lockstep, for callers
+/// that need several independent XOF streams at once (the ML-KEM matrix).
+///
+/// The states sit back to back in one lane array. With AVX2
+/// ([CpuFeatures.avx2]) two or more streams are permuted together by the
+/// native four-lane kernel in `asm/keccak_x4_avx2_x86_64.S`; otherwise each
+/// state goes through [keccakF1600] in turn.
+class KeccakX4 {
+  KeccakX4(this.rate, this.domain)
+      : assert(rate > 0 && rate < 200 && rate % 8 == 0);
+
+  KeccakX4.shake128() : this(168, 0x1f);
+  KeccakX4.shake256() : this(136, 0x1f);
+
+  /// Block size in bytes.
+  final int rate;
+
+  /// Domain separation suffix with the first padding bit.
+  final int domain;
+
+  final Uint64List _lanes = Uint64List(100);
+  // Interleaved copy of [_lanes] for the native kernel: lane i of stream s
+  // at 4 * i + s.
+  Uint64List? _wide;
+  int _active = 0;
+  bool _permuteFirst = false;
+
+  /// Number of streams set up by the last [absorbAll].
+  int get active => _active;
+
+  /// Starts one stream per message of [inputs] (at most four): absorbs the
+  /// whole message and pads it.
+  void absorbAll(List<List<int>> inputs) {
+    if (inputs.isEmpty || inputs.length > 4) {
+      throw ArgumentError.value(inputs.length, 'inputs', 'must be 1 to 4');
+    }
+    _lanes.fillRange(0, 100, 0);
+    _active = inputs.length;
+    for (var s = 0; s < _active; s++) {
+      final input = inputs[s];
+      final pos = _absorbInto(_lanes, 25 * s, rate, 0, input, 0, input.length);
+      _pad(_lanes, 25 * s, rate, pos, domain);
+    }
+    _permuteFirst = true;
+  }
+
+  /// Writes the next [blocks] whole blocks of stream `s` into `outs[s]` at
+  /// [offset], for every active stream.
+  void squeezeBlocks(List<Uint8List> outs, int blocks, [int offset = 0]) {
+    if (outs.length < _active) {
+      throw ArgumentError('Need one output per stream');
+    }
+    for (var b = 0; b < blocks; b++) {
+      if (_permuteFirst) {
+        _permuteAll();
+      }
+      final start = offset + b * rate;
+      for (var s = 0; s < _active; s++) {
+        // Position 0 of a freshly permuted state; never reaches `rate`.
+        _squeezeFrom(_lanes, 25 * s, rate, 0, outs[s], start, start + rate);
+      }
+      _permuteFirst = true;
+    }
+  }
+
+  void _permuteAll() {
+    if (_active == 1 || !CpuFeatures.current.avx2) {
+      for (var s = 0; s < _active; s++) {
+        keccakF1600(_lanes, 25 * s);
+      }
+      return;
+    }
+    final wide = _wide ??= Uint64List(100);
+    final lanes = _lanes;
+    for (var i = 0; i < 25; i++) {
+      wide[4 * i] = lanes[i];
+      wide[4 * i + 1] = lanes[25 + i];
+      wide[4 * i + 2] = lanes[50 + i];
+      wide[4 * i + 3] = lanes[75 + i];
+    }
+    KeccakX4Avx2.permute(wide);
+    for (var i = 0; i < 25; i++) {
+      lanes[i] = wide[4 * i];
+      lanes[25 + i] = wide[4 * i + 1];
+      lanes[50 + i] = wide[4 * i + 2];
+      lanes[75 + i] = wide[4 * i + 3];
+    }
+  }
+}
+
+/// SHAKE128 of [input], [length] bytes.
+Uint8List shake128(List<int> input, int length) =>
+    (KeccakSponge.shake128()..absorb(input)).read(length);
+
+/// SHAKE256 of [input], [length] bytes.
+Uint8List shake256(List<int> input, int length) =>
+    (KeccakSponge.shake256()..absorb(input)).read(length);
+
+/// SHA3-256 of [input].
+Uint8List sha3_256(List<int> input) =>
+    (KeccakSponge.sha3_256()..absorb(input)).read(32);
+
+/// SHA3-512 of [input].
+Uint8List sha3_512(List<int> input) =>
+    (KeccakSponge.sha3_512()..absorb(input)).read(64);
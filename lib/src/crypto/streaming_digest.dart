@@ -0,0 +1,652 @@
+/// Streaming Merkle-Damgard digests with cloneable state.
+///
+/// `package:crypto` only exposes one-shot hashing or a chunked conversion
+/// sink whose state cannot be duplicated, so callers that need running
+/// transcript digests (handshake hashes, HMAC pads, PRF chains) ended up
+/// buffering every byte and re-hashing from scratch. The digests here keep
+/// the compression state and at most one partial block, so [StreamingDigest.copy]
+/// and [StreamingDigest.digest] cost O(block size) regardless of how much data
+/// was absorbed.
+///
+/// Supported algorithms: md5, sha1, sha224, sha256, sha384, sha512.
+library streaming_digest;
+
+import 'dart:typed_data';
+
+/// Incremental hash with a cloneable compression state.
+abstract class StreamingDigest {
+  StreamingDigest._(this.blockSize) : _block = Uint8List(blockSize);
+
+  /// Creates a fresh digest for [algorithm] (case-insensitive).
+  factory StreamingDigest(String algorithm) {
+    switch (algorithm.toLowerCase()) {
+      case 'md5':
+        return _Md5();
+      case 'sha1':
+        return _Sha1();
+      case 'sha224':
+        return _Sha256(true);
+      case 'sha256':
+        return _Sha256(false);
+      case 'sha384':
+        return _Sha512(true);
+      case 'sha512':
+        return _Sha512(false);
+      default:
+        throw ArgumentError('Unsupported hash algorithm: $algorithm');
+    }
+  }
+
+  /// Returns true when [algorithm] can be instantiated by this module.
+  static bool isSupported(String algorithm) {
+    switch (algorithm.toLowerCase()) {
+      case 'md5':
+      case 'sha1':
+      case 'sha224':
+      case 'sha256':
+      case 'sha384':
+      case 'sha512':
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /// Size of the compression function input, in bytes.
+  final int blockSize;
+
+  /// Pending bytes that do not yet form a full block.
+  final Uint8List _block;
+  int _blockLength = 0;
+  int _byteCount = 0;
+
+  /// Lowercase algorithm name.
+  String get algorithm;
+
+  /// Size of the digest output, in bytes.
+  int get digestSize;
+
+  /// Total number of bytes absorbed so far.
+  int get length => _byteCount;
+
+  /// Absorbs `data[start:end]` into the running state.
+  void update(List<int> data, [int start = 0, int? end]) {
+    final stop = RangeError.checkValidRange(start, end, data.length);
+    var offset = start;
+    _byteCount += stop - offset;
+
+    if (_blockLength > 0) {
+      var take = blockSize - _blockLength;
+      if (take > stop - offset) {
+        take = stop - offset;
+      }
+      _block.setRange(_blockLength, _blockLength + take, data, offset);
+      _blockLength += take;
+      offset += take;
+      if (_blockLength < blockSize) {
+        return;
+      }
+      _compress(_block, 0);
+      _blockLength = 0;
+    }
+
+    if (data is Uint8List) {
+      while (stop - offset >= blockSize) {
+        _compress(data, offset);
+        offset += blockSize;
+      }
+    } else {
+      while (stop - offset >= blockSize) {
+        _block.setRange(0, blockSize, data, offset);
+        _compress(_block, 0);
+        offset += blockSize;
+      }
+    }
+
+    if (offset < stop) {
+      _block.setRange(0, stop - offset, data, offset);
+      _blockLength = stop - offset;
+    }
+  }
+
+  /// Returns the digest of everything absorbed so far.
+  ///
+  /// The running state is left untouched, so more data may be added later.
+  Uint8List digest() => copy()._finish();
+
+  /// Finishes this digest in place and returns the result, skipping the
+  /// copy that [digest] makes.
+  ///
+  /// The state is consumed; reload it with [replaceWith] before absorbing
+  /// more data.
+  Uint8List finish() => _finish();
+
+  /// Returns an independent digest with identical state.
+  StreamingDigest copy() {
+    final other = _emptyClone();
+    other._copyStateFrom(this);
+    other._block.setRange(0, _blockLength, _block);
+    other._blockLength = _blockLength;
+    other._byteCount = _byteCount;
+    return other;
+  }
+
+  /// Overwrites this digest's state with the state of [other].
+  void replaceWith(StreamingDigest other) {
+    if (other.algorithm != algorithm) {
+      throw ArgumentError(
+          'Cannot replace $algorithm state with ${other.algorithm} state');
+    }
+    _copyStateFrom(other);
+    _block.setRange(0, other._blockLength, other._block);
+    _blockLength = other._blockLength;
+    _byteCount = other._byteCount;
+  }
+
+  StreamingDigest _emptyClone();
+
+  void _copyStateFrom(covariant StreamingDigest other);
+
+  void _compress(Uint8List data, int offset);
+
+  /// Writes the message length (in bits) at the end of [_block].
+  void _writeLength(int bitLength);
+
+  Uint8List _output();
+
+  Uint8List _finish() {
+    final lengthBytes = blockSize == 128 ? 16 : 8;
+    final bitLength = _byteCount * 8;
+    _block[_blockLength++] = 0x80;
+    if (_blockLength > blockSize - lengthBytes) {
+      _block.fillRange(_blockLength, blockSize, 0);
+      _compress(_block, 0);
+      _blockLength = 0;
+    }
+    _block.fillRange(_blockLength, blockSize, 0);
+    _writeLength(bitLength);
+    _compress(_block, 0);
+    _blockLength = 0;
+    return _output();
+  }
+
+  void _writeLengthBigEndian(int bitLength) {
+    for (var i = 0; i < 8; i++) {
+      _block[blockSize - 1 - i] = (bitLength >>> (8 * i)) & 0xff;
+    }
+  }
+}
+
+const int _mask32 = 0xffffffff;
+
+int _rotl32(int x, int n) => ((x << n) | (x >>> (32 - n))) & _mask32;
+
+int _rotr32(int x, int n) => ((x >>> n) | (x << (32 - n))) & _mask32;
+
+int _rotr64(int x, int n) => (x >>> n) | (x << (64 - n));
+
+int _readUint32BE(Uint8List d, int o) =>
+    (d[o] << 24) | (d[o + 1] << 16) | (d[o + 2] << 8) | d[o + 3];
+
+int _readUint32LE(Uint8List d, int o) =>
+    d[o] | (d[o + 1] << 8) | (d[o + 2] << 16) | (d[o + 3] << 24);
+
+void _writeUint32BE(Uint8List out, int o, int v) {
+  out[o] = (v >>> 24) & 0xff;
+  out[o + 1] = (v >>> 16) & 0xff;
+  out[o + 2] = (v >>> 8) & 0xff;
+  out[o + 3] = v & 0xff;
+}
+
+class _Md5 extends StreamingDigest {
+  _Md5() : super._(64) {
+    _h[0] = 0x67452301;
+    _h[1] = 0xefcdab89;
+    _h[2] = 0x98badcfe;
+    _h[3] = 0x10325476;
+  }
+
+  final Uint32List _h = Uint32List(4);
+  final Uint32List _x = Uint32List(16);
+
+  static const List<int> _k = [
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391,
+  ];
+
+  static const List<int> _s = [
+    7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, //
+    5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, //
+    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, //
+    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21,
+  ];
+
+  @override
+  String get algorithm => 'md5';
+
+  @override
+  int get digestSize => 16;
+
+  @override
+  StreamingDigest _emptyClone() => _Md5();
+
+  @override
+  void _copyStateFrom(_Md5 other) {
+    _h.setAll(0, other._h);
+  }
+
+  @override
+  void _compress(Uint8List data, int offset) {
+    final x = _x;
+    for (var i = 0; i < 16; i++) {
+      x[i] = _readUint32LE(data, offset + i * 4);
+    }
+    var a = _h[0];
+    var b = _h[1];
+    var c = _h[2];
+    var d = _h[3];
+    for (var i = 0; i < 64; i++) {
+      int f;
+      int g;
+      if (i < 16) {
+        f = (b & c) | (~b & d);
+        g = i;
+      } else if (i < 32) {
+        f = (d & b) | (~d & c);
+        g = (5 * i + 1) & 15;
+      } else if (i < 48) {
+        f = b ^ c ^ d;
+        g = (3 * i + 5) & 15;
+      } else {
+        f = c ^ (b | (~d & _mask32));
+        g = (7 * i) & 15;
+      }
+      final t = d;
+      d = c;
+      c = b;
+      b = (b + _rotl32((a + (f & _mask32) + _k[i] + x[g]) & _mask32, _s[i])) &
+          _mask32;
+      a = t;
+    }
+    _h[0] += a;
+    _h[1] += b;
+    _h[2] += c;
+    _h[3] += d;
+  }
+
+  @override
+  void _writeLength(int bitLength) {
+    for (var i = 0; i < 8; i++) {
+      _block[56 + i] = (bitLength >>> (8 * i)) & 0xff;
+    }
+  }
+
+  @override
+  Uint8List _output() {
+    final out = Uint8List(16);
+    for (var i = 0; i < 4; i++) {
+      final v = _h[i];
+      out[i * 4] = v & 0xff;
+      out[i * 4 + 1] = (v >>> 8) & 0xff;
+      out[i * 4 + 2] = (v >>> 16) & 0xff;
+      out[i * 4 + 3] = (v >>> 24) & 0xff;
+    }
+    return out;
+  }
+}
+
+class _Sha1 extends StreamingDigest {
+  _Sha1() : super._(64) {
+    _h[0] = 0x67452301;
+    _h[1] = 0xefcdab89;
+    _h[2] = 0x98badcfe;
+    _h[3] = 0x10325476;
+    _h[4] = 0xc3d2e1f0;
+  }
+
+  final Uint32List _h = Uint32List(5);
+  final Uint32List _w = Uint32List(80);
+
+  @override
+  String get algorithm => 'sha1';
+
+  @override
+  int get digestSize => 20;
+
+  @override
+  StreamingDigest _emptyClone() => _Sha1();
+
+  @override
+  void _copyStateFrom(_Sha1 other) {
+    _h.setAll(0, other._h);
+  }
+
+  @override
+  void _compress(Uint8List data, int offset) {
+    final w = _w;
+    for (var i = 0; i < 16; i++) {
+      w[i] = _readUint32BE(data, offset + i * 4);
+    }
+    for (var i = 16; i < 80; i++) {
+      w[i] = _rotl32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+    var a = _h[0];
+    var b = _h[1];
+    var c = _h[2];
+    var d = _h[3];
+    var e = _h[4];
+    for (var i = 0; i < 80; i++) {
+      int f;
+      int k;
+      if (i < 20) {
+        f = (b & c) | (~b & d);
+        k = 0x5a827999;
+      } else if (i < 40) {
+        f = b ^ c ^ d;
+        k = 0x6ed9eba1;
+      } else if (i < 60) {
+        f = (b & c) | (b & d) | (c & d);
+        k = 0x8f1bbcdc;
+      } else {
+        f = b ^ c ^ d;
+        k = 0xca62c1d6;
+      }
+      final t = (_rotl32(a, 5) + (f & _mask32) + e + k + w[i]) & _mask32;
+      e = d;
+      d = c;
+      c = _rotl32(b, 30);
+      b = a;
+      a = t;
+    }
+    _h[0] += a;
+    _h[1] += b;
+    _h[2] += c;
+    _h[3] += d;
+    _h[4] += e;
+  }
+
+  @override
+  void _writeLength(int bitLength) => _writeLengthBigEndian(bitLength);
+
+  @override
+  Uint8List _output() {
+    final out = Uint8List(20);
+    for (var i = 0; i < 5; i++) {
+      _writeUint32BE(out, i * 4, _h[i]);
+    }
+    return out;
+  }
+}
+
+/// SHA-256 and its truncated SHA-224 variant.
+class _Sha256 extends StreamingDigest {
+  _Sha256(this._is224) : super._(64) {
+    _h.setAll(0, _is224 ? _iv224 : _iv256);
+  }
+
+  final bool _is224;
+  final Uint32List _h = Uint32List(8);
+  final Uint32List _w = Uint32List(64);
+
+  static const List<int> _iv224 = [
+    0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+    0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4,
+  ];
+
+  static const List<int> _iv256 = [
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+  ];
+
+  static const List<int> _k = [
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+  ];
+
+  @override
+  String get algorithm => _is224 ? 'sha224' : 'sha256';
+
+  @override
+  int get digestSize => _is224 ? 28 : 32;
+
+  @override
+  StreamingDigest _emptyClone() => _Sha256(_is224);
+
+  @override
+  void _copyStateFrom(_Sha256 other) {
+    _h.setAll(0, other._h);
+  }
+
+  @override
+  void _compress(Uint8List data, int offset) {
+    final w = _w;
+    for (var i = 0; i < 16; i++) {
+      w[i] = _readUint32BE(data, offset + i * 4);
+    }
+    for (var i = 16; i < 64; i++) {
+      final w15 = w[i - 15];
+      final w2 = w[i - 2];
+      final s0 = _rotr32(w15, 7) ^ _rotr32(w15, 18) ^ (w15 >>> 3);
+      final s1 = _rotr32(w2, 17) ^ _rotr32(w2, 19) ^ (w2 >>> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    var a = _h[0];
+    var b = _h[1];
+    var c = _h[2];
+    var d = _h[3];
+    var e = _h[4];
+    var f = _h[5];
+    var g = _h[6];
+    var h = _h[7];
+    for (var i = 0; i < 64; i++) {
+      final s1 = _rotr32(e, 6) ^ _rotr32(e, 11) ^ _rotr32(e, 25);
+      final ch = (e & f) ^ (~e & g);
+      final t1 = (h + s1 + ch + _k[i] + w[i]) & _mask32;
+      final s0 = _rotr32(a, 2) ^ _rotr32(a, 13) ^ _rotr32(a, 22);
+      final maj = (a & b) ^ (a & c) ^ (b & c);
+      final t2 = (s0 + maj) & _mask32;
+      h = g;
+      g = f;
+      f = e;
+      e = (d + t1) & _mask32;
+      d = c;
+      c = b;
+      b = a;
+      a = (t1 + t2) & _mask32;
+    }
+    _h[0] += a;
+    _h[1] += b;
+    _h[2] += c;
+    _h[3] += d;
+    _h[4] += e;
+    _h[5] += f;
+    _h[6] += g;
+    _h[7] += h;
+  }
+
+  @override
+  void _writeLength(int bitLength) => _writeLengthBigEndian(bitLength);
+
+  @override
+  Uint8List _output() {
+    final out = Uint8List(32);
+    for (var i = 0; i < 8; i++) {
+      _writeUint32BE(out, i * 4, _h[i]);
+    }
+    return _is224 ? Uint8List.sublistView(out, 0, 28) : out;
+  }
+}
+
+/// SHA-512 and its truncated SHA-384 variant.
+///
+/// Relies on the VM's wrapping 64-bit `int` arithmetic.
+class _Sha512 extends StreamingDigest {
+  _Sha512(this._is384) : super._(128) {
+    _h.setAll(0, _is384 ? _iv384 : _iv512);
+  }
+
+  final bool _is384;
+  final Int64List _h = Int64List(8);
+  final Int64List _w = Int64List(80);
+
+  static const List<int> _iv384 = [
+    0xcbbb9d5dc1059ed8, 0x629a292a367cd507,
+    0x9159015a3070dd17, 0x152fecd8f70e5939,
+    0x67332667ffc00b31, 0x8eb44a8768581511,
+    0xdb0c2e0d64f98fa7, 0x47b5481dbefa4fa4,
+  ];
+
+  static const List<int> _iv512 = [
+    0x6a09e667f3bcc908, 0xbb67ae8584caa73b,
+    0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+    0x510e527fade682d1, 0x9b05688c2b3e6c1f,
+    0x1f83d9abfb41bd6b, 0x5be0cd19137e2179,
+  ];
+
+  static const List<int> _k = [
+    0x428a2f98d728ae22, 0x7137449123ef65cd,
+    0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
+    0x3956c25bf348b538, 0x59f111f1b605d019,
+    0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
+    0xd807aa98a3030242, 0x12835b0145706fbe,
+    0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+    0x72be5d74f27b896f, 0x80deb1fe3b1696b1,
+    0x9bdc06a725c71235, 0xc19bf174cf692694,
+    0xe49b69c19ef14ad2, 0xefbe4786384f25e3,
+    0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+    0x2de92c6f592b0275, 0x4a7484aa6ea6e483,
+    0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+    0x983e5152ee66dfab, 0xa831c66d2db43210,
+    0xb00327c898fb213f, 0xbf597fc7beef0ee4,
+    0xc6e00bf33da88fc2, 0xd5a79147930aa725,
+    0x06ca6351e003826f, 0x142929670a0e6e70,
+    0x27b70a8546d22ffc, 0x2e1b21385c26c926,
+    0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+    0x650a73548baf63de, 0x766a0abb3c77b2a8,
+    0x81c2c92e47edaee6, 0x92722c851482353b,
+    0xa2bfe8a14cf10364, 0xa81a664bbc423001,
+    0xc24b8b70d0f89791, 0xc76c51a30654be30,
+    0xd192e819d6ef5218, 0xd69906245565a910,
+    0xf40e35855771202a, 0x106aa07032bbd1b8,
+    0x19a4c116b8d2d0c8, 0x1e376c085141ab53,
+    0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
+    0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb,
+    0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
+    0x748f82ee5defb2fc, 0x78a5636f43172f60,
+    0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+    0x90befffa23631e28, 0xa4506cebde82bde9,
+    0xbef9a3f7b2c67915, 0xc67178f2e372532b,
+    0xca273eceea26619c, 0xd186b8c721c0c207,
+    0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
+    0x06f067aa72176fba, 0x0a637dc5a2c898a6,
+    0x113f9804bef90dae, 0x1b710b35131c471b,
+    0x28db77f523047d84, 0x32caab7b40c72493,
+    0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
+    0x4cc5d4becb3e42b6, 0x597f299cfc657e2a,
+    0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
+  ];
+
+  @override
+  String get algorithm => _is384 ? 'sha384' : 'sha512';
+
+  @override
+  int get digestSize => _is384 ? 48 : 64;
+
+  @override
+  StreamingDigest _emptyClone() => _Sha512(_is384);
+
+  @override
+  void _copyStateFrom(_Sha512 other) {
+    _h.setAll(0, other._h);
+  }
+
+  @override
+  void _compress(Uint8List data, int offset) {
+    final w = _w;
+    for (var i = 0; i < 16; i++) {
+      final o = offset + i * 8;
+      w[i] = (_readUint32BE(data, o) << 32) | _readUint32BE(data, o + 4);
+    }
+    for (var i = 16; i < 80; i++) {
+      final w15 = w[i - 15];
+      final w2 = w[i - 2];
+      final s0 = _rotr64(w15, 1) ^ _rotr64(w15, 8) ^ (w15 >>> 7);
+      final s1 = _rotr64(w2, 19) ^ _rotr64(w2, 61) ^ (w2 >>> 6);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    var a = _h[0];
+    var b = _h[1];
+    var c = _h[2];
+    var d = _h[3];
+    var e = _h[4];
+    var f = _h[5];
+    var g = _h[6];
+    var h = _h[7];
+    for (var i = 0; i < 80; i++) {
+      final s1 = _rotr64(e, 14) ^ _rotr64(e, 18) ^ _rotr64(e, 41);
+      final ch = (e & f) ^ (~e & g);
+      final t1 = h + s1 + ch + _k[i] + w[i];
+      final s0 = _rotr64(a, 28) ^ _rotr64(a, 34) ^ _rotr64(a, 39);
+      final maj = (a & b) ^ (a & c) ^ (b & c);
+      final t2 = s0 + maj;
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+    }
+    _h[0] += a;
+    _h[1] += b;
+    _h[2] += c;
+    _h[3] += d;
+    _h[4] += e;
+    _h[5] += f;
+    _h[6] += g;
+    _h[7] += h;
+  }
+
+  @override
+  void _writeLength(int bitLength) => _writeLengthBigEndian(bitLength);
+
+  @override
+  Uint8List _output() {
+    final out = Uint8List(64);
+    for (var i = 0; i < 8; i++) {
+      final v = _h[i];
+      _writeUint32BE(out, i * 8, (v >>> 32) & _mask32);
+      _writeUint32BE(out, i * 8 + 4, v & _mask32);
+    }
+    return _is384 ? Uint8List.sublistView(out, 0, 48) : out;
+  }
+}
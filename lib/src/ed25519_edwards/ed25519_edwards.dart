@@ -13,6 +13,7 @@ import 'dart:typed_data';
 import 'package:convert/convert.dart';
 import 'package:collection/collection.dart';
 import 'package:crypto/crypto.dart';
+import '../utils/fe25519.dart';
 import 'src/edwards25519.dart';
 import 'src/util.dart';
 
@@ -175,8 +176,8 @@ bool verify(PublicKey publicKey, Uint8List message, Uint8List sig) {
   if (!A.FromBytes(publicKeyBytes)) {
     return false;
   }
-  FeNeg(A.X, A.X);
-  FeNeg(A.T, A.T);
+  feNeg(A.X, A.X);
+  feNeg(A.T, A.T);
 
   var output = AccumulatorSink<Digest>();
   var input = sha512.startChunkedConversion(output);
@@ -202,3 +203,113 @@ bool verify(PublicKey publicKey, Uint8List message, Uint8List sig) {
   R.ToBytes(checkR);
   return ListEquality().equals(sig.sublist(0, 32), checkR);
 }
+
+/// VerifyBatch reports whether every signatures[i] is a valid signature of
+/// messages[i] by publicKeys[i]. It will throw ArgumentError if the lists
+/// differ in length or a public key is not PublicKeySize bytes long.
+///
+/// The signatures are checked together with one multi-scalar multiplication:
+/// with random 128-bit z_i it tests 8·Σ z_i(s_i·B − R_i − h_i·A_i) = 0,
+/// which costs one shared doubling chain instead of one per signature. A
+/// batch holding an invalid signature passes with probability about 2^-128.
+/// The equation is the cofactored one, so signatures built from small-order
+/// components that Verify rejects may be accepted here. A false result
+/// does not say which signature failed; callers that need to know should
+/// fall back to Verify on each entry.
+bool verifyBatch(List<PublicKey> publicKeys, List<Uint8List> messages,
+    List<Uint8List> signatures) {
+  if (publicKeys.length != messages.length ||
+      publicKeys.length != signatures.length) {
+    throw ArgumentError('ed25519: batch lists differ in length');
+  }
+  final n = publicKeys.length;
+  if (n == 0) {
+    return true;
+  }
+
+  final scalars = <Uint8List>[];
+  final points = <ExtendedGroupElement>[];
+  final zero = Uint8List(32);
+  final bScalar = Uint8List(32);
+
+  for (var i = 0; i < n; i++) {
+    final publicKey = publicKeys[i];
+    final sig = signatures[i];
+    if (publicKey.bytes.length != PublicKeySize) {
+      throw ArgumentError(
+          'ed25519: bad publicKey length ${publicKey.bytes.length}');
+    }
+    if (sig.length != SignatureSize || sig[63] & 224 != 0) {
+      return false;
+    }
+    final s = sig.sublist(32);
+    if (!ScMinimal(s)) {
+      return false;
+    }
+
+    // Verify compares the encoding of R, so a non-canonical one never passes.
+    final encodedR = sig.sublist(0, 32);
+    if (!_isCanonicalY(encodedR)) {
+      return false;
+    }
+    final R = ExtendedGroupElement();
+    final A = ExtendedGroupElement();
+    final publicKeyBytes = Uint8List.fromList(publicKey.bytes);
+    if (!R.FromBytes(encodedR) || !A.FromBytes(publicKeyBytes)) {
+      return false;
+    }
+    feNeg(R.X, R.X);
+    feNeg(R.T, R.T);
+    feNeg(A.X, A.X);
+    feNeg(A.T, A.T);
+
+    final output = AccumulatorSink<Digest>();
+    final input = sha512.startChunkedConversion(output);
+    input.add(encodedR);
+    input.add(publicKeyBytes);
+    input.add(messages[i]);
+    input.close();
+    final hReduced = Uint8List(32);
+    ScReduce(hReduced, output.events.single.bytes as Uint8List);
+
+    final z = Uint8List(32);
+    fillBytesWithSecureRandomNumbers(Uint8List.sublistView(z, 0, 16));
+    final zh = Uint8List(32);
+    ScMulAdd(zh, z, hReduced, zero);
+    ScMulAdd(bScalar, z, s, bScalar);
+
+    scalars
+      ..add(zh)
+      ..add(z);
+    points
+      ..add(A)
+      ..add(R);
+  }
+
+  final sum = ProjectiveGroupElement();
+  GeMultiScalarMultVartime(sum, scalars, points, bScalar);
+
+  final t = CompletedGroupElement();
+  for (var i = 0; i < 3; i++) {
+    sum.Double(t);
+    t.ToProjective(sum);
+  }
+  final encoded = Uint8List(32);
+  sum.ToBytes(encoded);
+  return ListEquality().equals(encoded, _identity);
+}
+
+final Uint8List _identity = Uint8List(32)..[0] = 1;
+
+/// Whether the y coordinate in [s] is below 2^255 - 19.
+bool _isCanonicalY(Uint8List s) {
+  if ((s[31] & 0x7f) != 0x7f || s[0] < 0xed) {
+    return true;
+  }
+  for (var i = 1; i < 31; i++) {
+    if (s[i] != 0xff) {
+      return true;
+    }
+  }
+  return false;
+}
@@ -1,20 +0,0 @@
-
-
-import 'package:tlslite/src/adaptive_number/adaptive_number.dart';
-
-abstract class Numbers {
-  static Number v8 = Number(8);
-  static Number v15 = Number(15);
-  static Number v19 = Number(19);
-  static Number v24 = Number(24);
-  static Number v25 = Number(25);
-  static Number v26 = Number(26);
-  static Number v38 = Number(38);
-  static Number v136657 = Number(136657);
-  static Number v2097151 = Number(2097151);
-  static Number v470296 = Number(470296);
-  static Number v683901 = Number(683901);
-  static Number v654183 = Number(654183);
-  static Number v666643 = Number(666643);
-  static Number v997805 = Number(997805);
-}
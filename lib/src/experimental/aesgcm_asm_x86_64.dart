@@ -20,7 +20,10 @@ import 'dart:typed_data';
 
 import 'package:ffi/ffi.dart' as pkgffi;
 
-import 'rijndael_fast_asm_x86_64.dart' show ExecutableMemory;
+import '../utils/aesgcm.dart';
+import 'aesgcm_fused_shellcode_x86_64.dart';
+import 'rijndael_fast_asm_x86_64.dart' show AesNiSupport, ExecutableMemory;
+import 'win64_thunk_x86_64.dart';
 
 /// Verifica se PCLMULQDQ é suportado
 class PclmulqdqSupport {
@@ -391,6 +394,159 @@ class GhashAsm {
   }
 }
 
+/// Assinatura nativa de `gcm_kernel(params, in, out, aad)`
+typedef GcmKernelNativeFunc = ffi.Void Function(ffi.Pointer<ffi.Uint8>,
+    ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>);
+typedef GcmKernelDartFunc = void Function(ffi.Pointer<ffi.Uint8>,
+    ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>);
+
+/// Assinatura nativa de `gcm_init(params, key)`
+typedef GcmInitNativeFunc = ffi.Void Function(
+    ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>);
+typedef GcmInitDartFunc = void Function(
+    ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>);
+
+/// Kernel AES-GCM fundido (AES-NI + PCLMULQDQ)
+///
+/// Um registro inteiro (AAD, CTR de 4 blocos intercalados, GHASH com redução
+/// agregada sobre H^4..H^1 e a tag) é processado numa única transição FFI,
+/// lendo e escrevendo direto nos [Uint8List] do Dart (chamadas leaf).
+/// O código está em asm/aesgcm_ctr_ghash_x86_64.S.
+///
+/// O shellcode é compartilhado por todas as instâncias; cada instância tem
+/// só o seu bloco de parâmetros (key schedule, nonce, tag), liberado por
+/// [dispose] ou quando a instância é coletada.
+class AesGcmFusedKernel {
+  static const int _offLength = 0;
+  static const int _offAadLength = 8;
+  static const int _offRoundKeys = 16;
+  static const int _offLastRoundKey = 24;
+  static const int _offNonce = 32;
+  static const int _offTag = 112;
+  static const int _offDecrypt = 128;
+  static const int _offKeySchedule = 144;
+  static const int _paramsSize = 384;
+
+  static ExecutableMemory? _code;
+  static GcmKernelDartFunc? _kernel;
+  static GcmInitDartFunc? _init;
+
+  static final Finalizer<ffi.Pointer<ffi.Uint8>> _finalizer = Finalizer(_releaseParams);
+
+  final ffi.Pointer<ffi.Uint8> _params;
+  bool _disposed = false;
+
+  /// Verdadeiro quando AES-NI e PCLMULQDQ estão disponíveis
+  static bool get isSupported =>
+      AesNiSupport.isSupported && PclmulqdqSupport.isSupported;
+
+  /// Prepara o kernel para [key] (16 ou 32 bytes)
+  AesGcmFusedKernel(Uint8List key) : _params = pkgffi.calloc<ffi.Uint8>(_paramsSize) {
+    if (key.length != 16 && key.length != 32) {
+      pkgffi.calloc.free(_params);
+      throw ArgumentError('AES-GCM key must be 16 or 32 bytes long');
+    }
+    if (!isSupported) {
+      pkgffi.calloc.free(_params);
+      throw UnsupportedError('AES-NI/PCLMULQDQ não suportado nesta plataforma');
+    }
+    _ensureCode();
+
+    final rounds = key.length == 16 ? 10 : 14;
+    final params = _params.cast<ffi.Uint64>();
+    params[_offLength ~/ 8] = key.length;
+    params[_offRoundKeys ~/ 8] = _params.address + _offKeySchedule;
+    params[_offLastRoundKey ~/ 8] = _params.address + _offKeySchedule + rounds * 16;
+    _init!(_params, key.address);
+    _finalizer.attach(this, _params, detach: this);
+  }
+
+  static void _ensureCode() {
+    if (_code != null) return;
+    final int kernelEntry;
+    final int initEntry;
+    if (Platform.isWindows) {
+      // [thunk kernel][thunk init][corpo System V]
+      const bodyStart = 2 * kWindowsThunkSize;
+      _code = ExecutableMemory.allocate(Uint8List.fromList([
+        ...windowsSysVThunk(bodyStart - kWindowsThunkCallEnd),
+        ...windowsSysVThunk(bodyStart - kWindowsThunkSize + kAesGcmFusedInitOffset - kWindowsThunkCallEnd),
+        ...kAesGcmFusedShellcode,
+      ]));
+      kernelEntry = 0;
+      initEntry = kWindowsThunkSize;
+    } else {
+      _code = ExecutableMemory.allocate(Uint8List.fromList(kAesGcmFusedShellcode));
+      kernelEntry = 0;
+      initEntry = kAesGcmFusedInitOffset;
+    }
+
+    _kernel = (_code!.pointer.cast<ffi.Uint8>() + kernelEntry)
+        .cast<ffi.NativeFunction<GcmKernelNativeFunc>>()
+        .asFunction<GcmKernelDartFunc>(isLeaf: true);
+    _init = (_code!.pointer.cast<ffi.Uint8>() + initEntry)
+        .cast<ffi.NativeFunction<GcmInitNativeFunc>>()
+        .asFunction<GcmInitDartFunc>(isLeaf: true);
+  }
+
+  /// Apaga o key schedule antes de devolver o bloco de parâmetros
+  static void _releaseParams(ffi.Pointer<ffi.Uint8> params) {
+    for (int i = 0; i < _paramsSize; i++) {
+      params[i] = 0;
+    }
+    pkgffi.calloc.free(params);
+  }
+
+  void _run(Uint8List nonce, Uint8List input, Uint8List output, int outOffset, Uint8List aad, bool decrypt) {
+    if (_disposed) {
+      throw StateError('AesGcmFusedKernel já foi liberado (dispose)');
+    }
+    final params = _params.cast<ffi.Uint64>();
+    params[_offLength ~/ 8] = input.length;
+    params[_offAadLength ~/ 8] = aad.length;
+    params[_offDecrypt ~/ 8] = decrypt ? 1 : 0;
+    for (int i = 0; i < 12; i++) {
+      _params[_offNonce + i] = nonce[i];
+    }
+    final out = Uint8List.sublistView(output, outOffset, outOffset + input.length);
+    _kernel!(_params, input.address, out.address, aad.address);
+  }
+
+  /// Encripta [plaintext] em `output[outOffset:]` e escreve a tag logo em
+  /// seguida. [output] deve ter espaço para `plaintext.length + 16` bytes.
+  void seal(Uint8List nonce, Uint8List plaintext, Uint8List aad, Uint8List output, int outOffset) {
+    _run(nonce, plaintext, output, outOffset, aad, false);
+    final tagOffset = outOffset + plaintext.length;
+    for (int i = 0; i < 16; i++) {
+      output[tagOffset + i] = _params[_offTag + i];
+    }
+  }
+
+  /// Decripta [ciphertext] no próprio buffer e confere [tag] em tempo
+  /// constante. Se a tag não confere, o ciphertext é restaurado (CTR é
+  /// simétrico) e o resultado é `false`.
+  bool openInPlace(Uint8List nonce, Uint8List ciphertext, Uint8List tag, Uint8List aad) {
+    _run(nonce, ciphertext, ciphertext, 0, aad, true);
+    int diff = 0;
+    for (int i = 0; i < 16; i++) {
+      diff |= _params[_offTag + i] ^ tag[i];
+    }
+    if (diff != 0) {
+      _run(nonce, ciphertext, ciphertext, 0, aad, false);
+      return false;
+    }
+    return true;
+  }
+
+  /// Apaga a chave e libera o bloco de parâmetros (o shellcode é global)
+  void dispose() {
+    if (_disposed) return;
+    _finalizer.detach(this);
+    _releaseParams(_params);
+    _disposed = true;
+  }
+}
+
 /// Tipo de função para encriptação AES de bloco único
 typedef RawAesEncryptFunc = Uint8List Function(Uint8List block);
 
@@ -400,74 +556,118 @@ typedef RawAesEncryptFunc = Uint8List Function(Uint8List block);
 /// - AES-NI para encriptação de blocos (via RijndaelAsmX8664)
 /// - PCLMULQDQ para GHASH (multiplicação GF(2^128))
 ///
+/// Com AES-NI disponível, seal/open usam o [AesGcmFusedKernel]: uma chamada
+/// FFI por registro em vez de uma por bloco de 16 bytes.
+///
+/// Mesma API de [AESGCM]; selecionado por
+/// `createAESGCM(key, implementations: ['asm-x86_64', ...])`.
+///
 /// Speedup esperado: 50-100x sobre a implementação BigInt
-class AESGCMAsm {
-  final Uint8List key;
-  final String implementation = 'asm-x86_64';
-  late final String name;
-  final RawAesEncryptFunc _rawAesEncrypt;
-
-  final bool isBlockCipher = false;
-  final bool isAEAD = true;
-  final int nonceLength = 12;
-  final int tagLength = 16;
-
-  late final Uint8List _h; // Hash subkey H = AES_K(0^128)
-  late final GhashAsm _ghash;
-
-  AESGCMAsm(this.key, this._rawAesEncrypt) {
-    if (key.length == 16) {
-      name = 'aes128gcm';
-    } else if (key.length == 32) {
-      name = 'aes256gcm';
+class AESGCMAsm extends AESGCM {
+  /// Encriptação de bloco do caminho por bloco; `null` em [AESGCMAsm.fused]
+  final RawAesEncryptFunc? _rawAesEncrypt;
+
+  /// GHASH do caminho por bloco; só existe quando [_fused] é `null`
+  GhashAsm? _ghash;
+
+  /// Kernel fundido AES-NI + PCLMULQDQ; `null` quando AES-NI não existe e
+  /// o caminho por bloco (via [_rawAesEncrypt]) é usado.
+  AesGcmFusedKernel? _fused;
+
+  AESGCMAsm(Uint8List key, RawAesEncryptFunc rawAesEncrypt)
+      : _rawAesEncrypt = rawAesEncrypt,
+        super.withBackend(key, 'asm-x86_64') {
+    if (AesGcmFusedKernel.isSupported) {
+      _fused = AesGcmFusedKernel(key);
     } else {
-      throw ArgumentError('AES-GCM key must be 16 or 32 bytes long');
+      // H = AES_K(0^128)
+      _ghash = GhashAsm(rawAesEncrypt(Uint8List(16)));
     }
-
-    // Calcula H = AES_K(0^128)
-    _h = _rawAesEncrypt(Uint8List(16));
-    _ghash = GhashAsm(_h);
   }
 
+  /// Só o kernel fundido, sem encriptação de bloco separada; requer
+  /// [AesGcmFusedKernel.isSupported]
+  AESGCMAsm.fused(Uint8List key)
+      : _rawAesEncrypt = null,
+        _fused = AesGcmFusedKernel(key),
+        super.withBackend(key, 'asm-x86_64');
+
   /// Verifica se a implementação otimizada está disponível
   static bool get isSupported => PclmulqdqSupport.isSupported;
 
   /// Encripta e autentica plaintext com AAD
+  @override
   Uint8List seal(Uint8List nonce, Uint8List plaintext, Uint8List aad) {
+    final result = Uint8List(plaintext.length + tagLength);
+    sealInto(nonce, plaintext, aad, result, 0);
+    return result;
+  }
+
+  /// Encripta [plaintext] escrevendo `ciphertext || tag` em [out] a partir de
+  /// [outOffset]; devolve o número de bytes escritos.
+  ///
+  /// [plaintext] pode ser uma view de [out] no mesmo offset (encriptação in
+  /// place).
+  @override
+  int sealInto(Uint8List nonce, Uint8List plaintext, Uint8List aad, Uint8List out, int outOffset) {
     _checkNonce(nonce);
+    final length = plaintext.length;
+    if (outOffset < 0 || out.length - outOffset < length + tagLength) {
+      throw ArgumentError('Output buffer too small');
+    }
+
+    // Registro inteiro numa chamada nativa quando AES-NI está disponível
+    final fused = _fused;
+    if (fused != null) {
+      fused.seal(nonce, plaintext, aad, out, outOffset);
+      return length + tagLength;
+    }
 
     // Gera o contador inicial para a tag (counter = 1)
     final tagCounter = _buildCounter(nonce, 1);
-    final tagMask = _rawAesEncrypt(tagCounter);
+    final tagMask = _rawAesEncrypt!(tagCounter);
 
-    // Encripta plaintext com counter mode (counter inicial = 2)
-    final ciphertext = _encryptCtr(nonce, plaintext, 2);
+    // Encripta plaintext com counter mode (counter inicial = 2) direto em out
+    _xorCtr(nonce, plaintext, 2, out, outOffset);
+    final ciphertext = Uint8List.sublistView(out, outOffset, outOffset + length);
 
-    // Calcula tag via GHASH
+    // Calcula tag via GHASH e escreve logo após o ciphertext
     final tag = _computeTag(aad, ciphertext, tagMask);
-
-    // Retorna ciphertext || tag
-    final result = Uint8List(ciphertext.length + tagLength);
-    result.setRange(0, ciphertext.length, ciphertext);
-    result.setRange(ciphertext.length, result.length, tag);
-    return result;
+    out.setRange(outOffset + length, outOffset + length + tagLength, tag);
+    return length + tagLength;
   }
 
   /// Decripta e verifica ciphertextWithTag
+  @override
   Uint8List? open(Uint8List nonce, Uint8List ciphertextWithTag, Uint8List aad) {
+    return openInPlace(nonce, Uint8List.fromList(ciphertextWithTag), aad);
+  }
+
+  /// Verifica e decripta [ciphertextWithTag] no próprio buffer.
+  ///
+  /// Devolve uma view do plaintext (início de [ciphertextWithTag]) ou `null`
+  /// se a tag não confere; nesse caso o buffer não é modificado.
+  @override
+  Uint8List? openInPlace(Uint8List nonce, Uint8List ciphertextWithTag, Uint8List aad) {
     _checkNonce(nonce);
 
     if (ciphertextWithTag.length < tagLength) {
       return null;
     }
 
-    // Separa ciphertext e tag
-    final ciphertext = ciphertextWithTag.sublist(0, ciphertextWithTag.length - tagLength);
-    final tag = ciphertextWithTag.sublist(ciphertextWithTag.length - tagLength);
+    // Separa ciphertext e tag (views, sem cópia)
+    final length = ciphertextWithTag.length - tagLength;
+    final ciphertext = Uint8List.sublistView(ciphertextWithTag, 0, length);
+    final tag = Uint8List.sublistView(ciphertextWithTag, length);
+
+    final fused = _fused;
+    if (fused != null) {
+      return fused.openInPlace(nonce, ciphertext, tag, aad) ? ciphertext : null;
+    }
 
     // Gera tag mask
     final tagCounter = _buildCounter(nonce, 1);
-    final tagMask = _rawAesEncrypt(tagCounter);
+    final tagMask = _rawAesEncrypt!(tagCounter);
 
     // Verifica tag
     final expectedTag = _computeTag(aad, ciphertext, tagMask);
@@ -475,8 +675,9 @@ class AESGCMAsm {
       return null;
     }
 
-    // Decripta (CTR mode é simétrico)
-    return _encryptCtr(nonce, ciphertext, 2);
+    // Decripta in place (CTR mode é simétrico)
+    _xorCtr(nonce, ciphertext, 2, ciphertext, 0);
+    return ciphertext;
   }
 
   void _checkNonce(Uint8List nonce) {
@@ -495,9 +696,9 @@ class AESGCMAsm {
     return counter;
   }
 
-  /// CTR mode encryption
-  Uint8List _encryptCtr(Uint8List nonce, Uint8List input, int initialCounter) {
-    final output = Uint8List(input.length);
+  /// CTR mode: XOR do keystream sobre [input], escrito em [output] a partir
+  /// de [outOffset]. [input] pode ser a mesma região de [output].
+  void _xorCtr(Uint8List nonce, Uint8List input, int initialCounter, Uint8List output, int outOffset) {
     final counter = _buildCounter(nonce, initialCounter);
     var counterVal = initialCounter;
 
@@ -510,11 +711,12 @@ class AESGCMAsm {
       counter[15] = counterVal & 0xFF;
 
       // Encripta contador
-      final keystream = _rawAesEncrypt(counter);
+      final keystream = _rawAesEncrypt!(counter);
 
       // XOR com input
+      final base = i * 16;
       for (int j = 0; j < 16; j++) {
-        output[i * 16 + j] = input[i * 16 + j] ^ keystream[j];
+        output[outOffset + base + j] = input[base + j] ^ keystream[j];
       }
 
       counterVal++;
@@ -528,32 +730,31 @@ class AESGCMAsm {
       counter[14] = (counterVal >> 8) & 0xFF;
       counter[15] = counterVal & 0xFF;
 
-      final keystream = _rawAesEncrypt(counter);
+      final keystream = _rawAesEncrypt!(counter);
       final offset = fullBlocks * 16;
       for (int j = 0; j < extra; j++) {
-        output[offset + j] = input[offset + j] ^ keystream[j];
+        output[outOffset + offset + j] = input[offset + j] ^ keystream[j];
       }
     }
-
-    return output;
   }
 
   /// Computa tag via GHASH
   Uint8List _computeTag(Uint8List aad, Uint8List ciphertext, Uint8List tagMask) {
-    _ghash.reset();
+    final ghash = _ghash!;
+    ghash.reset();
 
     // Processa AAD (com padding)
     if (aad.isNotEmpty) {
-      _ghash.update(_padTo16(aad));
+      ghash.update(_padTo16(aad));
     }
 
     // Processa ciphertext (com padding)
     if (ciphertext.isNotEmpty) {
-      _ghash.update(_padTo16(ciphertext));
+      ghash.update(_padTo16(ciphertext));
     }
 
     // Finaliza com blocos de comprimento
-    final digest = _ghash.finalize(aad.length, ciphertext.length);
+    final digest = ghash.finalize(aad.length, ciphertext.length);
 
     // XOR com tag mask
     for (int i = 0; i < 16; i++) {
@@ -586,6 +787,7 @@ class AESGCMAsm {
 
   /// Libera recursos nativos
   void dispose() {
-    _ghash.dispose();
+    _ghash?.dispose();
+    _fused?.dispose();
   }
 }
@@ -0,0 +1,162 @@
+// dart format width=5000
+// AUTO-GENERATED - DO NOT EDIT
+// Shellcode montado de asm/aesgcm_ctr_ghash_x86_64.S
+//   as --64 -o aesgcm_ctr_ghash_x86_64.o aesgcm_ctr_ghash_x86_64.S
+//   objcopy -O binary -j .text aesgcm_ctr_ghash_x86_64.o aesgcm_ctr_ghash_x86_64.bin
+// Tamanho: 2358 bytes
+
+/// Shellcode x86_64 (System V) com as entradas `gcm_kernel` (offset 0) e
+/// `gcm_init` (offset [kAesGcmFusedInitOffset]).
+const List<int> kAesGcmFusedShellcode = [
+  0xE9, 0x0F, 0x03, 0x00, 0x00, 0xF3, 0x41, 0x0F, 0x6F, 0x20, 0x66, 0x0F, 0xEF, 0xC4, 0x49, 0x8D,
+  0x40, 0x10, 0xF3, 0x0F, 0x6F, 0x20, 0x66, 0x0F, 0x38, 0xDC, 0xC4, 0x48, 0x83, 0xC0, 0x10, 0x4C,
+  0x39, 0xC8, 0x72, 0xEE, 0xF3, 0x41, 0x0F, 0x6F, 0x21, 0x66, 0x0F, 0x38, 0xDD, 0xC4, 0xC3, 0xF3,
+  0x41, 0x0F, 0x6F, 0x20, 0x66, 0x0F, 0xEF, 0xC4, 0x66, 0x0F, 0xEF, 0xCC, 0x66, 0x0F, 0xEF, 0xD4,
+  0x66, 0x0F, 0xEF, 0xDC, 0x49, 0x8D, 0x40, 0x10, 0xF3, 0x0F, 0x6F, 0x20, 0x66, 0x0F, 0x38, 0xDC,
+  0xC4, 0x66, 0x0F, 0x38, 0xDC, 0xCC, 0x66, 0x0F, 0x38, 0xDC, 0xD4, 0x66, 0x0F, 0x38, 0xDC, 0xDC,
+  0x48, 0x83, 0xC0, 0x10, 0x4C, 0x39, 0xC8, 0x72, 0xDF, 0xF3, 0x41, 0x0F, 0x6F, 0x21, 0x66, 0x0F,
+  0x38, 0xDD, 0xC4, 0x66, 0x0F, 0x38, 0xDD, 0xCC, 0x66, 0x0F, 0x38, 0xDD, 0xD4, 0x66, 0x0F, 0x38,
+  0xDD, 0xDC, 0xC3, 0x66, 0x44, 0x0F, 0x6F, 0xC7, 0x66, 0x41, 0x0F, 0x73, 0xF8, 0x08, 0x66, 0x0F,
+  0x73, 0xDF, 0x08, 0x66, 0x41, 0x0F, 0xEF, 0xE8, 0x66, 0x0F, 0xEF, 0xF7, 0x66, 0x0F, 0x6F, 0xFD,
+  0x66, 0x44, 0x0F, 0x6F, 0xC6, 0x66, 0x0F, 0x72, 0xF5, 0x01, 0x66, 0x0F, 0x72, 0xF6, 0x01, 0x66,
+  0x0F, 0x72, 0xD7, 0x1F, 0x66, 0x41, 0x0F, 0x72, 0xD0, 0x1F, 0x66, 0x44, 0x0F, 0x6F, 0xCF, 0x66,
+  0x41, 0x0F, 0x73, 0xF8, 0x04, 0x66, 0x0F, 0x73, 0xFF, 0x04, 0x66, 0x41, 0x0F, 0x73, 0xD9, 0x0C,
+  0x66, 0x0F, 0xEB, 0xEF, 0x66, 0x41, 0x0F, 0xEB, 0xF0, 0x66, 0x41, 0x0F, 0xEB, 0xF1, 0x66, 0x0F,
+  0x6F, 0xFD, 0x66, 0x44, 0x0F, 0x6F, 0xC5, 0x66, 0x44, 0x0F, 0x6F, 0xCD, 0x66, 0x0F, 0x72, 0xF7,
+  0x1F, 0x66, 0x41, 0x0F, 0x72, 0xF0, 0x1E, 0x66, 0x41, 0x0F, 0x72, 0xF1, 0x19, 0x66, 0x41, 0x0F,
+  0xEF, 0xF8, 0x66, 0x41, 0x0F, 0xEF, 0xF9, 0x66, 0x44, 0x0F, 0x6F, 0xC7, 0x66, 0x0F, 0x73, 0xFF,
+  0x0C, 0x66, 0x41, 0x0F, 0x73, 0xD8, 0x04, 0x66, 0x0F, 0xEF, 0xEF, 0x66, 0x44, 0x0F, 0x6F, 0xD5,
+  0x66, 0x0F, 0x6F, 0xFD, 0x66, 0x44, 0x0F, 0x6F, 0xCD, 0x66, 0x41, 0x0F, 0x72, 0xD2, 0x01, 0x66,
+  0x0F, 0x72, 0xD7, 0x02, 0x66, 0x41, 0x0F, 0x72, 0xD1, 0x07, 0x66, 0x44, 0x0F, 0xEF, 0xD7, 0x66,
+  0x45, 0x0F, 0xEF, 0xD1, 0x66, 0x45, 0x0F, 0xEF, 0xD0, 0x66, 0x41, 0x0F, 0xEF, 0xEA, 0x66, 0x0F,
+  0xEF, 0xF5, 0x66, 0x44, 0x0F, 0x6F, 0xF6, 0xC3, 0x66, 0x0F, 0xEF, 0xED, 0x66, 0x0F, 0xEF, 0xF6,
+  0x66, 0x0F, 0xEF, 0xFF, 0xF3, 0x44, 0x0F, 0x6F, 0x4F, 0x30, 0x66, 0x44, 0x0F, 0x6F, 0xC0, 0x66,
+  0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xE8, 0x66, 0x44, 0x0F, 0x6F, 0xC0,
+  0x66, 0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x11, 0x66, 0x41, 0x0F, 0xEF, 0xF0, 0x66, 0x44, 0x0F, 0x6F,
+  0xC0, 0x66, 0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x01, 0x66, 0x41, 0x0F, 0xEF, 0xF8, 0x66, 0x41, 0x0F,
+  0x3A, 0x44, 0xC1, 0x10, 0x66, 0x0F, 0xEF, 0xF8, 0xE9, 0xD6, 0xFE, 0xFF, 0xFF, 0xF3, 0x41, 0x0F,
+  0x6F, 0x02, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xC7, 0x66, 0x41, 0x0F, 0xEF, 0xC6, 0xEB, 0x99, 0xF3,
+  0x41, 0x0F, 0x6F, 0x02, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xC7, 0x66, 0x41, 0x0F, 0xEF, 0xC6, 0xF3,
+  0x41, 0x0F, 0x6F, 0x4A, 0x10, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xCF, 0xF3, 0x41, 0x0F, 0x6F, 0x52,
+  0x20, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xD7, 0xF3, 0x41, 0x0F, 0x6F, 0x5A, 0x30, 0x66, 0x41, 0x0F,
+  0x38, 0x00, 0xDF, 0x66, 0x0F, 0xEF, 0xED, 0x66, 0x0F, 0xEF, 0xF6, 0x66, 0x0F, 0xEF, 0xFF, 0xF3,
+  0x44, 0x0F, 0x6F, 0x4F, 0x60, 0x66, 0x44, 0x0F, 0x6F, 0xC0, 0x66, 0x45, 0x0F, 0x3A, 0x44, 0xC1,
+  0x00, 0x66, 0x41, 0x0F, 0xEF, 0xE8, 0x66, 0x44, 0x0F, 0x6F, 0xC0, 0x66, 0x45, 0x0F, 0x3A, 0x44,
+  0xC1, 0x11, 0x66, 0x41, 0x0F, 0xEF, 0xF0, 0x66, 0x44, 0x0F, 0x6F, 0xC0, 0x66, 0x45, 0x0F, 0x3A,
+  0x44, 0xC1, 0x01, 0x66, 0x41, 0x0F, 0xEF, 0xF8, 0x66, 0x41, 0x0F, 0x3A, 0x44, 0xC1, 0x10, 0x66,
+  0x0F, 0xEF, 0xF8, 0xF3, 0x44, 0x0F, 0x6F, 0x4F, 0x50, 0x66, 0x44, 0x0F, 0x6F, 0xC1, 0x66, 0x45,
+  0x0F, 0x3A, 0x44, 0xC1, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xE8, 0x66, 0x44, 0x0F, 0x6F, 0xC1, 0x66,
+  0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x11, 0x66, 0x41, 0x0F, 0xEF, 0xF0, 0x66, 0x44, 0x0F, 0x6F, 0xC1,
+  0x66, 0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x01, 0x66, 0x41, 0x0F, 0xEF, 0xF8, 0x66, 0x41, 0x0F, 0x3A,
+  0x44, 0xC9, 0x10, 0x66, 0x0F, 0xEF, 0xF9, 0xF3, 0x44, 0x0F, 0x6F, 0x4F, 0x40, 0x66, 0x44, 0x0F,
+  0x6F, 0xC2, 0x66, 0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xE8, 0x66, 0x44,
+  0x0F, 0x6F, 0xC2, 0x66, 0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x11, 0x66, 0x41, 0x0F, 0xEF, 0xF0, 0x66,
+  0x44, 0x0F, 0x6F, 0xC2, 0x66, 0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x01, 0x66, 0x41, 0x0F, 0xEF, 0xF8,
+  0x66, 0x41, 0x0F, 0x3A, 0x44, 0xD1, 0x10, 0x66, 0x0F, 0xEF, 0xFA, 0xF3, 0x44, 0x0F, 0x6F, 0x4F,
+  0x30, 0x66, 0x44, 0x0F, 0x6F, 0xC3, 0x66, 0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x00, 0x66, 0x41, 0x0F,
+  0xEF, 0xE8, 0x66, 0x44, 0x0F, 0x6F, 0xC3, 0x66, 0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x11, 0x66, 0x41,
+  0x0F, 0xEF, 0xF0, 0x66, 0x44, 0x0F, 0x6F, 0xC3, 0x66, 0x45, 0x0F, 0x3A, 0x44, 0xC1, 0x01, 0x66,
+  0x41, 0x0F, 0xEF, 0xF8, 0x66, 0x41, 0x0F, 0x3A, 0x44, 0xD9, 0x10, 0x66, 0x0F, 0xEF, 0xFB, 0xE9,
+  0x6F, 0xFD, 0xFF, 0xFF, 0x48, 0x83, 0xEC, 0x18, 0x49, 0x89, 0xCB, 0x4C, 0x8B, 0x47, 0x10, 0x4C,
+  0x8B, 0x4F, 0x18, 0x48, 0xB8, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x08, 0x66, 0x4C, 0x0F,
+  0x6E, 0xF8, 0x48, 0xB8, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x66, 0x4C, 0x0F, 0x3A,
+  0x22, 0xF8, 0x01, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x6E, 0xE0, 0x66, 0x45, 0x0F,
+  0xEF, 0xF6, 0xF3, 0x44, 0x0F, 0x7E, 0x6F, 0x20, 0x66, 0x44, 0x0F, 0x3A, 0x22, 0x6F, 0x28, 0x02,
+  0xB8, 0x00, 0x00, 0x00, 0x01, 0x66, 0x44, 0x0F, 0x3A, 0x22, 0xE8, 0x03, 0x66, 0x41, 0x0F, 0x6F,
+  0xC5, 0xE8, 0x8F, 0xFC, 0xFF, 0xFF, 0x66, 0x44, 0x0F, 0x6F, 0xD8, 0x66, 0x45, 0x0F, 0x38, 0x00,
+  0xEF, 0x66, 0x45, 0x0F, 0xFE, 0xEC, 0x48, 0x8B, 0x4F, 0x08, 0x48, 0x83, 0xF9, 0x10, 0x72, 0x12,
+  0x4D, 0x89, 0xDA, 0xE8, 0x15, 0xFE, 0xFF, 0xFF, 0x49, 0x83, 0xC3, 0x10, 0x48, 0x83, 0xE9, 0x10,
+  0xEB, 0xE8, 0x48, 0x85, 0xC9, 0x74, 0x23, 0x66, 0x0F, 0xEF, 0xC0, 0xF3, 0x0F, 0x7F, 0x04, 0x24,
+  0x31, 0xC0, 0x45, 0x8A, 0x14, 0x03, 0x44, 0x88, 0x14, 0x04, 0x48, 0xFF, 0xC0, 0x48, 0x39, 0xC8,
+  0x72, 0xF0, 0x49, 0x89, 0xE2, 0xE8, 0xE3, 0xFD, 0xFF, 0xFF, 0x48, 0x8B, 0x0F, 0x48, 0x83, 0xBF,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x85, 0x4E, 0x01, 0x00, 0x00, 0x48, 0x83, 0xF9, 0x40, 0x0F,
+  0x82, 0x94, 0x00, 0x00, 0x00, 0x66, 0x41, 0x0F, 0x6F, 0xC5, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xC7,
+  0x66, 0x45, 0x0F, 0xFE, 0xEC, 0x66, 0x41, 0x0F, 0x6F, 0xCD, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xCF,
+  0x66, 0x45, 0x0F, 0xFE, 0xEC, 0x66, 0x41, 0x0F, 0x6F, 0xD5, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xD7,
+  0x66, 0x45, 0x0F, 0xFE, 0xEC, 0x66, 0x41, 0x0F, 0x6F, 0xDD, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xDF,
+  0x66, 0x45, 0x0F, 0xFE, 0xEC, 0xE8, 0x05, 0xFC, 0xFF, 0xFF, 0xF3, 0x0F, 0x6F, 0x26, 0x66, 0x0F,
+  0xEF, 0xC4, 0xF3, 0x0F, 0x7F, 0x02, 0xF3, 0x0F, 0x6F, 0x66, 0x10, 0x66, 0x0F, 0xEF, 0xCC, 0xF3,
+  0x0F, 0x7F, 0x4A, 0x10, 0xF3, 0x0F, 0x6F, 0x66, 0x20, 0x66, 0x0F, 0xEF, 0xD4, 0xF3, 0x0F, 0x7F,
+  0x52, 0x20, 0xF3, 0x0F, 0x6F, 0x66, 0x30, 0x66, 0x0F, 0xEF, 0xDC, 0xF3, 0x0F, 0x7F, 0x5A, 0x30,
+  0x49, 0x89, 0xD2, 0xE8, 0x57, 0xFD, 0xFF, 0xFF, 0x48, 0x83, 0xC6, 0x40, 0x48, 0x83, 0xC2, 0x40,
+  0x48, 0x83, 0xE9, 0x40, 0xE9, 0x62, 0xFF, 0xFF, 0xFF, 0x48, 0x83, 0xF9, 0x10, 0x72, 0x37, 0x66,
+  0x41, 0x0F, 0x6F, 0xC5, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xC7, 0x66, 0x45, 0x0F, 0xFE, 0xEC, 0xE8,
+  0x71, 0xFB, 0xFF, 0xFF, 0xF3, 0x0F, 0x6F, 0x26, 0x66, 0x0F, 0xEF, 0xC4, 0xF3, 0x0F, 0x7F, 0x02,
+  0x49, 0x89, 0xD2, 0xE8, 0x05, 0xFD, 0xFF, 0xFF, 0x48, 0x83, 0xC6, 0x10, 0x48, 0x83, 0xC2, 0x10,
+  0x48, 0x83, 0xE9, 0x10, 0xEB, 0xC3, 0x48, 0x85, 0xC9, 0x0F, 0x84, 0xA2, 0x01, 0x00, 0x00, 0x66,
+  0x0F, 0xEF, 0xC0, 0xF3, 0x0F, 0x7F, 0x04, 0x24, 0x31, 0xC0, 0x44, 0x8A, 0x14, 0x06, 0x44, 0x88,
+  0x14, 0x04, 0x48, 0xFF, 0xC0, 0x48, 0x39, 0xC8, 0x72, 0xF0, 0x66, 0x41, 0x0F, 0x6F, 0xC5, 0x66,
+  0x41, 0x0F, 0x38, 0x00, 0xC7, 0x66, 0x45, 0x0F, 0xFE, 0xEC, 0xE8, 0x16, 0xFB, 0xFF, 0xFF, 0xF3,
+  0x0F, 0x6F, 0x24, 0x24, 0x66, 0x0F, 0xEF, 0xC4, 0xF3, 0x0F, 0x7F, 0x04, 0x24, 0x31, 0xC0, 0x44,
+  0x8A, 0x14, 0x04, 0x44, 0x88, 0x14, 0x02, 0x48, 0xFF, 0xC0, 0x48, 0x39, 0xC8, 0x72, 0xF0, 0xC6,
+  0x04, 0x04, 0x00, 0x48, 0xFF, 0xC0, 0x48, 0x83, 0xF8, 0x10, 0x72, 0xF3, 0x49, 0x89, 0xE2, 0xE8,
+  0x89, 0xFC, 0xFF, 0xFF, 0xE9, 0x38, 0x01, 0x00, 0x00, 0x48, 0x83, 0xF9, 0x40, 0x0F, 0x82, 0x94,
+  0x00, 0x00, 0x00, 0x49, 0x89, 0xF2, 0xE8, 0x84, 0xFC, 0xFF, 0xFF, 0x66, 0x41, 0x0F, 0x6F, 0xC5,
+  0x66, 0x41, 0x0F, 0x38, 0x00, 0xC7, 0x66, 0x45, 0x0F, 0xFE, 0xEC, 0x66, 0x41, 0x0F, 0x6F, 0xCD,
+  0x66, 0x41, 0x0F, 0x38, 0x00, 0xCF, 0x66, 0x45, 0x0F, 0xFE, 0xEC, 0x66, 0x41, 0x0F, 0x6F, 0xD5,
+  0x66, 0x41, 0x0F, 0x38, 0x00, 0xD7, 0x66, 0x45, 0x0F, 0xFE, 0xEC, 0x66, 0x41, 0x0F, 0x6F, 0xDD,
+  0x66, 0x41, 0x0F, 0x38, 0x00, 0xDF, 0x66, 0x45, 0x0F, 0xFE, 0xEC, 0xE8, 0xAF, 0xFA, 0xFF, 0xFF,
+  0xF3, 0x0F, 0x6F, 0x26, 0x66, 0x0F, 0xEF, 0xC4, 0xF3, 0x0F, 0x7F, 0x02, 0xF3, 0x0F, 0x6F, 0x66,
+  0x10, 0x66, 0x0F, 0xEF, 0xCC, 0xF3, 0x0F, 0x7F, 0x4A, 0x10, 0xF3, 0x0F, 0x6F, 0x66, 0x20, 0x66,
+  0x0F, 0xEF, 0xD4, 0xF3, 0x0F, 0x7F, 0x52, 0x20, 0xF3, 0x0F, 0x6F, 0x66, 0x30, 0x66, 0x0F, 0xEF,
+  0xDC, 0xF3, 0x0F, 0x7F, 0x5A, 0x30, 0x48, 0x83, 0xC6, 0x40, 0x48, 0x83, 0xC2, 0x40, 0x48, 0x83,
+  0xE9, 0x40, 0xE9, 0x62, 0xFF, 0xFF, 0xFF, 0x48, 0x83, 0xF9, 0x10, 0x72, 0x37, 0x49, 0x89, 0xF2,
+  0xE8, 0xD8, 0xFB, 0xFF, 0xFF, 0x66, 0x41, 0x0F, 0x6F, 0xC5, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xC7,
+  0x66, 0x45, 0x0F, 0xFE, 0xEC, 0xE8, 0x1B, 0xFA, 0xFF, 0xFF, 0xF3, 0x0F, 0x6F, 0x26, 0x66, 0x0F,
+  0xEF, 0xC4, 0xF3, 0x0F, 0x7F, 0x02, 0x48, 0x83, 0xC6, 0x10, 0x48, 0x83, 0xC2, 0x10, 0x48, 0x83,
+  0xE9, 0x10, 0xEB, 0xC3, 0x48, 0x85, 0xC9, 0x74, 0x58, 0x66, 0x0F, 0xEF, 0xC0, 0xF3, 0x0F, 0x7F,
+  0x04, 0x24, 0x31, 0xC0, 0x44, 0x8A, 0x14, 0x06, 0x44, 0x88, 0x14, 0x04, 0x48, 0xFF, 0xC0, 0x48,
+  0x39, 0xC8, 0x72, 0xF0, 0x49, 0x89, 0xE2, 0xE8, 0x81, 0xFB, 0xFF, 0xFF, 0x66, 0x41, 0x0F, 0x6F,
+  0xC5, 0x66, 0x41, 0x0F, 0x38, 0x00, 0xC7, 0x66, 0x45, 0x0F, 0xFE, 0xEC, 0xE8, 0xC4, 0xF9, 0xFF,
+  0xFF, 0xF3, 0x0F, 0x6F, 0x24, 0x24, 0x66, 0x0F, 0xEF, 0xC4, 0xF3, 0x0F, 0x7F, 0x04, 0x24, 0x31,
+  0xC0, 0x44, 0x8A, 0x14, 0x04, 0x44, 0x88, 0x14, 0x02, 0x48, 0xFF, 0xC0, 0x48, 0x39, 0xC8, 0x72,
+  0xF0, 0x48, 0x8B, 0x47, 0x08, 0x48, 0xC1, 0xE0, 0x03, 0x48, 0x0F, 0xC8, 0x48, 0x89, 0x04, 0x24,
+  0x48, 0x8B, 0x07, 0x48, 0xC1, 0xE0, 0x03, 0x48, 0x0F, 0xC8, 0x48, 0x89, 0x44, 0x24, 0x08, 0x49,
+  0x89, 0xE2, 0xE8, 0x26, 0xFB, 0xFF, 0xFF, 0x66, 0x45, 0x0F, 0x38, 0x00, 0xF7, 0x66, 0x45, 0x0F,
+  0xEF, 0xF3, 0xF3, 0x44, 0x0F, 0x7F, 0x77, 0x70, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0xEB, 0x52, 0x66,
+  0x0F, 0x70, 0xD2, 0xFF, 0x66, 0x0F, 0x6F, 0xE1, 0x66, 0x0F, 0x73, 0xFC, 0x04, 0x66, 0x0F, 0xEF,
+  0xCC, 0x66, 0x0F, 0x73, 0xFC, 0x04, 0x66, 0x0F, 0xEF, 0xCC, 0x66, 0x0F, 0x73, 0xFC, 0x04, 0x66,
+  0x0F, 0xEF, 0xCC, 0x66, 0x0F, 0xEF, 0xCA, 0xC3, 0x66, 0x0F, 0x70, 0xD2, 0xAA, 0x66, 0x0F, 0x6F,
+  0xE3, 0x66, 0x0F, 0x73, 0xFC, 0x04, 0x66, 0x0F, 0xEF, 0xDC, 0x66, 0x0F, 0x73, 0xFC, 0x04, 0x66,
+  0x0F, 0xEF, 0xDC, 0x66, 0x0F, 0x73, 0xFC, 0x04, 0x66, 0x0F, 0xEF, 0xDC, 0x66, 0x0F, 0xEF, 0xDA,
+  0xC3, 0xF3, 0x0F, 0x6F, 0x0E, 0xF3, 0x0F, 0x7F, 0x8F, 0x90, 0x00, 0x00, 0x00, 0x48, 0x83, 0x3F,
+  0x20, 0x0F, 0x84, 0xC3, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x01, 0xE8, 0x8D, 0xFF,
+  0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x02,
+  0xE8, 0x7A, 0xFF, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A,
+  0xDF, 0xD1, 0x04, 0xE8, 0x67, 0xFF, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0xC0, 0x00, 0x00, 0x00,
+  0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x08, 0xE8, 0x54, 0xFF, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0xD0,
+  0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x10, 0xE8, 0x41, 0xFF, 0xFF, 0xFF, 0xF3, 0x0F,
+  0x7F, 0x8F, 0xE0, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x20, 0xE8, 0x2E, 0xFF, 0xFF,
+  0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x40, 0xE8,
+  0x1B, 0xFF, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0x00, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF,
+  0xD1, 0x80, 0xE8, 0x08, 0xFF, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0x10, 0x01, 0x00, 0x00, 0x66,
+  0x0F, 0x3A, 0xDF, 0xD1, 0x1B, 0xE8, 0xF5, 0xFE, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0x20, 0x01,
+  0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x36, 0xE8, 0xE2, 0xFE, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F,
+  0x8F, 0x30, 0x01, 0x00, 0x00, 0xE9, 0x04, 0x01, 0x00, 0x00, 0xF3, 0x0F, 0x6F, 0x5E, 0x10, 0xF3,
+  0x0F, 0x7F, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD3, 0x01, 0xE8, 0xBD, 0xFE,
+  0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x00,
+  0xE8, 0xD3, 0xFE, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x9F, 0xC0, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A,
+  0xDF, 0xD3, 0x02, 0xE8, 0x97, 0xFE, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0xD0, 0x00, 0x00, 0x00,
+  0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x00, 0xE8, 0xAD, 0xFE, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x9F, 0xE0,
+  0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD3, 0x04, 0xE8, 0x71, 0xFE, 0xFF, 0xFF, 0xF3, 0x0F,
+  0x7F, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x00, 0xE8, 0x87, 0xFE, 0xFF,
+  0xFF, 0xF3, 0x0F, 0x7F, 0x9F, 0x00, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD3, 0x08, 0xE8,
+  0x4B, 0xFE, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0x10, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF,
+  0xD1, 0x00, 0xE8, 0x61, 0xFE, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x9F, 0x20, 0x01, 0x00, 0x00, 0x66,
+  0x0F, 0x3A, 0xDF, 0xD3, 0x10, 0xE8, 0x25, 0xFE, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0x30, 0x01,
+  0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x00, 0xE8, 0x3B, 0xFE, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F,
+  0x9F, 0x40, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD3, 0x20, 0xE8, 0xFF, 0xFD, 0xFF, 0xFF,
+  0xF3, 0x0F, 0x7F, 0x8F, 0x50, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD1, 0x00, 0xE8, 0x15,
+  0xFE, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x9F, 0x60, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x3A, 0xDF, 0xD3,
+  0x40, 0xE8, 0xD9, 0xFD, 0xFF, 0xFF, 0xF3, 0x0F, 0x7F, 0x8F, 0x70, 0x01, 0x00, 0x00, 0x4C, 0x8B,
+  0x47, 0x10, 0x4C, 0x8B, 0x4F, 0x18, 0x48, 0xB8, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x08,
+  0x66, 0x4C, 0x0F, 0x6E, 0xF8, 0x48, 0xB8, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x66,
+  0x4C, 0x0F, 0x3A, 0x22, 0xF8, 0x01, 0x66, 0x0F, 0xEF, 0xC0, 0xE8, 0x06, 0xF7, 0xFF, 0xFF, 0x66,
+  0x41, 0x0F, 0x38, 0x00, 0xC7, 0xF3, 0x0F, 0x7F, 0x47, 0x30, 0xE8, 0x49, 0xF8, 0xFF, 0xFF, 0xF3,
+  0x44, 0x0F, 0x7F, 0x77, 0x40, 0x66, 0x41, 0x0F, 0x6F, 0xC6, 0xE8, 0x39, 0xF8, 0xFF, 0xFF, 0xF3,
+  0x44, 0x0F, 0x7F, 0x77, 0x50, 0x66, 0x41, 0x0F, 0x6F, 0xC6, 0xE8, 0x29, 0xF8, 0xFF, 0xFF, 0xF3,
+  0x44, 0x0F, 0x7F, 0x77, 0x60, 0xC3,
+];
+
+/// Offset da entrada `gcm_init` dentro de [kAesGcmFusedShellcode].
+const int kAesGcmFusedInitOffset = 0x69D;
@@ -0,0 +1,296 @@
+// dart format width=5000
+//
+// ChaCha20-Poly1305 com kernel nativo x86_64 (asm/chacha20_poly1305_x86_64.S)
+//
+// - ChaCha20 vertical: 4 blocos por passada com SSSE3, 8 com AVX2
+// - Poly1305 escalar em base 2^64 (mul 64x64->128, 5 multiplicações/bloco)
+// - Um registro inteiro (chave de uso único, XOR, MAC do AAD e do
+//   ciphertext, tag) por chamada FFI, lendo e escrevendo direto nos
+//   [Uint8List] do Dart (chamadas leaf)
+//
+// Referência: RFC 8439, OpenSSL chacha-x86_64.pl / poly1305-x86_64.pl
+
+import 'dart:ffi' as ffi;
+import 'dart:io' show Platform;
+import 'dart:typed_data';
+
+import 'package:ffi/ffi.dart' as pkgffi;
+
+import '../utils/chacha20_poly1305.dart';
+import '../utils/constanttime.dart';
+import 'chacha20_poly1305_shellcode_x86_64.dart';
+import 'rijndael_fast_asm_x86_64.dart' show ExecutableMemory;
+import 'win64_thunk_x86_64.dart';
+
+/// Verifica SSSE3 (pshufb, caminho de 4 blocos) e AVX2 (caminho de 8 blocos)
+class ChaCha20Poly1305AsmSupport {
+  static int? _features;
+
+  /// Retorna true se o kernel pode rodar (SSSE3 disponível)
+  static bool get isSupported => _cpuFeatures() & 1 != 0;
+
+  /// Retorna true se o caminho AVX2 de 8 blocos pode ser usado
+  static bool get isAvx2Supported => _cpuFeatures() & 2 != 0;
+
+  static int _cpuFeatures() {
+    _features ??= _checkSupport();
+    return _features!;
+  }
+
+  static int _checkSupport() {
+    if (!Platform.isWindows && !Platform.isLinux) {
+      return 0;
+    }
+    try {
+      return _executeCpuidCheck();
+    } catch (e) {
+      return 0;
+    }
+  }
+
+  /// CPUID: bit 0 = SSSE3 (CPUID.01H:ECX[9]); bit 1 = AVX2
+  /// (CPUID.07H:EBX[5], com OSXSAVE/AVX e XCR0 habilitando o estado YMM).
+  /// Só usa registradores voláteis nas duas ABIs além de rbx, que é salvo.
+  static int _executeCpuidCheck() {
+    final cpuidCode = Uint8List.fromList([
+      0x53, // push rbx
+      0xB8, 0x01, 0x00, 0x00, 0x00, // mov eax, 1
+      0x0F, 0xA2, // cpuid
+      0x41, 0x89, 0xC8, // mov r8d, ecx
+      0x41, 0xC1, 0xE8, 0x09, // shr r8d, 9
+      0x41, 0x83, 0xE0, 0x01, // and r8d, 1 (SSSE3)
+      0x81, 0xE1, 0x00, 0x00, 0x00, 0x18, // and ecx, 0x18000000 (OSXSAVE|AVX)
+      0x81, 0xF9, 0x00, 0x00, 0x00, 0x18, // cmp ecx, 0x18000000
+      0x75, 0x1F, // jne fim
+      0x31, 0xC9, // xor ecx, ecx
+      0x0F, 0x01, 0xD0, // xgetbv
+      0x83, 0xE0, 0x06, // and eax, 6 (XMM|YMM)
+      0x83, 0xF8, 0x06, // cmp eax, 6
+      0x75, 0x12, // jne fim
+      0xB8, 0x07, 0x00, 0x00, 0x00, // mov eax, 7
+      0x31, 0xC9, // xor ecx, ecx
+      0x0F, 0xA2, // cpuid
+      0xC1, 0xEB, 0x04, // shr ebx, 4
+      0x83, 0xE3, 0x02, // and ebx, 2 (AVX2)
+      0x41, 0x09, 0xD8, // or r8d, ebx
+      0x44, 0x89, 0xC0, // fim: mov eax, r8d
+      0x5B, // pop rbx
+      0xC3, // ret
+    ]);
+
+    final execMem = ExecutableMemory.allocate(cpuidCode);
+    try {
+      final func = execMem.pointer.cast<ffi.NativeFunction<ffi.Int32 Function()>>().asFunction<int Function()>();
+      return func();
+    } finally {
+      execMem.free();
+    }
+  }
+}
+
+/// Assinatura nativa de `chacha20_poly1305(params, in, out, aad)`
+typedef ChaChaPolyNativeFunc = ffi.Void Function(ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>);
+typedef ChaChaPolyDartFunc = void Function(ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>);
+
+/// Assinatura nativa de `chacha20_xor(params, in, out)`
+typedef ChaChaXorNativeFunc = ffi.Void Function(ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>);
+typedef ChaChaXorDartFunc = void Function(ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>);
+
+/// Kernel ChaCha20-Poly1305 fundido
+///
+/// O shellcode é compartilhado por todas as instâncias; cada instância tem
+/// só o seu bloco de parâmetros nativo (chave, nonce, tag, estado do MAC),
+/// liberado por [dispose] ou, se ninguém chamar, quando a instância é
+/// coletada (as conexões TLS não chamam dispose nos ciphers).
+class ChaCha20Poly1305Kernel {
+  static const int _offKey = 0;
+  static const int _offNonce = 32;
+  static const int _offCounter = 44;
+  static const int _offLength = 48;
+  static const int _offAadLength = 56;
+  static const int _offTag = 64;
+  static const int _offDecrypt = 80;
+  static const int _offAvx2 = 88;
+  static const int _paramsSize = 160;
+
+  static ExecutableMemory? _code;
+  static ChaChaXorDartFunc? _xorFunc;
+  static ChaChaPolyDartFunc? _aeadFunc;
+
+  static final Finalizer<ffi.Pointer<ffi.Uint8>> _finalizer = Finalizer(_releaseParams);
+
+  final ffi.Pointer<ffi.Uint8> _params;
+  bool _disposed = false;
+
+  /// Verdadeiro quando o kernel pode rodar nesta CPU
+  static bool get isSupported => ChaCha20Poly1305AsmSupport.isSupported;
+
+  /// Prepara o kernel para [key] (32 bytes). Com [useAvx2] nulo, o caminho
+  /// de 8 blocos é usado quando a CPU suporta AVX2.
+  ChaCha20Poly1305Kernel(Uint8List key, {bool? useAvx2}) : _params = pkgffi.calloc<ffi.Uint8>(_paramsSize) {
+    if (key.length != 32) {
+      pkgffi.calloc.free(_params);
+      throw ArgumentError('ChaCha20-Poly1305 key must be 32 bytes long');
+    }
+    if (!isSupported) {
+      pkgffi.calloc.free(_params);
+      throw UnsupportedError('SSSE3 não suportado nesta plataforma');
+    }
+    final avx2 = useAvx2 ?? ChaCha20Poly1305AsmSupport.isAvx2Supported;
+    if (avx2 && !ChaCha20Poly1305AsmSupport.isAvx2Supported) {
+      pkgffi.calloc.free(_params);
+      throw UnsupportedError('AVX2 não suportado nesta plataforma');
+    }
+    _ensureCode();
+    for (int i = 0; i < 32; i++) {
+      _params[_offKey + i] = key[i];
+    }
+    _params.cast<ffi.Uint64>()[_offAvx2 ~/ 8] = avx2 ? 1 : 0;
+    _finalizer.attach(this, _params, detach: this);
+  }
+
+  /// Apaga a chave antes de devolver o bloco de parâmetros
+  static void _releaseParams(ffi.Pointer<ffi.Uint8> params) {
+    for (int i = 0; i < _paramsSize; i++) {
+      params[i] = 0;
+    }
+    pkgffi.calloc.free(params);
+  }
+
+  static void _ensureCode() {
+    if (_code != null) return;
+    final int xorEntry;
+    final int aeadEntry;
+    if (Platform.isWindows) {
+      // [thunk xor][thunk aead][corpo System V]
+      const bodyStart = 2 * kWindowsThunkSize;
+      _code = ExecutableMemory.allocate(Uint8List.fromList([
+        ...windowsSysVThunk(bodyStart - kWindowsThunkCallEnd),
+        ...windowsSysVThunk(bodyStart - kWindowsThunkSize + kChaCha20Poly1305AeadOffset - kWindowsThunkCallEnd),
+        ...kChaCha20Poly1305Shellcode,
+      ]));
+      xorEntry = 0;
+      aeadEntry = kWindowsThunkSize;
+    } else {
+      _code = ExecutableMemory.allocate(Uint8List.fromList(kChaCha20Poly1305Shellcode));
+      xorEntry = 0;
+      aeadEntry = kChaCha20Poly1305AeadOffset;
+    }
+    _xorFunc = (_code!.pointer.cast<ffi.Uint8>() + xorEntry)
+        .cast<ffi.NativeFunction<ChaChaXorNativeFunc>>()
+        .asFunction<ChaChaXorDartFunc>(isLeaf: true);
+    _aeadFunc = (_code!.pointer.cast<ffi.Uint8>() + aeadEntry)
+        .cast<ffi.NativeFunction<ChaChaPolyNativeFunc>>()
+        .asFunction<ChaChaPolyDartFunc>(isLeaf: true);
+  }
+
+  void _setup(Uint8List nonce, int counter, int length) {
+    if (_disposed) {
+      throw StateError('ChaCha20Poly1305Kernel já foi liberado (dispose)');
+    }
+    for (int i = 0; i < 12; i++) {
+      _params[_offNonce + i] = nonce[i];
+    }
+    _params.cast<ffi.Uint32>()[_offCounter ~/ 4] = counter;
+    _params.cast<ffi.Uint64>()[_offLength ~/ 8] = length;
+  }
+
+  /// XOR de [input] com o keystream ChaCha20 a partir do bloco [counter],
+  /// escrito em `output[outOffset:]` ([input] pode ser a mesma região)
+  void xorKeyStream(Uint8List nonce, int counter, Uint8List input, Uint8List output, int outOffset) {
+    _setup(nonce, counter, input.length);
+    final out = Uint8List.sublistView(output, outOffset, outOffset + input.length);
+    _xorFunc!(_params, input.address, out.address);
+  }
+
+  void _run(Uint8List nonce, Uint8List input, Uint8List out, Uint8List aad, bool decrypt) {
+    _setup(nonce, 1, input.length);
+    final params = _params.cast<ffi.Uint64>();
+    params[_offAadLength ~/ 8] = aad.length;
+    params[_offDecrypt ~/ 8] = decrypt ? 1 : 0;
+    _aeadFunc!(_params, input.address, out.address, aad.address);
+  }
+
+  /// Encripta [plaintext] em `output[outOffset:]` e escreve a tag logo em
+  /// seguida. [output] deve ter espaço para `plaintext.length + 16` bytes.
+  void seal(Uint8List nonce, Uint8List plaintext, Uint8List aad, Uint8List output, int outOffset) {
+    final out = Uint8List.sublistView(output, outOffset, outOffset + plaintext.length);
+    _run(nonce, plaintext, out, aad, false);
+    final tagOffset = outOffset + plaintext.length;
+    for (int i = 0; i < 16; i++) {
+      output[tagOffset + i] = _params[_offTag + i];
+    }
+  }
+
+  /// Confere [tag] e decripta [ciphertext] no próprio buffer. O MAC é
+  /// calculado antes do XOR, então se a tag não confere basta desfazer o
+  /// XOR para devolver o ciphertext original; o resultado é `false`.
+  bool openInPlace(Uint8List nonce, Uint8List ciphertext, Uint8List tag, Uint8List aad) {
+    _run(nonce, ciphertext, ciphertext, aad, true);
+    final expected = Uint8List(16);
+    for (int i = 0; i < 16; i++) {
+      expected[i] = _params[_offTag + i];
+    }
+    if (!ctCompareDigest(expected, tag)) {
+      xorKeyStream(nonce, 1, ciphertext, ciphertext, 0);
+      return false;
+    }
+    return true;
+  }
+
+  /// Apaga a chave e libera o bloco de parâmetros (o shellcode é global)
+  void dispose() {
+    if (_disposed) return;
+    _finalizer.detach(this);
+    _releaseParams(_params);
+    _disposed = true;
+  }
+}
+
+/// [Chacha20Poly1305] com seal/open no [ChaCha20Poly1305Kernel]
+///
+/// Mesma API e mesmos resultados da versão Dart; selecionado por
+/// `createCHACHA20(key, implementations: ['asm-x86_64', ...])`.
+class Chacha20Poly1305Asm extends Chacha20Poly1305 {
+  final ChaCha20Poly1305Kernel _kernel;
+
+  /// Verdadeiro quando o kernel nativo pode rodar nesta CPU
+  static bool get isSupported => ChaCha20Poly1305Kernel.isSupported;
+
+  Chacha20Poly1305Asm(Uint8List key, {bool? useAvx2})
+      : _kernel = ChaCha20Poly1305Kernel(key, useAvx2: useAvx2),
+        super.withBackend(key, 'asm-x86_64');
+
+  @override
+  int sealInto(Uint8List nonce, Uint8List plaintext, Uint8List associatedData, Uint8List out, int outOffset) {
+    if (nonce.length != nonceLength) {
+      throw ArgumentError('Nonce must be $nonceLength bytes long');
+    }
+    final length = plaintext.length;
+    if (outOffset < 0 || out.length - outOffset < length + tagLength) {
+      throw ArgumentError('Output buffer too small');
+    }
+    _kernel.seal(nonce, plaintext, associatedData, out, outOffset);
+    return length + tagLength;
+  }
+
+  @override
+  Uint8List? openInPlace(Uint8List nonce, Uint8List ciphertextWithTag, Uint8List associatedData) {
+    if (nonce.length != nonceLength) {
+      throw ArgumentError('Nonce must be $nonceLength bytes long');
+    }
+    if (ciphertextWithTag.length < tagLength) {
+      return null;
+    }
+    final length = ciphertextWithTag.length - tagLength;
+    final ciphertext = Uint8List.sublistView(ciphertextWithTag, 0, length);
+    final tag = Uint8List.sublistView(ciphertextWithTag, length);
+    if (!_kernel.openInPlace(nonce, ciphertext, tag, associatedData)) {
+      return null;
+    }
+    return ciphertext;
+  }
+
+  /// Libera a memória nativa do kernel
+  void dispose() => _kernel.dispose();
+}
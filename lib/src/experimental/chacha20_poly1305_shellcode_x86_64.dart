@@ -0,0 +1,368 @@
+// dart format width=5000
+// AUTO-GENERATED - DO NOT EDIT
+// Shellcode montado de asm/chacha20_poly1305_x86_64.S
+//   as --64 -o chacha20_poly1305_x86_64.o chacha20_poly1305_x86_64.S
+//   objcopy -O binary -j .text chacha20_poly1305_x86_64.o chacha20_poly1305_x86_64.bin
+// Tamanho: 5635 bytes
+
+/// Shellcode x86_64 (System V) com as entradas `chacha20_xor` (offset 0) e
+/// `chacha20_poly1305` (offset [kChaCha20Poly1305AeadOffset]).
+const List<int> kChaCha20Poly1305Shellcode = [
+  0x48, 0x8B, 0x4F, 0x30, 0x44, 0x8B, 0x47, 0x2C, 0xEB, 0x05, 0xE9, 0x69, 0x14, 0x00, 0x00, 0x48,
+  0x83, 0x7F, 0x58, 0x00, 0x0F, 0x85, 0xC0, 0x09, 0x00, 0x00, 0x55, 0x48, 0x89, 0xE5, 0x48, 0x81,
+  0xEC, 0x80, 0x03, 0x00, 0x00, 0x48, 0x83, 0xE4, 0xC0, 0xB8, 0x65, 0x78, 0x70, 0x61, 0x66, 0x0F,
+  0x6E, 0xC0, 0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x04, 0x24, 0xB8, 0x6E, 0x64, 0x20,
+  0x33, 0x66, 0x0F, 0x6E, 0xC0, 0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x44, 0x24, 0x10,
+  0xB8, 0x32, 0x2D, 0x62, 0x79, 0x66, 0x0F, 0x6E, 0xC0, 0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F,
+  0x7F, 0x44, 0x24, 0x20, 0xB8, 0x74, 0x65, 0x20, 0x6B, 0x66, 0x0F, 0x6E, 0xC0, 0x66, 0x0F, 0x70,
+  0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x44, 0x24, 0x30, 0x66, 0x0F, 0x6E, 0x07, 0x66, 0x0F, 0x70, 0xC0,
+  0x00, 0x66, 0x0F, 0x7F, 0x44, 0x24, 0x40, 0x66, 0x0F, 0x6E, 0x47, 0x04, 0x66, 0x0F, 0x70, 0xC0,
+  0x00, 0x66, 0x0F, 0x7F, 0x44, 0x24, 0x50, 0x66, 0x0F, 0x6E, 0x47, 0x08, 0x66, 0x0F, 0x70, 0xC0,
+  0x00, 0x66, 0x0F, 0x7F, 0x44, 0x24, 0x60, 0x66, 0x0F, 0x6E, 0x47, 0x0C, 0x66, 0x0F, 0x70, 0xC0,
+  0x00, 0x66, 0x0F, 0x7F, 0x44, 0x24, 0x70, 0x66, 0x0F, 0x6E, 0x47, 0x10, 0x66, 0x0F, 0x70, 0xC0,
+  0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x6E, 0x47, 0x14, 0x66,
+  0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0x90, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x6E,
+  0x47, 0x18, 0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0xA0, 0x00, 0x00, 0x00,
+  0x66, 0x0F, 0x6E, 0x47, 0x1C, 0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0xB0,
+  0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x84,
+  0x24, 0x64, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x68, 0x03, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0x6C, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66,
+  0x41, 0x0F, 0x6E, 0xC0, 0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0xFE, 0x84, 0x24, 0x60, 0x03,
+  0x00, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0xC0, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x6E, 0x47, 0x20,
+  0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0xD0, 0x00, 0x00, 0x00, 0x66, 0x0F,
+  0x6E, 0x47, 0x24, 0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0xE0, 0x00, 0x00,
+  0x00, 0x66, 0x0F, 0x6E, 0x47, 0x28, 0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24,
+  0xF0, 0x00, 0x00, 0x00, 0xB8, 0x04, 0x00, 0x00, 0x00, 0x66, 0x0F, 0x6E, 0xC0, 0x66, 0x0F, 0x70,
+  0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0x60, 0x03, 0x00, 0x00, 0x48, 0xB8, 0x02, 0x03, 0x00,
+  0x01, 0x06, 0x07, 0x04, 0x05, 0x48, 0x89, 0x84, 0x24, 0x40, 0x03, 0x00, 0x00, 0x48, 0xB8, 0x0A,
+  0x0B, 0x08, 0x09, 0x0E, 0x0F, 0x0C, 0x0D, 0x48, 0x89, 0x84, 0x24, 0x48, 0x03, 0x00, 0x00, 0x48,
+  0xB8, 0x03, 0x00, 0x01, 0x02, 0x07, 0x04, 0x05, 0x06, 0x48, 0x89, 0x84, 0x24, 0x50, 0x03, 0x00,
+  0x00, 0x48, 0xB8, 0x0B, 0x08, 0x09, 0x0A, 0x0F, 0x0C, 0x0D, 0x0E, 0x48, 0x89, 0x84, 0x24, 0x58,
+  0x03, 0x00, 0x00, 0x48, 0x85, 0xC9, 0x0F, 0x84, 0x9B, 0x07, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x04,
+  0x24, 0x66, 0x0F, 0x6F, 0x4C, 0x24, 0x10, 0x66, 0x0F, 0x6F, 0x54, 0x24, 0x20, 0x66, 0x0F, 0x6F,
+  0x5C, 0x24, 0x30, 0x66, 0x0F, 0x6F, 0x64, 0x24, 0x40, 0x66, 0x0F, 0x6F, 0x6C, 0x24, 0x50, 0x66,
+  0x0F, 0x6F, 0x74, 0x24, 0x60, 0x66, 0x0F, 0x6F, 0x7C, 0x24, 0x70, 0x66, 0x44, 0x0F, 0x6F, 0xA4,
+  0x24, 0x80, 0x00, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x00, 0x01, 0x00, 0x00, 0x66,
+  0x44, 0x0F, 0x6F, 0xA4, 0x24, 0x90, 0x00, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x10,
+  0x01, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x6F, 0xA4, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x66, 0x44, 0x0F,
+  0x7F, 0xA4, 0x24, 0x20, 0x01, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x6F, 0xA4, 0x24, 0xB0, 0x00, 0x00,
+  0x00, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x30, 0x01, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x6F, 0x84,
+  0x24, 0xC0, 0x00, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x6F, 0x8C, 0x24, 0xD0, 0x00, 0x00, 0x00, 0x66,
+  0x44, 0x0F, 0x6F, 0x94, 0x24, 0xE0, 0x00, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x6F, 0x9C, 0x24, 0xF0,
+  0x00, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x6F, 0xB4, 0x24, 0x40, 0x03, 0x00, 0x00, 0x66, 0x44, 0x0F,
+  0x6F, 0xBC, 0x24, 0x50, 0x03, 0x00, 0x00, 0x41, 0xB9, 0x0A, 0x00, 0x00, 0x00, 0x66, 0x0F, 0xFE,
+  0xC4, 0x66, 0x44, 0x0F, 0xEF, 0xC0, 0x66, 0x45, 0x0F, 0x38, 0x00, 0xC6, 0x66, 0x44, 0x0F, 0x6F,
+  0xA4, 0x24, 0x00, 0x01, 0x00, 0x00, 0x66, 0x45, 0x0F, 0xFE, 0xE0, 0x66, 0x41, 0x0F, 0xEF, 0xE4,
+  0x66, 0x44, 0x0F, 0x6F, 0xEC, 0x66, 0x0F, 0x72, 0xF4, 0x0C, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x14,
+  0x66, 0x41, 0x0F, 0xEB, 0xE5, 0x66, 0x0F, 0xFE, 0xC4, 0x66, 0x44, 0x0F, 0xEF, 0xC0, 0x66, 0x45,
+  0x0F, 0x38, 0x00, 0xC7, 0x66, 0x45, 0x0F, 0xFE, 0xE0, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x00,
+  0x01, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xE4, 0x66, 0x44, 0x0F, 0x6F, 0xEC, 0x66, 0x0F, 0x72,
+  0xF4, 0x07, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x19, 0x66, 0x41, 0x0F, 0xEB, 0xE5, 0x66, 0x0F, 0xFE,
+  0xCD, 0x66, 0x44, 0x0F, 0xEF, 0xC9, 0x66, 0x45, 0x0F, 0x38, 0x00, 0xCE, 0x66, 0x44, 0x0F, 0x6F,
+  0xA4, 0x24, 0x10, 0x01, 0x00, 0x00, 0x66, 0x45, 0x0F, 0xFE, 0xE1, 0x66, 0x41, 0x0F, 0xEF, 0xEC,
+  0x66, 0x44, 0x0F, 0x6F, 0xED, 0x66, 0x0F, 0x72, 0xF5, 0x0C, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x14,
+  0x66, 0x41, 0x0F, 0xEB, 0xED, 0x66, 0x0F, 0xFE, 0xCD, 0x66, 0x44, 0x0F, 0xEF, 0xC9, 0x66, 0x45,
+  0x0F, 0x38, 0x00, 0xCF, 0x66, 0x45, 0x0F, 0xFE, 0xE1, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x10,
+  0x01, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xEC, 0x66, 0x44, 0x0F, 0x6F, 0xED, 0x66, 0x0F, 0x72,
+  0xF5, 0x07, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x19, 0x66, 0x41, 0x0F, 0xEB, 0xED, 0x66, 0x0F, 0xFE,
+  0xD6, 0x66, 0x44, 0x0F, 0xEF, 0xD2, 0x66, 0x45, 0x0F, 0x38, 0x00, 0xD6, 0x66, 0x44, 0x0F, 0x6F,
+  0xA4, 0x24, 0x20, 0x01, 0x00, 0x00, 0x66, 0x45, 0x0F, 0xFE, 0xE2, 0x66, 0x41, 0x0F, 0xEF, 0xF4,
+  0x66, 0x44, 0x0F, 0x6F, 0xEE, 0x66, 0x0F, 0x72, 0xF6, 0x0C, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x14,
+  0x66, 0x41, 0x0F, 0xEB, 0xF5, 0x66, 0x0F, 0xFE, 0xD6, 0x66, 0x44, 0x0F, 0xEF, 0xD2, 0x66, 0x45,
+  0x0F, 0x38, 0x00, 0xD7, 0x66, 0x45, 0x0F, 0xFE, 0xE2, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x20,
+  0x01, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xF4, 0x66, 0x44, 0x0F, 0x6F, 0xEE, 0x66, 0x0F, 0x72,
+  0xF6, 0x07, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x19, 0x66, 0x41, 0x0F, 0xEB, 0xF5, 0x66, 0x0F, 0xFE,
+  0xDF, 0x66, 0x44, 0x0F, 0xEF, 0xDB, 0x66, 0x45, 0x0F, 0x38, 0x00, 0xDE, 0x66, 0x44, 0x0F, 0x6F,
+  0xA4, 0x24, 0x30, 0x01, 0x00, 0x00, 0x66, 0x45, 0x0F, 0xFE, 0xE3, 0x66, 0x41, 0x0F, 0xEF, 0xFC,
+  0x66, 0x44, 0x0F, 0x6F, 0xEF, 0x66, 0x0F, 0x72, 0xF7, 0x0C, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x14,
+  0x66, 0x41, 0x0F, 0xEB, 0xFD, 0x66, 0x0F, 0xFE, 0xDF, 0x66, 0x44, 0x0F, 0xEF, 0xDB, 0x66, 0x45,
+  0x0F, 0x38, 0x00, 0xDF, 0x66, 0x45, 0x0F, 0xFE, 0xE3, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x30,
+  0x01, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xFC, 0x66, 0x44, 0x0F, 0x6F, 0xEF, 0x66, 0x0F, 0x72,
+  0xF7, 0x07, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x19, 0x66, 0x41, 0x0F, 0xEB, 0xFD, 0x66, 0x0F, 0xFE,
+  0xC5, 0x66, 0x44, 0x0F, 0xEF, 0xD8, 0x66, 0x45, 0x0F, 0x38, 0x00, 0xDE, 0x66, 0x44, 0x0F, 0x6F,
+  0xA4, 0x24, 0x20, 0x01, 0x00, 0x00, 0x66, 0x45, 0x0F, 0xFE, 0xE3, 0x66, 0x41, 0x0F, 0xEF, 0xEC,
+  0x66, 0x44, 0x0F, 0x6F, 0xED, 0x66, 0x0F, 0x72, 0xF5, 0x0C, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x14,
+  0x66, 0x41, 0x0F, 0xEB, 0xED, 0x66, 0x0F, 0xFE, 0xC5, 0x66, 0x44, 0x0F, 0xEF, 0xD8, 0x66, 0x45,
+  0x0F, 0x38, 0x00, 0xDF, 0x66, 0x45, 0x0F, 0xFE, 0xE3, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x20,
+  0x01, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xEC, 0x66, 0x44, 0x0F, 0x6F, 0xED, 0x66, 0x0F, 0x72,
+  0xF5, 0x07, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x19, 0x66, 0x41, 0x0F, 0xEB, 0xED, 0x66, 0x0F, 0xFE,
+  0xCE, 0x66, 0x44, 0x0F, 0xEF, 0xC1, 0x66, 0x45, 0x0F, 0x38, 0x00, 0xC6, 0x66, 0x44, 0x0F, 0x6F,
+  0xA4, 0x24, 0x30, 0x01, 0x00, 0x00, 0x66, 0x45, 0x0F, 0xFE, 0xE0, 0x66, 0x41, 0x0F, 0xEF, 0xF4,
+  0x66, 0x44, 0x0F, 0x6F, 0xEE, 0x66, 0x0F, 0x72, 0xF6, 0x0C, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x14,
+  0x66, 0x41, 0x0F, 0xEB, 0xF5, 0x66, 0x0F, 0xFE, 0xCE, 0x66, 0x44, 0x0F, 0xEF, 0xC1, 0x66, 0x45,
+  0x0F, 0x38, 0x00, 0xC7, 0x66, 0x45, 0x0F, 0xFE, 0xE0, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x30,
+  0x01, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xF4, 0x66, 0x44, 0x0F, 0x6F, 0xEE, 0x66, 0x0F, 0x72,
+  0xF6, 0x07, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x19, 0x66, 0x41, 0x0F, 0xEB, 0xF5, 0x66, 0x0F, 0xFE,
+  0xD7, 0x66, 0x44, 0x0F, 0xEF, 0xCA, 0x66, 0x45, 0x0F, 0x38, 0x00, 0xCE, 0x66, 0x44, 0x0F, 0x6F,
+  0xA4, 0x24, 0x00, 0x01, 0x00, 0x00, 0x66, 0x45, 0x0F, 0xFE, 0xE1, 0x66, 0x41, 0x0F, 0xEF, 0xFC,
+  0x66, 0x44, 0x0F, 0x6F, 0xEF, 0x66, 0x0F, 0x72, 0xF7, 0x0C, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x14,
+  0x66, 0x41, 0x0F, 0xEB, 0xFD, 0x66, 0x0F, 0xFE, 0xD7, 0x66, 0x44, 0x0F, 0xEF, 0xCA, 0x66, 0x45,
+  0x0F, 0x38, 0x00, 0xCF, 0x66, 0x45, 0x0F, 0xFE, 0xE1, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x00,
+  0x01, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xFC, 0x66, 0x44, 0x0F, 0x6F, 0xEF, 0x66, 0x0F, 0x72,
+  0xF7, 0x07, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x19, 0x66, 0x41, 0x0F, 0xEB, 0xFD, 0x66, 0x0F, 0xFE,
+  0xDC, 0x66, 0x44, 0x0F, 0xEF, 0xD3, 0x66, 0x45, 0x0F, 0x38, 0x00, 0xD6, 0x66, 0x44, 0x0F, 0x6F,
+  0xA4, 0x24, 0x10, 0x01, 0x00, 0x00, 0x66, 0x45, 0x0F, 0xFE, 0xE2, 0x66, 0x41, 0x0F, 0xEF, 0xE4,
+  0x66, 0x44, 0x0F, 0x6F, 0xEC, 0x66, 0x0F, 0x72, 0xF4, 0x0C, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x14,
+  0x66, 0x41, 0x0F, 0xEB, 0xE5, 0x66, 0x0F, 0xFE, 0xDC, 0x66, 0x44, 0x0F, 0xEF, 0xD3, 0x66, 0x45,
+  0x0F, 0x38, 0x00, 0xD7, 0x66, 0x45, 0x0F, 0xFE, 0xE2, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0x10,
+  0x01, 0x00, 0x00, 0x66, 0x41, 0x0F, 0xEF, 0xE4, 0x66, 0x44, 0x0F, 0x6F, 0xEC, 0x66, 0x0F, 0x72,
+  0xF4, 0x07, 0x66, 0x41, 0x0F, 0x72, 0xD5, 0x19, 0x66, 0x41, 0x0F, 0xEB, 0xE5, 0x41, 0xFF, 0xC9,
+  0x0F, 0x85, 0x77, 0xFC, 0xFF, 0xFF, 0x66, 0x0F, 0xFE, 0x04, 0x24, 0x66, 0x0F, 0x7F, 0x84, 0x24,
+  0x40, 0x01, 0x00, 0x00, 0x66, 0x0F, 0xFE, 0x4C, 0x24, 0x10, 0x66, 0x0F, 0x7F, 0x8C, 0x24, 0x50,
+  0x01, 0x00, 0x00, 0x66, 0x0F, 0xFE, 0x54, 0x24, 0x20, 0x66, 0x0F, 0x7F, 0x94, 0x24, 0x60, 0x01,
+  0x00, 0x00, 0x66, 0x0F, 0xFE, 0x5C, 0x24, 0x30, 0x66, 0x0F, 0x7F, 0x9C, 0x24, 0x70, 0x01, 0x00,
+  0x00, 0x66, 0x0F, 0xFE, 0x64, 0x24, 0x40, 0x66, 0x0F, 0x7F, 0xA4, 0x24, 0x80, 0x01, 0x00, 0x00,
+  0x66, 0x0F, 0xFE, 0x6C, 0x24, 0x50, 0x66, 0x0F, 0x7F, 0xAC, 0x24, 0x90, 0x01, 0x00, 0x00, 0x66,
+  0x0F, 0xFE, 0x74, 0x24, 0x60, 0x66, 0x0F, 0x7F, 0xB4, 0x24, 0xA0, 0x01, 0x00, 0x00, 0x66, 0x0F,
+  0xFE, 0x7C, 0x24, 0x70, 0x66, 0x0F, 0x7F, 0xBC, 0x24, 0xB0, 0x01, 0x00, 0x00, 0x66, 0x44, 0x0F,
+  0x6F, 0xA4, 0x24, 0x00, 0x01, 0x00, 0x00, 0x66, 0x44, 0x0F, 0xFE, 0xA4, 0x24, 0x80, 0x00, 0x00,
+  0x00, 0x66, 0x44, 0x0F, 0x7F, 0xA4, 0x24, 0xC0, 0x01, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x6F, 0xA4,
+  0x24, 0x10, 0x01, 0x00, 0x00, 0x66, 0x44, 0x0F, 0xFE, 0xA4, 0x24, 0x90, 0x00, 0x00, 0x00, 0x66,
+  0x44, 0x0F, 0x7F, 0xA4, 0x24, 0xD0, 0x01, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x6F, 0xA4, 0x24, 0x20,
+  0x01, 0x00, 0x00, 0x66, 0x44, 0x0F, 0xFE, 0xA4, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x66, 0x44, 0x0F,
+  0x7F, 0xA4, 0x24, 0xE0, 0x01, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x6F, 0xA4, 0x24, 0x30, 0x01, 0x00,
+  0x00, 0x66, 0x44, 0x0F, 0xFE, 0xA4, 0x24, 0xB0, 0x00, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x7F, 0xA4,
+  0x24, 0xF0, 0x01, 0x00, 0x00, 0x66, 0x44, 0x0F, 0xFE, 0x84, 0x24, 0xC0, 0x00, 0x00, 0x00, 0x66,
+  0x44, 0x0F, 0x7F, 0x84, 0x24, 0x00, 0x02, 0x00, 0x00, 0x66, 0x44, 0x0F, 0xFE, 0x8C, 0x24, 0xD0,
+  0x00, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x7F, 0x8C, 0x24, 0x10, 0x02, 0x00, 0x00, 0x66, 0x44, 0x0F,
+  0xFE, 0x94, 0x24, 0xE0, 0x00, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x7F, 0x94, 0x24, 0x20, 0x02, 0x00,
+  0x00, 0x66, 0x44, 0x0F, 0xFE, 0x9C, 0x24, 0xF0, 0x00, 0x00, 0x00, 0x66, 0x44, 0x0F, 0x7F, 0x9C,
+  0x24, 0x30, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x84, 0x24, 0xC0, 0x00, 0x00, 0x00, 0x66, 0x0F,
+  0xFE, 0x84, 0x24, 0x60, 0x03, 0x00, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0xC0, 0x00, 0x00, 0x00,
+  0x66, 0x0F, 0x6F, 0x84, 0x24, 0x40, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x8C, 0x24, 0x50, 0x01,
+  0x00, 0x00, 0x66, 0x0F, 0x6F, 0x94, 0x24, 0x60, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x9C, 0x24,
+  0x70, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0xE0, 0x66, 0x0F, 0x62, 0xE1, 0x66, 0x0F, 0x6A, 0xC1,
+  0x66, 0x0F, 0x6F, 0xEA, 0x66, 0x0F, 0x62, 0xEB, 0x66, 0x0F, 0x6A, 0xD3, 0x66, 0x0F, 0x6F, 0xCC,
+  0x66, 0x0F, 0x6C, 0xCD, 0x66, 0x0F, 0x6D, 0xE5, 0x66, 0x0F, 0x6F, 0xD8, 0x66, 0x0F, 0x6C, 0xDA,
+  0x66, 0x0F, 0x6D, 0xC2, 0x66, 0x0F, 0x7F, 0x8C, 0x24, 0x40, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x7F,
+  0xA4, 0x24, 0x80, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x7F, 0x9C, 0x24, 0xC0, 0x02, 0x00, 0x00, 0x66,
+  0x0F, 0x7F, 0x84, 0x24, 0x00, 0x03, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x84, 0x24, 0x80, 0x01, 0x00,
+  0x00, 0x66, 0x0F, 0x6F, 0x8C, 0x24, 0x90, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x94, 0x24, 0xA0,
+  0x01, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x9C, 0x24, 0xB0, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0xE0,
+  0x66, 0x0F, 0x62, 0xE1, 0x66, 0x0F, 0x6A, 0xC1, 0x66, 0x0F, 0x6F, 0xEA, 0x66, 0x0F, 0x62, 0xEB,
+  0x66, 0x0F, 0x6A, 0xD3, 0x66, 0x0F, 0x6F, 0xCC, 0x66, 0x0F, 0x6C, 0xCD, 0x66, 0x0F, 0x6D, 0xE5,
+  0x66, 0x0F, 0x6F, 0xD8, 0x66, 0x0F, 0x6C, 0xDA, 0x66, 0x0F, 0x6D, 0xC2, 0x66, 0x0F, 0x7F, 0x8C,
+  0x24, 0x50, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x7F, 0xA4, 0x24, 0x90, 0x02, 0x00, 0x00, 0x66, 0x0F,
+  0x7F, 0x9C, 0x24, 0xD0, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0x10, 0x03, 0x00, 0x00,
+  0x66, 0x0F, 0x6F, 0x84, 0x24, 0xC0, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x8C, 0x24, 0xD0, 0x01,
+  0x00, 0x00, 0x66, 0x0F, 0x6F, 0x94, 0x24, 0xE0, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x9C, 0x24,
+  0xF0, 0x01, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0xE0, 0x66, 0x0F, 0x62, 0xE1, 0x66, 0x0F, 0x6A, 0xC1,
+  0x66, 0x0F, 0x6F, 0xEA, 0x66, 0x0F, 0x62, 0xEB, 0x66, 0x0F, 0x6A, 0xD3, 0x66, 0x0F, 0x6F, 0xCC,
+  0x66, 0x0F, 0x6C, 0xCD, 0x66, 0x0F, 0x6D, 0xE5, 0x66, 0x0F, 0x6F, 0xD8, 0x66, 0x0F, 0x6C, 0xDA,
+  0x66, 0x0F, 0x6D, 0xC2, 0x66, 0x0F, 0x7F, 0x8C, 0x24, 0x60, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x7F,
+  0xA4, 0x24, 0xA0, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x7F, 0x9C, 0x24, 0xE0, 0x02, 0x00, 0x00, 0x66,
+  0x0F, 0x7F, 0x84, 0x24, 0x20, 0x03, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x84, 0x24, 0x00, 0x02, 0x00,
+  0x00, 0x66, 0x0F, 0x6F, 0x8C, 0x24, 0x10, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x94, 0x24, 0x20,
+  0x02, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0x9C, 0x24, 0x30, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x6F, 0xE0,
+  0x66, 0x0F, 0x62, 0xE1, 0x66, 0x0F, 0x6A, 0xC1, 0x66, 0x0F, 0x6F, 0xEA, 0x66, 0x0F, 0x62, 0xEB,
+  0x66, 0x0F, 0x6A, 0xD3, 0x66, 0x0F, 0x6F, 0xCC, 0x66, 0x0F, 0x6C, 0xCD, 0x66, 0x0F, 0x6D, 0xE5,
+  0x66, 0x0F, 0x6F, 0xD8, 0x66, 0x0F, 0x6C, 0xDA, 0x66, 0x0F, 0x6D, 0xC2, 0x66, 0x0F, 0x7F, 0x8C,
+  0x24, 0x70, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x7F, 0xA4, 0x24, 0xB0, 0x02, 0x00, 0x00, 0x66, 0x0F,
+  0x7F, 0x9C, 0x24, 0xF0, 0x02, 0x00, 0x00, 0x66, 0x0F, 0x7F, 0x84, 0x24, 0x30, 0x03, 0x00, 0x00,
+  0xB8, 0x00, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0x40, 0x02, 0x00, 0x00, 0xE8, 0x0A, 0x00,
+  0x00, 0x00, 0xE9, 0x5C, 0xF8, 0xFF, 0xFF, 0x48, 0x89, 0xEC, 0x5D, 0xC3, 0x48, 0x39, 0xC1, 0x48,
+  0x0F, 0x42, 0xC1, 0x45, 0x31, 0xDB, 0x4D, 0x8D, 0x4B, 0x10, 0x49, 0x39, 0xC1, 0x77, 0x1B, 0xF3,
+  0x42, 0x0F, 0x6F, 0x04, 0x1E, 0xF3, 0x43, 0x0F, 0x6F, 0x0C, 0x1A, 0x66, 0x0F, 0xEF, 0xC1, 0xF3,
+  0x42, 0x0F, 0x7F, 0x04, 0x1A, 0x4D, 0x89, 0xCB, 0xEB, 0xDC, 0x49, 0x39, 0xC3, 0x73, 0x11, 0x46,
+  0x8A, 0x0C, 0x1E, 0x47, 0x32, 0x0C, 0x1A, 0x46, 0x88, 0x0C, 0x1A, 0x49, 0xFF, 0xC3, 0xEB, 0xEA,
+  0x48, 0x01, 0xC6, 0x48, 0x01, 0xC2, 0x48, 0x29, 0xC1, 0xC3, 0x55, 0x48, 0x89, 0xE5, 0x48, 0x81,
+  0xEC, 0x00, 0x07, 0x00, 0x00, 0x48, 0x83, 0xE4, 0xC0, 0xB8, 0x65, 0x78, 0x70, 0x61, 0xC5, 0xF9,
+  0x6E, 0xC0, 0xC4, 0xE2, 0x7D, 0x58, 0xC0, 0xC5, 0xFD, 0x7F, 0x04, 0x24, 0xB8, 0x6E, 0x64, 0x20,
+  0x33, 0xC5, 0xF9, 0x6E, 0xC0, 0xC4, 0xE2, 0x7D, 0x58, 0xC0, 0xC5, 0xFD, 0x7F, 0x44, 0x24, 0x20,
+  0xB8, 0x32, 0x2D, 0x62, 0x79, 0xC5, 0xF9, 0x6E, 0xC0, 0xC4, 0xE2, 0x7D, 0x58, 0xC0, 0xC5, 0xFD,
+  0x7F, 0x44, 0x24, 0x40, 0xB8, 0x74, 0x65, 0x20, 0x6B, 0xC5, 0xF9, 0x6E, 0xC0, 0xC4, 0xE2, 0x7D,
+  0x58, 0xC0, 0xC5, 0xFD, 0x7F, 0x44, 0x24, 0x60, 0xC4, 0xE2, 0x7D, 0x58, 0x07, 0xC5, 0xFD, 0x7F,
+  0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0xC4, 0xE2, 0x7D, 0x58, 0x47, 0x04, 0xC5, 0xFD, 0x7F, 0x84,
+  0x24, 0xA0, 0x00, 0x00, 0x00, 0xC4, 0xE2, 0x7D, 0x58, 0x47, 0x08, 0xC5, 0xFD, 0x7F, 0x84, 0x24,
+  0xC0, 0x00, 0x00, 0x00, 0xC4, 0xE2, 0x7D, 0x58, 0x47, 0x0C, 0xC5, 0xFD, 0x7F, 0x84, 0x24, 0xE0,
+  0x00, 0x00, 0x00, 0xC4, 0xE2, 0x7D, 0x58, 0x47, 0x10, 0xC5, 0xFD, 0x7F, 0x84, 0x24, 0x00, 0x01,
+  0x00, 0x00, 0xC4, 0xE2, 0x7D, 0x58, 0x47, 0x14, 0xC5, 0xFD, 0x7F, 0x84, 0x24, 0x20, 0x01, 0x00,
+  0x00, 0xC4, 0xE2, 0x7D, 0x58, 0x47, 0x18, 0xC5, 0xFD, 0x7F, 0x84, 0x24, 0x40, 0x01, 0x00, 0x00,
+  0xC4, 0xE2, 0x7D, 0x58, 0x47, 0x1C, 0xC5, 0xFD, 0x7F, 0x84, 0x24, 0x60, 0x01, 0x00, 0x00, 0xC7,
+  0x84, 0x24, 0xC0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0xC4, 0x06, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0xC8, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0xC7, 0x84, 0x24, 0xCC, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0xD0, 0x06,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0xD4, 0x06, 0x00, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0xC7, 0x84, 0x24, 0xD8, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xC7, 0x84, 0x24, 0xDC,
+  0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xC4, 0xC1, 0x79, 0x6E, 0xC0, 0xC4, 0xE2, 0x7D, 0x58,
+  0xC0, 0xC5, 0xFD, 0xFE, 0x84, 0x24, 0xC0, 0x06, 0x00, 0x00, 0xC5, 0xFD, 0x7F, 0x84, 0x24, 0x80,
+  0x01, 0x00, 0x00, 0xC4, 0xE2, 0x7D, 0x58, 0x47, 0x20, 0xC5, 0xFD, 0x7F, 0x84, 0x24, 0xA0, 0x01,
+  0x00, 0x00, 0xC4, 0xE2, 0x7D, 0x58, 0x47, 0x24, 0xC5, 0xFD, 0x7F, 0x84, 0x24, 0xC0, 0x01, 0x00,
+  0x00, 0xC4, 0xE2, 0x7D, 0x58, 0x47, 0x28, 0xC5, 0xFD, 0x7F, 0x84, 0x24, 0xE0, 0x01, 0x00, 0x00,
+  0xB8, 0x08, 0x00, 0x00, 0x00, 0xC5, 0xF9, 0x6E, 0xC0, 0xC4, 0xE2, 0x7D, 0x58, 0xC0, 0xC5, 0xFD,
+  0x7F, 0x84, 0x24, 0xC0, 0x06, 0x00, 0x00, 0x48, 0xB8, 0x02, 0x03, 0x00, 0x01, 0x06, 0x07, 0x04,
+  0x05, 0x48, 0x89, 0x84, 0x24, 0x80, 0x06, 0x00, 0x00, 0x48, 0x89, 0x84, 0x24, 0x90, 0x06, 0x00,
+  0x00, 0x48, 0xB8, 0x0A, 0x0B, 0x08, 0x09, 0x0E, 0x0F, 0x0C, 0x0D, 0x48, 0x89, 0x84, 0x24, 0x88,
+  0x06, 0x00, 0x00, 0x48, 0x89, 0x84, 0x24, 0x98, 0x06, 0x00, 0x00, 0x48, 0xB8, 0x03, 0x00, 0x01,
+  0x02, 0x07, 0x04, 0x05, 0x06, 0x48, 0x89, 0x84, 0x24, 0xA0, 0x06, 0x00, 0x00, 0x48, 0x89, 0x84,
+  0x24, 0xB0, 0x06, 0x00, 0x00, 0x48, 0xB8, 0x0B, 0x08, 0x09, 0x0A, 0x0F, 0x0C, 0x0D, 0x0E, 0x48,
+  0x89, 0x84, 0x24, 0xA8, 0x06, 0x00, 0x00, 0x48, 0x89, 0x84, 0x24, 0xB8, 0x06, 0x00, 0x00, 0x48,
+  0x85, 0xC9, 0x0F, 0x84, 0x49, 0x07, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0x04, 0x24, 0xC5, 0xFD, 0x6F,
+  0x4C, 0x24, 0x20, 0xC5, 0xFD, 0x6F, 0x54, 0x24, 0x40, 0xC5, 0xFD, 0x6F, 0x5C, 0x24, 0x60, 0xC5,
+  0xFD, 0x6F, 0xA4, 0x24, 0x80, 0x00, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0xAC, 0x24, 0xA0, 0x00, 0x00,
+  0x00, 0xC5, 0xFD, 0x6F, 0xB4, 0x24, 0xC0, 0x00, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0xBC, 0x24, 0xE0,
+  0x00, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xA4, 0x24, 0x00, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0xA4,
+  0x24, 0x00, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xA4, 0x24, 0x20, 0x01, 0x00, 0x00, 0xC5, 0x7D,
+  0x7F, 0xA4, 0x24, 0x20, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xA4, 0x24, 0x40, 0x01, 0x00, 0x00,
+  0xC5, 0x7D, 0x7F, 0xA4, 0x24, 0x40, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xA4, 0x24, 0x60, 0x01,
+  0x00, 0x00, 0xC5, 0x7D, 0x7F, 0xA4, 0x24, 0x60, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0x84, 0x24,
+  0x80, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0x8C, 0x24, 0xA0, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x6F,
+  0x94, 0x24, 0xC0, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0x9C, 0x24, 0xE0, 0x01, 0x00, 0x00, 0xC5,
+  0x7D, 0x6F, 0xB4, 0x24, 0x80, 0x06, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xBC, 0x24, 0xA0, 0x06, 0x00,
+  0x00, 0x41, 0xB9, 0x0A, 0x00, 0x00, 0x00, 0xC5, 0xFD, 0xFE, 0xC4, 0xC5, 0x3D, 0xEF, 0xC0, 0xC4,
+  0x42, 0x3D, 0x00, 0xC6, 0xC5, 0x3D, 0xFE, 0xA4, 0x24, 0x00, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x5D,
+  0xEF, 0xE4, 0xC5, 0x95, 0x72, 0xF4, 0x0C, 0xC5, 0xDD, 0x72, 0xD4, 0x14, 0xC4, 0xC1, 0x5D, 0xEB,
+  0xE5, 0xC5, 0xFD, 0xFE, 0xC4, 0xC5, 0x3D, 0xEF, 0xC0, 0xC4, 0x42, 0x3D, 0x00, 0xC7, 0xC4, 0x41,
+  0x1D, 0xFE, 0xE0, 0xC5, 0x7D, 0x7F, 0xA4, 0x24, 0x00, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x5D, 0xEF,
+  0xE4, 0xC5, 0x95, 0x72, 0xF4, 0x07, 0xC5, 0xDD, 0x72, 0xD4, 0x19, 0xC4, 0xC1, 0x5D, 0xEB, 0xE5,
+  0xC5, 0xF5, 0xFE, 0xCD, 0xC5, 0x35, 0xEF, 0xC9, 0xC4, 0x42, 0x35, 0x00, 0xCE, 0xC5, 0x35, 0xFE,
+  0xA4, 0x24, 0x20, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x55, 0xEF, 0xEC, 0xC5, 0x95, 0x72, 0xF5, 0x0C,
+  0xC5, 0xD5, 0x72, 0xD5, 0x14, 0xC4, 0xC1, 0x55, 0xEB, 0xED, 0xC5, 0xF5, 0xFE, 0xCD, 0xC5, 0x35,
+  0xEF, 0xC9, 0xC4, 0x42, 0x35, 0x00, 0xCF, 0xC4, 0x41, 0x1D, 0xFE, 0xE1, 0xC5, 0x7D, 0x7F, 0xA4,
+  0x24, 0x20, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x55, 0xEF, 0xEC, 0xC5, 0x95, 0x72, 0xF5, 0x07, 0xC5,
+  0xD5, 0x72, 0xD5, 0x19, 0xC4, 0xC1, 0x55, 0xEB, 0xED, 0xC5, 0xED, 0xFE, 0xD6, 0xC5, 0x2D, 0xEF,
+  0xD2, 0xC4, 0x42, 0x2D, 0x00, 0xD6, 0xC5, 0x2D, 0xFE, 0xA4, 0x24, 0x40, 0x02, 0x00, 0x00, 0xC4,
+  0xC1, 0x4D, 0xEF, 0xF4, 0xC5, 0x95, 0x72, 0xF6, 0x0C, 0xC5, 0xCD, 0x72, 0xD6, 0x14, 0xC4, 0xC1,
+  0x4D, 0xEB, 0xF5, 0xC5, 0xED, 0xFE, 0xD6, 0xC5, 0x2D, 0xEF, 0xD2, 0xC4, 0x42, 0x2D, 0x00, 0xD7,
+  0xC4, 0x41, 0x1D, 0xFE, 0xE2, 0xC5, 0x7D, 0x7F, 0xA4, 0x24, 0x40, 0x02, 0x00, 0x00, 0xC4, 0xC1,
+  0x4D, 0xEF, 0xF4, 0xC5, 0x95, 0x72, 0xF6, 0x07, 0xC5, 0xCD, 0x72, 0xD6, 0x19, 0xC4, 0xC1, 0x4D,
+  0xEB, 0xF5, 0xC5, 0xE5, 0xFE, 0xDF, 0xC5, 0x25, 0xEF, 0xDB, 0xC4, 0x42, 0x25, 0x00, 0xDE, 0xC5,
+  0x25, 0xFE, 0xA4, 0x24, 0x60, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x45, 0xEF, 0xFC, 0xC5, 0x95, 0x72,
+  0xF7, 0x0C, 0xC5, 0xC5, 0x72, 0xD7, 0x14, 0xC4, 0xC1, 0x45, 0xEB, 0xFD, 0xC5, 0xE5, 0xFE, 0xDF,
+  0xC5, 0x25, 0xEF, 0xDB, 0xC4, 0x42, 0x25, 0x00, 0xDF, 0xC4, 0x41, 0x1D, 0xFE, 0xE3, 0xC5, 0x7D,
+  0x7F, 0xA4, 0x24, 0x60, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x45, 0xEF, 0xFC, 0xC5, 0x95, 0x72, 0xF7,
+  0x07, 0xC5, 0xC5, 0x72, 0xD7, 0x19, 0xC4, 0xC1, 0x45, 0xEB, 0xFD, 0xC5, 0xFD, 0xFE, 0xC5, 0xC5,
+  0x25, 0xEF, 0xD8, 0xC4, 0x42, 0x25, 0x00, 0xDE, 0xC5, 0x25, 0xFE, 0xA4, 0x24, 0x40, 0x02, 0x00,
+  0x00, 0xC4, 0xC1, 0x55, 0xEF, 0xEC, 0xC5, 0x95, 0x72, 0xF5, 0x0C, 0xC5, 0xD5, 0x72, 0xD5, 0x14,
+  0xC4, 0xC1, 0x55, 0xEB, 0xED, 0xC5, 0xFD, 0xFE, 0xC5, 0xC5, 0x25, 0xEF, 0xD8, 0xC4, 0x42, 0x25,
+  0x00, 0xDF, 0xC4, 0x41, 0x1D, 0xFE, 0xE3, 0xC5, 0x7D, 0x7F, 0xA4, 0x24, 0x40, 0x02, 0x00, 0x00,
+  0xC4, 0xC1, 0x55, 0xEF, 0xEC, 0xC5, 0x95, 0x72, 0xF5, 0x07, 0xC5, 0xD5, 0x72, 0xD5, 0x19, 0xC4,
+  0xC1, 0x55, 0xEB, 0xED, 0xC5, 0xF5, 0xFE, 0xCE, 0xC5, 0x3D, 0xEF, 0xC1, 0xC4, 0x42, 0x3D, 0x00,
+  0xC6, 0xC5, 0x3D, 0xFE, 0xA4, 0x24, 0x60, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x4D, 0xEF, 0xF4, 0xC5,
+  0x95, 0x72, 0xF6, 0x0C, 0xC5, 0xCD, 0x72, 0xD6, 0x14, 0xC4, 0xC1, 0x4D, 0xEB, 0xF5, 0xC5, 0xF5,
+  0xFE, 0xCE, 0xC5, 0x3D, 0xEF, 0xC1, 0xC4, 0x42, 0x3D, 0x00, 0xC7, 0xC4, 0x41, 0x1D, 0xFE, 0xE0,
+  0xC5, 0x7D, 0x7F, 0xA4, 0x24, 0x60, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x4D, 0xEF, 0xF4, 0xC5, 0x95,
+  0x72, 0xF6, 0x07, 0xC5, 0xCD, 0x72, 0xD6, 0x19, 0xC4, 0xC1, 0x4D, 0xEB, 0xF5, 0xC5, 0xED, 0xFE,
+  0xD7, 0xC5, 0x35, 0xEF, 0xCA, 0xC4, 0x42, 0x35, 0x00, 0xCE, 0xC5, 0x35, 0xFE, 0xA4, 0x24, 0x00,
+  0x02, 0x00, 0x00, 0xC4, 0xC1, 0x45, 0xEF, 0xFC, 0xC5, 0x95, 0x72, 0xF7, 0x0C, 0xC5, 0xC5, 0x72,
+  0xD7, 0x14, 0xC4, 0xC1, 0x45, 0xEB, 0xFD, 0xC5, 0xED, 0xFE, 0xD7, 0xC5, 0x35, 0xEF, 0xCA, 0xC4,
+  0x42, 0x35, 0x00, 0xCF, 0xC4, 0x41, 0x1D, 0xFE, 0xE1, 0xC5, 0x7D, 0x7F, 0xA4, 0x24, 0x00, 0x02,
+  0x00, 0x00, 0xC4, 0xC1, 0x45, 0xEF, 0xFC, 0xC5, 0x95, 0x72, 0xF7, 0x07, 0xC5, 0xC5, 0x72, 0xD7,
+  0x19, 0xC4, 0xC1, 0x45, 0xEB, 0xFD, 0xC5, 0xE5, 0xFE, 0xDC, 0xC5, 0x2D, 0xEF, 0xD3, 0xC4, 0x42,
+  0x2D, 0x00, 0xD6, 0xC5, 0x2D, 0xFE, 0xA4, 0x24, 0x20, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x5D, 0xEF,
+  0xE4, 0xC5, 0x95, 0x72, 0xF4, 0x0C, 0xC5, 0xDD, 0x72, 0xD4, 0x14, 0xC4, 0xC1, 0x5D, 0xEB, 0xE5,
+  0xC5, 0xE5, 0xFE, 0xDC, 0xC5, 0x2D, 0xEF, 0xD3, 0xC4, 0x42, 0x2D, 0x00, 0xD7, 0xC4, 0x41, 0x1D,
+  0xFE, 0xE2, 0xC5, 0x7D, 0x7F, 0xA4, 0x24, 0x20, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x5D, 0xEF, 0xE4,
+  0xC5, 0x95, 0x72, 0xF4, 0x07, 0xC5, 0xDD, 0x72, 0xD4, 0x19, 0xC4, 0xC1, 0x5D, 0xEB, 0xE5, 0x41,
+  0xFF, 0xC9, 0x0F, 0x85, 0x2F, 0xFD, 0xFF, 0xFF, 0xC5, 0xFD, 0xFE, 0x04, 0x24, 0xC5, 0xFD, 0x7F,
+  0x84, 0x24, 0x80, 0x02, 0x00, 0x00, 0xC5, 0xF5, 0xFE, 0x4C, 0x24, 0x20, 0xC5, 0xFD, 0x7F, 0x8C,
+  0x24, 0xA0, 0x02, 0x00, 0x00, 0xC5, 0xED, 0xFE, 0x54, 0x24, 0x40, 0xC5, 0xFD, 0x7F, 0x94, 0x24,
+  0xC0, 0x02, 0x00, 0x00, 0xC5, 0xE5, 0xFE, 0x5C, 0x24, 0x60, 0xC5, 0xFD, 0x7F, 0x9C, 0x24, 0xE0,
+  0x02, 0x00, 0x00, 0xC5, 0xDD, 0xFE, 0xA4, 0x24, 0x80, 0x00, 0x00, 0x00, 0xC5, 0xFD, 0x7F, 0xA4,
+  0x24, 0x00, 0x03, 0x00, 0x00, 0xC5, 0xD5, 0xFE, 0xAC, 0x24, 0xA0, 0x00, 0x00, 0x00, 0xC5, 0xFD,
+  0x7F, 0xAC, 0x24, 0x20, 0x03, 0x00, 0x00, 0xC5, 0xCD, 0xFE, 0xB4, 0x24, 0xC0, 0x00, 0x00, 0x00,
+  0xC5, 0xFD, 0x7F, 0xB4, 0x24, 0x40, 0x03, 0x00, 0x00, 0xC5, 0xC5, 0xFE, 0xBC, 0x24, 0xE0, 0x00,
+  0x00, 0x00, 0xC5, 0xFD, 0x7F, 0xBC, 0x24, 0x60, 0x03, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xA4, 0x24,
+  0x00, 0x02, 0x00, 0x00, 0xC5, 0x1D, 0xFE, 0xA4, 0x24, 0x00, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F,
+  0xA4, 0x24, 0x80, 0x03, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xA4, 0x24, 0x20, 0x02, 0x00, 0x00, 0xC5,
+  0x1D, 0xFE, 0xA4, 0x24, 0x20, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0xA4, 0x24, 0xA0, 0x03, 0x00,
+  0x00, 0xC5, 0x7D, 0x6F, 0xA4, 0x24, 0x40, 0x02, 0x00, 0x00, 0xC5, 0x1D, 0xFE, 0xA4, 0x24, 0x40,
+  0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0xA4, 0x24, 0xC0, 0x03, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xA4,
+  0x24, 0x60, 0x02, 0x00, 0x00, 0xC5, 0x1D, 0xFE, 0xA4, 0x24, 0x60, 0x01, 0x00, 0x00, 0xC5, 0x7D,
+  0x7F, 0xA4, 0x24, 0xE0, 0x03, 0x00, 0x00, 0xC5, 0x3D, 0xFE, 0x84, 0x24, 0x80, 0x01, 0x00, 0x00,
+  0xC5, 0x7D, 0x7F, 0x84, 0x24, 0x00, 0x04, 0x00, 0x00, 0xC5, 0x35, 0xFE, 0x8C, 0x24, 0xA0, 0x01,
+  0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x8C, 0x24, 0x20, 0x04, 0x00, 0x00, 0xC5, 0x2D, 0xFE, 0x94, 0x24,
+  0xC0, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x40, 0x04, 0x00, 0x00, 0xC5, 0x25, 0xFE,
+  0x9C, 0x24, 0xE0, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x9C, 0x24, 0x60, 0x04, 0x00, 0x00, 0xC5,
+  0xFD, 0x6F, 0x84, 0x24, 0x80, 0x01, 0x00, 0x00, 0xC5, 0xFD, 0xFE, 0x84, 0x24, 0xC0, 0x06, 0x00,
+  0x00, 0xC5, 0xFD, 0x7F, 0x84, 0x24, 0x80, 0x01, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0x84, 0x24, 0x80,
+  0x02, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0x8C, 0x24, 0xA0, 0x02, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0x94,
+  0x24, 0xC0, 0x02, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0x9C, 0x24, 0xE0, 0x02, 0x00, 0x00, 0xC5, 0xFD,
+  0x62, 0xE1, 0xC5, 0xFD, 0x6A, 0xC1, 0xC5, 0xED, 0x62, 0xEB, 0xC5, 0xED, 0x6A, 0xD3, 0xC5, 0xDD,
+  0x6C, 0xCD, 0xC5, 0xDD, 0x6D, 0xE5, 0xC5, 0xFD, 0x6C, 0xDA, 0xC5, 0xFD, 0x6D, 0xC2, 0xC5, 0xF9,
+  0x7F, 0x8C, 0x24, 0x80, 0x04, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0x8C, 0x24, 0x80, 0x05, 0x00,
+  0x00, 0x01, 0xC5, 0xF9, 0x7F, 0xA4, 0x24, 0xC0, 0x04, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0xA4,
+  0x24, 0xC0, 0x05, 0x00, 0x00, 0x01, 0xC5, 0xF9, 0x7F, 0x9C, 0x24, 0x00, 0x05, 0x00, 0x00, 0xC4,
+  0xE3, 0x7D, 0x39, 0x9C, 0x24, 0x00, 0x06, 0x00, 0x00, 0x01, 0xC5, 0xF9, 0x7F, 0x84, 0x24, 0x40,
+  0x05, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0x84, 0x24, 0x40, 0x06, 0x00, 0x00, 0x01, 0xC5, 0xFD,
+  0x6F, 0x84, 0x24, 0x00, 0x03, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0x8C, 0x24, 0x20, 0x03, 0x00, 0x00,
+  0xC5, 0xFD, 0x6F, 0x94, 0x24, 0x40, 0x03, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0x9C, 0x24, 0x60, 0x03,
+  0x00, 0x00, 0xC5, 0xFD, 0x62, 0xE1, 0xC5, 0xFD, 0x6A, 0xC1, 0xC5, 0xED, 0x62, 0xEB, 0xC5, 0xED,
+  0x6A, 0xD3, 0xC5, 0xDD, 0x6C, 0xCD, 0xC5, 0xDD, 0x6D, 0xE5, 0xC5, 0xFD, 0x6C, 0xDA, 0xC5, 0xFD,
+  0x6D, 0xC2, 0xC5, 0xF9, 0x7F, 0x8C, 0x24, 0x90, 0x04, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0x8C,
+  0x24, 0x90, 0x05, 0x00, 0x00, 0x01, 0xC5, 0xF9, 0x7F, 0xA4, 0x24, 0xD0, 0x04, 0x00, 0x00, 0xC4,
+  0xE3, 0x7D, 0x39, 0xA4, 0x24, 0xD0, 0x05, 0x00, 0x00, 0x01, 0xC5, 0xF9, 0x7F, 0x9C, 0x24, 0x10,
+  0x05, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0x9C, 0x24, 0x10, 0x06, 0x00, 0x00, 0x01, 0xC5, 0xF9,
+  0x7F, 0x84, 0x24, 0x50, 0x05, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0x84, 0x24, 0x50, 0x06, 0x00,
+  0x00, 0x01, 0xC5, 0xFD, 0x6F, 0x84, 0x24, 0x80, 0x03, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0x8C, 0x24,
+  0xA0, 0x03, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0x94, 0x24, 0xC0, 0x03, 0x00, 0x00, 0xC5, 0xFD, 0x6F,
+  0x9C, 0x24, 0xE0, 0x03, 0x00, 0x00, 0xC5, 0xFD, 0x62, 0xE1, 0xC5, 0xFD, 0x6A, 0xC1, 0xC5, 0xED,
+  0x62, 0xEB, 0xC5, 0xED, 0x6A, 0xD3, 0xC5, 0xDD, 0x6C, 0xCD, 0xC5, 0xDD, 0x6D, 0xE5, 0xC5, 0xFD,
+  0x6C, 0xDA, 0xC5, 0xFD, 0x6D, 0xC2, 0xC5, 0xF9, 0x7F, 0x8C, 0x24, 0xA0, 0x04, 0x00, 0x00, 0xC4,
+  0xE3, 0x7D, 0x39, 0x8C, 0x24, 0xA0, 0x05, 0x00, 0x00, 0x01, 0xC5, 0xF9, 0x7F, 0xA4, 0x24, 0xE0,
+  0x04, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0xA4, 0x24, 0xE0, 0x05, 0x00, 0x00, 0x01, 0xC5, 0xF9,
+  0x7F, 0x9C, 0x24, 0x20, 0x05, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0x9C, 0x24, 0x20, 0x06, 0x00,
+  0x00, 0x01, 0xC5, 0xF9, 0x7F, 0x84, 0x24, 0x60, 0x05, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0x84,
+  0x24, 0x60, 0x06, 0x00, 0x00, 0x01, 0xC5, 0xFD, 0x6F, 0x84, 0x24, 0x00, 0x04, 0x00, 0x00, 0xC5,
+  0xFD, 0x6F, 0x8C, 0x24, 0x20, 0x04, 0x00, 0x00, 0xC5, 0xFD, 0x6F, 0x94, 0x24, 0x40, 0x04, 0x00,
+  0x00, 0xC5, 0xFD, 0x6F, 0x9C, 0x24, 0x60, 0x04, 0x00, 0x00, 0xC5, 0xFD, 0x62, 0xE1, 0xC5, 0xFD,
+  0x6A, 0xC1, 0xC5, 0xED, 0x62, 0xEB, 0xC5, 0xED, 0x6A, 0xD3, 0xC5, 0xDD, 0x6C, 0xCD, 0xC5, 0xDD,
+  0x6D, 0xE5, 0xC5, 0xFD, 0x6C, 0xDA, 0xC5, 0xFD, 0x6D, 0xC2, 0xC5, 0xF9, 0x7F, 0x8C, 0x24, 0xB0,
+  0x04, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0x8C, 0x24, 0xB0, 0x05, 0x00, 0x00, 0x01, 0xC5, 0xF9,
+  0x7F, 0xA4, 0x24, 0xF0, 0x04, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0xA4, 0x24, 0xF0, 0x05, 0x00,
+  0x00, 0x01, 0xC5, 0xF9, 0x7F, 0x9C, 0x24, 0x30, 0x05, 0x00, 0x00, 0xC4, 0xE3, 0x7D, 0x39, 0x9C,
+  0x24, 0x30, 0x06, 0x00, 0x00, 0x01, 0xC5, 0xF9, 0x7F, 0x84, 0x24, 0x70, 0x05, 0x00, 0x00, 0xC4,
+  0xE3, 0x7D, 0x39, 0x84, 0x24, 0x70, 0x06, 0x00, 0x00, 0x01, 0xB8, 0x00, 0x02, 0x00, 0x00, 0x4C,
+  0x8D, 0x94, 0x24, 0x80, 0x04, 0x00, 0x00, 0xE8, 0x0D, 0x00, 0x00, 0x00, 0xE9, 0xAE, 0xF8, 0xFF,
+  0xFF, 0xC5, 0xF8, 0x77, 0x48, 0x89, 0xEC, 0x5D, 0xC3, 0x48, 0x39, 0xC1, 0x48, 0x0F, 0x42, 0xC1,
+  0x45, 0x31, 0xDB, 0x4D, 0x8D, 0x4B, 0x20, 0x49, 0x39, 0xC1, 0x77, 0x17, 0xC4, 0xA1, 0x7E, 0x6F,
+  0x04, 0x1E, 0xC4, 0x81, 0x7D, 0xEF, 0x04, 0x1A, 0xC4, 0xA1, 0x7E, 0x7F, 0x04, 0x1A, 0x4D, 0x89,
+  0xCB, 0xEB, 0xE0, 0x49, 0x39, 0xC3, 0x73, 0x11, 0x46, 0x8A, 0x0C, 0x1E, 0x47, 0x32, 0x0C, 0x1A,
+  0x46, 0x88, 0x0C, 0x1A, 0x49, 0xFF, 0xC3, 0xEB, 0xEA, 0x48, 0x01, 0xC6, 0x48, 0x01, 0xC2, 0x48,
+  0x29, 0xC1, 0xC3, 0x48, 0x8B, 0x5F, 0x60, 0x48, 0x8B, 0x6F, 0x68, 0x4C, 0x8B, 0x67, 0x70, 0x4C,
+  0x8B, 0x6F, 0x78, 0x4C, 0x8B, 0xB7, 0x80, 0x00, 0x00, 0x00, 0x4D, 0x89, 0xF7, 0x49, 0xC1, 0xEF,
+  0x02, 0x4D, 0x01, 0xF7, 0x49, 0x03, 0x1A, 0x49, 0x13, 0x6A, 0x08, 0x49, 0x83, 0xD4, 0x01, 0x48,
+  0x89, 0xD8, 0x49, 0xF7, 0xE5, 0x49, 0x89, 0xC0, 0x49, 0x89, 0xD1, 0x48, 0x89, 0xE8, 0x49, 0xF7,
+  0xE7, 0x49, 0x01, 0xC0, 0x49, 0x11, 0xD1, 0x48, 0x89, 0xD8, 0x49, 0xF7, 0xE6, 0x48, 0x89, 0xC3,
+  0x48, 0x89, 0xD1, 0x48, 0x89, 0xE8, 0x49, 0xF7, 0xE5, 0x48, 0x01, 0xC3, 0x48, 0x11, 0xD1, 0x4C,
+  0x89, 0xF8, 0x49, 0x0F, 0xAF, 0xC4, 0x48, 0x01, 0xC3, 0x48, 0x83, 0xD1, 0x00, 0x4D, 0x0F, 0xAF,
+  0xE5, 0x4C, 0x01, 0xCB, 0x48, 0x83, 0xD1, 0x00, 0x49, 0x01, 0xCC, 0x48, 0x89, 0xDD, 0x4C, 0x89,
+  0xC3, 0x4C, 0x89, 0xE0, 0x48, 0x83, 0xE0, 0xFC, 0x4C, 0x89, 0xE1, 0x48, 0xC1, 0xE9, 0x02, 0x49,
+  0x83, 0xE4, 0x03, 0x48, 0x01, 0xC8, 0x48, 0x01, 0xC3, 0x48, 0x83, 0xD5, 0x00, 0x49, 0x83, 0xD4,
+  0x00, 0x49, 0x83, 0xC2, 0x10, 0x49, 0x83, 0xEB, 0x10, 0x0F, 0x85, 0x75, 0xFF, 0xFF, 0xFF, 0x48,
+  0x89, 0x5F, 0x60, 0x48, 0x89, 0x6F, 0x68, 0x4C, 0x89, 0x67, 0x70, 0xC3, 0x4D, 0x89, 0xD9, 0x49,
+  0x83, 0xE1, 0x0F, 0x49, 0x83, 0xE3, 0xF0, 0x74, 0x09, 0x41, 0x51, 0xE8, 0x33, 0xFF, 0xFF, 0xFF,
+  0x41, 0x59, 0x4D, 0x85, 0xC9, 0x74, 0x30, 0x48, 0x83, 0xEC, 0x18, 0x66, 0x0F, 0xEF, 0xC0, 0xF3,
+  0x0F, 0x7F, 0x04, 0x24, 0x31, 0xC0, 0x41, 0x8A, 0x0C, 0x02, 0x88, 0x0C, 0x04, 0x48, 0xFF, 0xC0,
+  0x4C, 0x39, 0xC8, 0x72, 0xF1, 0x49, 0x89, 0xE2, 0x41, 0xBB, 0x10, 0x00, 0x00, 0x00, 0xE8, 0x00,
+  0xFF, 0xFF, 0xFF, 0x48, 0x83, 0xC4, 0x18, 0xC3, 0x53, 0x55, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56,
+  0x41, 0x57, 0x48, 0x83, 0xEC, 0x68, 0x48, 0x89, 0x74, 0x24, 0x40, 0x48, 0x89, 0x54, 0x24, 0x48,
+  0x48, 0x89, 0x4C, 0x24, 0x50, 0x66, 0x0F, 0xEF, 0xC0, 0xF3, 0x0F, 0x7F, 0x04, 0x24, 0xF3, 0x0F,
+  0x7F, 0x44, 0x24, 0x10, 0x48, 0x89, 0xE6, 0x48, 0x89, 0xE2, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x45,
+  0x31, 0xC0, 0xE8, 0x58, 0xEB, 0xFF, 0xFF, 0x48, 0x8B, 0x04, 0x24, 0x49, 0xB9, 0xFF, 0xFF, 0xFF,
+  0x0F, 0xFC, 0xFF, 0xFF, 0x0F, 0x4C, 0x21, 0xC8, 0x48, 0x89, 0x47, 0x78, 0x48, 0x8B, 0x44, 0x24,
+  0x08, 0x49, 0xB9, 0xFC, 0xFF, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0x0F, 0x4C, 0x21, 0xC8, 0x48, 0x89,
+  0x87, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x44, 0x24, 0x10, 0x48, 0x89, 0x87, 0x88, 0x00, 0x00,
+  0x00, 0x48, 0x8B, 0x44, 0x24, 0x18, 0x48, 0x89, 0x87, 0x90, 0x00, 0x00, 0x00, 0x31, 0xC0, 0x48,
+  0x89, 0x47, 0x60, 0x48, 0x89, 0x47, 0x68, 0x48, 0x89, 0x47, 0x70, 0x4C, 0x8B, 0x54, 0x24, 0x50,
+  0x4C, 0x8B, 0x5F, 0x38, 0xE8, 0x13, 0xFF, 0xFF, 0xFF, 0x48, 0x83, 0x7F, 0x50, 0x00, 0x74, 0x27,
+  0x4C, 0x8B, 0x54, 0x24, 0x40, 0x4C, 0x8B, 0x5F, 0x30, 0xE8, 0xFE, 0xFE, 0xFF, 0xFF, 0x48, 0x8B,
+  0x74, 0x24, 0x40, 0x48, 0x8B, 0x54, 0x24, 0x48, 0x48, 0x8B, 0x4F, 0x30, 0x44, 0x8B, 0x47, 0x2C,
+  0xE8, 0xCA, 0xEA, 0xFF, 0xFF, 0xEB, 0x25, 0x48, 0x8B, 0x74, 0x24, 0x40, 0x48, 0x8B, 0x54, 0x24,
+  0x48, 0x48, 0x8B, 0x4F, 0x30, 0x44, 0x8B, 0x47, 0x2C, 0xE8, 0xB1, 0xEA, 0xFF, 0xFF, 0x4C, 0x8B,
+  0x54, 0x24, 0x48, 0x4C, 0x8B, 0x5F, 0x30, 0xE8, 0xC0, 0xFE, 0xFF, 0xFF, 0x48, 0x8B, 0x47, 0x38,
+  0x48, 0x89, 0x04, 0x24, 0x48, 0x8B, 0x47, 0x30, 0x48, 0x89, 0x44, 0x24, 0x08, 0x49, 0x89, 0xE2,
+  0x41, 0xBB, 0x10, 0x00, 0x00, 0x00, 0xE8, 0xE8, 0xFD, 0xFF, 0xFF, 0x4C, 0x8B, 0x47, 0x60, 0x4C,
+  0x8B, 0x4F, 0x68, 0x4C, 0x8B, 0x57, 0x70, 0x4C, 0x89, 0xC0, 0x4C, 0x89, 0xC9, 0x49, 0x83, 0xC0,
+  0x05, 0x49, 0x83, 0xD1, 0x00, 0x49, 0x83, 0xD2, 0x00, 0x49, 0xC1, 0xEA, 0x02, 0x49, 0x0F, 0x45,
+  0xC0, 0x49, 0x0F, 0x45, 0xC9, 0x48, 0x03, 0x87, 0x88, 0x00, 0x00, 0x00, 0x48, 0x13, 0x8F, 0x90,
+  0x00, 0x00, 0x00, 0x48, 0x89, 0x47, 0x40, 0x48, 0x89, 0x4F, 0x48, 0x66, 0x0F, 0xEF, 0xC0, 0xF3,
+  0x0F, 0x7F, 0x04, 0x24, 0xF3, 0x0F, 0x7F, 0x44, 0x24, 0x10, 0xF3, 0x0F, 0x7F, 0x47, 0x60, 0xF3,
+  0x0F, 0x7F, 0x47, 0x70, 0xF3, 0x0F, 0x7F, 0x87, 0x80, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x7F, 0x87,
+  0x90, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x68, 0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C,
+  0x5D, 0x5B, 0xC3,
+];
+
+/// Offset da entrada `chacha20_poly1305` dentro de
+/// [kChaCha20Poly1305Shellcode].
+const int kChaCha20Poly1305AeadOffset = 0x0A;
@@ -0,0 +1,56 @@
+// dart format width=5000
+//
+// Keccak-f[1600] em 4 estados com kernel AVX2 (asm/keccak_x4_avx2_x86_64.S)
+//
+// Cada ymm guarda a mesma lane dos quatro estados, então as 24 rodadas
+// rodam uma vez para os quatro numa única chamada FFI leaf. Usado por
+// KeccakX4 (crypto/keccak.dart) para gerar as matrizes do ML-KEM/ML-DSA.
+//
+// Referência: FIPS 202; XKCP, KeccakP-1600-times4-SIMD256
+
+import 'dart:ffi' as ffi;
+import 'dart:io' show Platform;
+import 'dart:typed_data';
+
+import 'chacha20_poly1305_asm_x86_64.dart' show ChaCha20Poly1305AsmSupport;
+import 'keccak_x4_shellcode_x86_64.dart';
+import 'rijndael_fast_asm_x86_64.dart' show ExecutableMemory;
+import 'win64_thunk_x86_64.dart';
+
+/// Assinatura nativa de `keccak_f1600_x4(state)`
+typedef KeccakX4NativeFunc = ffi.Void Function(ffi.Pointer<ffi.Uint64>);
+typedef KeccakX4DartFunc = void Function(ffi.Pointer<ffi.Uint64>);
+
+/// Permutação Keccak-f[1600] nativa de 4 estados intercalados
+class KeccakX4Avx2 {
+  static ExecutableMemory? _code;
+  static KeccakX4DartFunc? _permute;
+
+  /// Verdadeiro quando AVX2 está disponível (CPU e estado YMM habilitado)
+  static bool get isSupported => ChaCha20Poly1305AsmSupport.isAvx2Supported;
+
+  static KeccakX4DartFunc _ensureCode() {
+    if (_permute != null) return _permute!;
+    if (!isSupported) {
+      throw UnsupportedError('AVX2 não suportado nesta plataforma');
+    }
+    if (Platform.isWindows) {
+      _code = ExecutableMemory.allocate(Uint8List.fromList([
+        ...windowsSysVThunk(kWindowsThunkSize - kWindowsThunkCallEnd),
+        ...kKeccakX4Avx2Shellcode,
+      ]));
+    } else {
+      _code = ExecutableMemory.allocate(Uint8List.fromList(kKeccakX4Avx2Shellcode));
+    }
+    _permute = _code!.pointer.cast<ffi.NativeFunction<KeccakX4NativeFunc>>().asFunction<KeccakX4DartFunc>(isLeaf: true);
+    return _permute!;
+  }
+
+  /// Permuta [state] in place; a lane i do estado s fica em `state[4*i + s]`
+  static void permute(Uint64List state) {
+    if (state.length != 100) {
+      throw ArgumentError('Keccak x4 state must have 100 lanes');
+    }
+    _ensureCode()(state.address);
+  }
+}
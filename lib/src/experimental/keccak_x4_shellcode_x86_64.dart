@@ -0,0 +1,148 @@
+// dart format width=5000
+// AUTO-GENERATED - DO NOT EDIT
+// Shellcode montado de asm/keccak_x4_avx2_x86_64.S
+//   as --64 -o keccak_x4_avx2_x86_64.o keccak_x4_avx2_x86_64.S
+//   objcopy -O binary -j .text keccak_x4_avx2_x86_64.o keccak_x4_avx2_x86_64.bin
+// Tamanho: 2208 bytes
+
+/// Shellcode x86_64 (System V) com a entrada `keccak_f1600_x4` (offset 0).
+const List<int> kKeccakX4Avx2Shellcode = [
+  0x55, 0x48, 0x89, 0xE5, 0x48, 0x83, 0xE4, 0xE0, 0x48, 0x81, 0xEC, 0x20, 0x03, 0x00, 0x00, 0x48,
+  0x8D, 0x05, 0xCA, 0x07, 0x00, 0x00, 0x31, 0xC9, 0xC5, 0xFE, 0x6F, 0x07, 0xC5, 0xFD, 0xEF, 0x87,
+  0xA0, 0x00, 0x00, 0x00, 0xC5, 0xFD, 0xEF, 0x87, 0x40, 0x01, 0x00, 0x00, 0xC5, 0xFD, 0xEF, 0x87,
+  0xE0, 0x01, 0x00, 0x00, 0xC5, 0xFD, 0xEF, 0x87, 0x80, 0x02, 0x00, 0x00, 0xC5, 0xFE, 0x6F, 0x4F,
+  0x20, 0xC5, 0xF5, 0xEF, 0x8F, 0xC0, 0x00, 0x00, 0x00, 0xC5, 0xF5, 0xEF, 0x8F, 0x60, 0x01, 0x00,
+  0x00, 0xC5, 0xF5, 0xEF, 0x8F, 0x00, 0x02, 0x00, 0x00, 0xC5, 0xF5, 0xEF, 0x8F, 0xA0, 0x02, 0x00,
+  0x00, 0xC5, 0xFE, 0x6F, 0x57, 0x40, 0xC5, 0xED, 0xEF, 0x97, 0xE0, 0x00, 0x00, 0x00, 0xC5, 0xED,
+  0xEF, 0x97, 0x80, 0x01, 0x00, 0x00, 0xC5, 0xED, 0xEF, 0x97, 0x20, 0x02, 0x00, 0x00, 0xC5, 0xED,
+  0xEF, 0x97, 0xC0, 0x02, 0x00, 0x00, 0xC5, 0xFE, 0x6F, 0x5F, 0x60, 0xC5, 0xE5, 0xEF, 0x9F, 0x00,
+  0x01, 0x00, 0x00, 0xC5, 0xE5, 0xEF, 0x9F, 0xA0, 0x01, 0x00, 0x00, 0xC5, 0xE5, 0xEF, 0x9F, 0x40,
+  0x02, 0x00, 0x00, 0xC5, 0xE5, 0xEF, 0x9F, 0xE0, 0x02, 0x00, 0x00, 0xC5, 0xFE, 0x6F, 0xA7, 0x80,
+  0x00, 0x00, 0x00, 0xC5, 0xDD, 0xEF, 0xA7, 0x20, 0x01, 0x00, 0x00, 0xC5, 0xDD, 0xEF, 0xA7, 0xC0,
+  0x01, 0x00, 0x00, 0xC5, 0xDD, 0xEF, 0xA7, 0x60, 0x02, 0x00, 0x00, 0xC5, 0xDD, 0xEF, 0xA7, 0x00,
+  0x03, 0x00, 0x00, 0xC5, 0xAD, 0x73, 0xF1, 0x01, 0xC5, 0xA5, 0x73, 0xD1, 0x3F, 0xC4, 0x41, 0x2D,
+  0xEB, 0xD3, 0xC5, 0xAD, 0xEF, 0xEC, 0xC5, 0xAD, 0x73, 0xF2, 0x01, 0xC5, 0xA5, 0x73, 0xD2, 0x3F,
+  0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0xAD, 0xEF, 0xF0, 0xC5, 0xAD, 0x73, 0xF3, 0x01, 0xC5, 0xA5,
+  0x73, 0xD3, 0x3F, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0xAD, 0xEF, 0xF9, 0xC5, 0xAD, 0x73, 0xF4,
+  0x01, 0xC5, 0xA5, 0x73, 0xD4, 0x3F, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x2D, 0xEF, 0xC2, 0xC5,
+  0xAD, 0x73, 0xF0, 0x01, 0xC5, 0xA5, 0x73, 0xD0, 0x3F, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x2D,
+  0xEF, 0xCB, 0xC5, 0x55, 0xEF, 0x17, 0xC5, 0x7D, 0x7F, 0x14, 0x24, 0xC5, 0x4D, 0xEF, 0x57, 0x20,
+  0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x01, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x3F, 0xC4, 0x41, 0x2D, 0xEB,
+  0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x40, 0x01, 0x00, 0x00, 0xC5, 0x45, 0xEF, 0x57, 0x40, 0xC4,
+  0xC1, 0x25, 0x73, 0xF2, 0x3E, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x02, 0xC4, 0x41, 0x2D, 0xEB, 0xD3,
+  0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x80, 0x02, 0x00, 0x00, 0xC5, 0x3D, 0xEF, 0x57, 0x60, 0xC4, 0xC1,
+  0x25, 0x73, 0xF2, 0x1C, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x24, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5,
+  0x7D, 0x7F, 0x94, 0x24, 0xA0, 0x00, 0x00, 0x00, 0xC5, 0x35, 0xEF, 0x97, 0x80, 0x00, 0x00, 0x00,
+  0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x1B, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x25, 0xC4, 0x41, 0x2D, 0xEB,
+  0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xE0, 0x01, 0x00, 0x00, 0xC5, 0x55, 0xEF, 0x97, 0xA0, 0x00,
+  0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x24, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x1C, 0xC4, 0x41,
+  0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x00, 0x02, 0x00, 0x00, 0xC5, 0x4D, 0xEF, 0x97,
+  0xC0, 0x00, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x2C, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x14,
+  0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x54, 0x24, 0x20, 0xC5, 0x45, 0xEF, 0x97, 0xE0,
+  0x00, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x06, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x3A, 0xC4,
+  0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x60, 0x01, 0x00, 0x00, 0xC5, 0x3D, 0xEF,
+  0x97, 0x00, 0x01, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x37, 0xC4, 0xC1, 0x2D, 0x73, 0xD2,
+  0x09, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xA0, 0x02, 0x00, 0x00, 0xC5,
+  0x35, 0xEF, 0x97, 0x20, 0x01, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x14, 0xC4, 0xC1, 0x2D,
+  0x73, 0xD2, 0x2C, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xC0, 0x00, 0x00,
+  0x00, 0xC5, 0x55, 0xEF, 0x97, 0x40, 0x01, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x03, 0xC4,
+  0xC1, 0x2D, 0x73, 0xD2, 0x3D, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xE0,
+  0x00, 0x00, 0x00, 0xC5, 0x4D, 0xEF, 0x97, 0x60, 0x01, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2,
+  0x0A, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x36, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94,
+  0x24, 0x20, 0x02, 0x00, 0x00, 0xC5, 0x45, 0xEF, 0x97, 0x80, 0x01, 0x00, 0x00, 0xC4, 0xC1, 0x25,
+  0x73, 0xF2, 0x2B, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x15, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D,
+  0x7F, 0x54, 0x24, 0x40, 0xC5, 0x3D, 0xEF, 0x97, 0xA0, 0x01, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73,
+  0xF2, 0x19, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x27, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F,
+  0x94, 0x24, 0x80, 0x01, 0x00, 0x00, 0xC5, 0x35, 0xEF, 0x97, 0xC0, 0x01, 0x00, 0x00, 0xC4, 0xC1,
+  0x25, 0x73, 0xF2, 0x27, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x19, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5,
+  0x7D, 0x7F, 0x94, 0x24, 0xC0, 0x02, 0x00, 0x00, 0xC5, 0x55, 0xEF, 0x97, 0xE0, 0x01, 0x00, 0x00,
+  0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x29, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x17, 0xC4, 0x41, 0x2D, 0xEB,
+  0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xE0, 0x02, 0x00, 0x00, 0xC5, 0x4D, 0xEF, 0x97, 0x00, 0x02,
+  0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x2D, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x13, 0xC4, 0x41,
+  0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x00, 0x01, 0x00, 0x00, 0xC5, 0x45, 0xEF, 0x97,
+  0x20, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x0F, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x31,
+  0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x40, 0x02, 0x00, 0x00, 0xC5, 0x3D,
+  0xEF, 0x97, 0x40, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x15, 0xC4, 0xC1, 0x2D, 0x73,
+  0xD2, 0x2B, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x54, 0x24, 0x60, 0xC5, 0x35, 0xEF,
+  0x97, 0x60, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x08, 0xC4, 0xC1, 0x2D, 0x73, 0xD2,
+  0x38, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xA0, 0x01, 0x00, 0x00, 0xC5,
+  0x55, 0xEF, 0x97, 0x80, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x12, 0xC4, 0xC1, 0x2D,
+  0x73, 0xD2, 0x2E, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xC0, 0x01, 0x00,
+  0x00, 0xC5, 0x4D, 0xEF, 0x97, 0xA0, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2, 0x02, 0xC4,
+  0xC1, 0x2D, 0x73, 0xD2, 0x3E, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x00,
+  0x03, 0x00, 0x00, 0xC5, 0x45, 0xEF, 0x97, 0xC0, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x25, 0x73, 0xF2,
+  0x3D, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x03, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D, 0x7F, 0x94,
+  0x24, 0x20, 0x01, 0x00, 0x00, 0xC5, 0x3D, 0xEF, 0x97, 0xE0, 0x02, 0x00, 0x00, 0xC4, 0xC1, 0x25,
+  0x73, 0xF2, 0x38, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x08, 0xC4, 0x41, 0x2D, 0xEB, 0xD3, 0xC5, 0x7D,
+  0x7F, 0x94, 0x24, 0x60, 0x02, 0x00, 0x00, 0xC5, 0x35, 0xEF, 0x97, 0x00, 0x03, 0x00, 0x00, 0xC4,
+  0xC1, 0x25, 0x73, 0xF2, 0x0E, 0xC4, 0xC1, 0x2D, 0x73, 0xD2, 0x32, 0xC4, 0x41, 0x2D, 0xEB, 0xD3,
+  0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x80, 0x00, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0x14, 0x24, 0xC5, 0x7D,
+  0x6F, 0x5C, 0x24, 0x20, 0xC5, 0x7D, 0x6F, 0x64, 0x24, 0x40, 0xC5, 0x7D, 0x6F, 0x6C, 0x24, 0x60,
+  0xC5, 0x7D, 0x6F, 0xB4, 0x24, 0x80, 0x00, 0x00, 0x00, 0xC4, 0x41, 0x25, 0xDF, 0xFC, 0xC4, 0x41,
+  0x05, 0xEF, 0xFA, 0xC5, 0x7E, 0x7F, 0x3F, 0xC4, 0x41, 0x1D, 0xDF, 0xFD, 0xC4, 0x41, 0x05, 0xEF,
+  0xFB, 0xC5, 0x7E, 0x7F, 0x7F, 0x20, 0xC4, 0x41, 0x15, 0xDF, 0xFE, 0xC4, 0x41, 0x05, 0xEF, 0xFC,
+  0xC5, 0x7E, 0x7F, 0x7F, 0x40, 0xC4, 0x41, 0x0D, 0xDF, 0xFA, 0xC4, 0x41, 0x05, 0xEF, 0xFD, 0xC5,
+  0x7E, 0x7F, 0x7F, 0x60, 0xC4, 0x41, 0x2D, 0xDF, 0xFB, 0xC4, 0x41, 0x05, 0xEF, 0xFE, 0xC5, 0x7E,
+  0x7F, 0xBF, 0x80, 0x00, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0x94, 0x24, 0xA0, 0x00, 0x00, 0x00, 0xC5,
+  0x7D, 0x6F, 0x9C, 0x24, 0xC0, 0x00, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xA4, 0x24, 0xE0, 0x00, 0x00,
+  0x00, 0xC5, 0x7D, 0x6F, 0xAC, 0x24, 0x00, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xB4, 0x24, 0x20,
+  0x01, 0x00, 0x00, 0xC4, 0x41, 0x25, 0xDF, 0xFC, 0xC4, 0x41, 0x05, 0xEF, 0xFA, 0xC5, 0x7E, 0x7F,
+  0xBF, 0xA0, 0x00, 0x00, 0x00, 0xC4, 0x41, 0x1D, 0xDF, 0xFD, 0xC4, 0x41, 0x05, 0xEF, 0xFB, 0xC5,
+  0x7E, 0x7F, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0xC4, 0x41, 0x15, 0xDF, 0xFE, 0xC4, 0x41, 0x05, 0xEF,
+  0xFC, 0xC5, 0x7E, 0x7F, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0xC4, 0x41, 0x0D, 0xDF, 0xFA, 0xC4, 0x41,
+  0x05, 0xEF, 0xFD, 0xC5, 0x7E, 0x7F, 0xBF, 0x00, 0x01, 0x00, 0x00, 0xC4, 0x41, 0x2D, 0xDF, 0xFB,
+  0xC4, 0x41, 0x05, 0xEF, 0xFE, 0xC5, 0x7E, 0x7F, 0xBF, 0x20, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x6F,
+  0x94, 0x24, 0x40, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0x9C, 0x24, 0x60, 0x01, 0x00, 0x00, 0xC5,
+  0x7D, 0x6F, 0xA4, 0x24, 0x80, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xAC, 0x24, 0xA0, 0x01, 0x00,
+  0x00, 0xC5, 0x7D, 0x6F, 0xB4, 0x24, 0xC0, 0x01, 0x00, 0x00, 0xC4, 0x41, 0x25, 0xDF, 0xFC, 0xC4,
+  0x41, 0x05, 0xEF, 0xFA, 0xC5, 0x7E, 0x7F, 0xBF, 0x40, 0x01, 0x00, 0x00, 0xC4, 0x41, 0x1D, 0xDF,
+  0xFD, 0xC4, 0x41, 0x05, 0xEF, 0xFB, 0xC5, 0x7E, 0x7F, 0xBF, 0x60, 0x01, 0x00, 0x00, 0xC4, 0x41,
+  0x15, 0xDF, 0xFE, 0xC4, 0x41, 0x05, 0xEF, 0xFC, 0xC5, 0x7E, 0x7F, 0xBF, 0x80, 0x01, 0x00, 0x00,
+  0xC4, 0x41, 0x0D, 0xDF, 0xFA, 0xC4, 0x41, 0x05, 0xEF, 0xFD, 0xC5, 0x7E, 0x7F, 0xBF, 0xA0, 0x01,
+  0x00, 0x00, 0xC4, 0x41, 0x2D, 0xDF, 0xFB, 0xC4, 0x41, 0x05, 0xEF, 0xFE, 0xC5, 0x7E, 0x7F, 0xBF,
+  0xC0, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0x94, 0x24, 0xE0, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x6F,
+  0x9C, 0x24, 0x00, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xA4, 0x24, 0x20, 0x02, 0x00, 0x00, 0xC5,
+  0x7D, 0x6F, 0xAC, 0x24, 0x40, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xB4, 0x24, 0x60, 0x02, 0x00,
+  0x00, 0xC4, 0x41, 0x25, 0xDF, 0xFC, 0xC4, 0x41, 0x05, 0xEF, 0xFA, 0xC5, 0x7E, 0x7F, 0xBF, 0xE0,
+  0x01, 0x00, 0x00, 0xC4, 0x41, 0x1D, 0xDF, 0xFD, 0xC4, 0x41, 0x05, 0xEF, 0xFB, 0xC5, 0x7E, 0x7F,
+  0xBF, 0x00, 0x02, 0x00, 0x00, 0xC4, 0x41, 0x15, 0xDF, 0xFE, 0xC4, 0x41, 0x05, 0xEF, 0xFC, 0xC5,
+  0x7E, 0x7F, 0xBF, 0x20, 0x02, 0x00, 0x00, 0xC4, 0x41, 0x0D, 0xDF, 0xFA, 0xC4, 0x41, 0x05, 0xEF,
+  0xFD, 0xC5, 0x7E, 0x7F, 0xBF, 0x40, 0x02, 0x00, 0x00, 0xC4, 0x41, 0x2D, 0xDF, 0xFB, 0xC4, 0x41,
+  0x05, 0xEF, 0xFE, 0xC5, 0x7E, 0x7F, 0xBF, 0x60, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0x94, 0x24,
+  0x80, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0x9C, 0x24, 0xA0, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x6F,
+  0xA4, 0x24, 0xC0, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x6F, 0xAC, 0x24, 0xE0, 0x02, 0x00, 0x00, 0xC5,
+  0x7D, 0x6F, 0xB4, 0x24, 0x00, 0x03, 0x00, 0x00, 0xC4, 0x41, 0x25, 0xDF, 0xFC, 0xC4, 0x41, 0x05,
+  0xEF, 0xFA, 0xC5, 0x7E, 0x7F, 0xBF, 0x80, 0x02, 0x00, 0x00, 0xC4, 0x41, 0x1D, 0xDF, 0xFD, 0xC4,
+  0x41, 0x05, 0xEF, 0xFB, 0xC5, 0x7E, 0x7F, 0xBF, 0xA0, 0x02, 0x00, 0x00, 0xC4, 0x41, 0x15, 0xDF,
+  0xFE, 0xC4, 0x41, 0x05, 0xEF, 0xFC, 0xC5, 0x7E, 0x7F, 0xBF, 0xC0, 0x02, 0x00, 0x00, 0xC4, 0x41,
+  0x0D, 0xDF, 0xFA, 0xC4, 0x41, 0x05, 0xEF, 0xFD, 0xC5, 0x7E, 0x7F, 0xBF, 0xE0, 0x02, 0x00, 0x00,
+  0xC4, 0x41, 0x2D, 0xDF, 0xFB, 0xC4, 0x41, 0x05, 0xEF, 0xFE, 0xC5, 0x7E, 0x7F, 0xBF, 0x00, 0x03,
+  0x00, 0x00, 0xC4, 0x62, 0x7D, 0x59, 0x1C, 0xC8, 0xC5, 0x25, 0xEF, 0x17, 0xC5, 0x7E, 0x7F, 0x17,
+  0xFF, 0xC1, 0x83, 0xF9, 0x18, 0x0F, 0x85, 0x1D, 0xF9, 0xFF, 0xFF, 0xC4, 0x41, 0x2D, 0xEF, 0xD2,
+  0xC5, 0x7D, 0x7F, 0x14, 0x24, 0xC5, 0x7D, 0x7F, 0x54, 0x24, 0x20, 0xC5, 0x7D, 0x7F, 0x54, 0x24,
+  0x40, 0xC5, 0x7D, 0x7F, 0x54, 0x24, 0x60, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x80, 0x00, 0x00, 0x00,
+  0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xA0, 0x00, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xC0, 0x00,
+  0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xE0, 0x00, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24,
+  0x00, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x20, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F,
+  0x94, 0x24, 0x40, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x60, 0x01, 0x00, 0x00, 0xC5,
+  0x7D, 0x7F, 0x94, 0x24, 0x80, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xA0, 0x01, 0x00,
+  0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xC0, 0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xE0,
+  0x01, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x00, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94,
+  0x24, 0x20, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x40, 0x02, 0x00, 0x00, 0xC5, 0x7D,
+  0x7F, 0x94, 0x24, 0x60, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0x80, 0x02, 0x00, 0x00,
+  0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xA0, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xC0, 0x02,
+  0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24, 0xE0, 0x02, 0x00, 0x00, 0xC5, 0x7D, 0x7F, 0x94, 0x24,
+  0x00, 0x03, 0x00, 0x00, 0xC5, 0xFC, 0x77, 0x48, 0x89, 0xEC, 0x5D, 0xC3, 0x0F, 0x1F, 0x40, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+  0x8B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x81, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x09, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x09, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x8B, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x89, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+  0x81, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80,
+];
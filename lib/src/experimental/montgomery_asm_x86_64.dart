@@ -2,12 +2,14 @@
 //
 // Montgomery modPow otimizado usando shellcodes C compilados para x86_64
 // 
-// Suporta dois modos:
+// Suporta três modos:
 // - 256-bit (4 limbs): shellcode otimizado (23KB) com sliding-window
-// - Genérico (qualquer tamanho): shellcode (2KB) com exponenciação binária
+// - MULX/ADX (5 a 64 limbs, até 4096 bits): asm/mont_modpow_mulx_x86_64.S,
+//   janela fixa com tabela espalhada em tempo constante e quadrado dedicado
+// - Genérico (até 16 limbs): shellcode (2KB) com exponenciação binária
 //
 // Os shellcodes implementam modPow completo internamente (Montgomery + exponenciação)
-// Compatível com: Qualquer CPU x86_64 (Windows/Linux)
+// Compatível com: Qualquer CPU x86_64 (Windows/Linux); o modo MULX exige BMI2 + ADX
 
 // ignore_for_file: unused_field
 
@@ -20,6 +22,8 @@ import 'package:ffi/ffi.dart' as pkg_ffi;
 import 'rijndael_fast_asm_x86_64.dart' show ExecutableMemory;
 import 'montgomery_modpow_256_bit_shellcode.dart';
 import 'montgomery_modpow_generic_shellcode.dart';
+import 'montgomery_modpow_mulx_shellcode_x86_64.dart';
+import 'win64_thunk_x86_64.dart';
 
 // ============================================================================
 // FFI Types
@@ -69,6 +73,40 @@ typedef _MontModPowGenericDart = void Function(
   int numLimbs,
 );
 
+/// Assinatura do kernel MULX (System V; thunk no Windows):
+/// void mont_modpow_mulx(uint64_t *out, const uint64_t *base, const uint64_t *exp, uint64_t *ctx)
+typedef _MontModPowMulxNative = ffi.Void Function(
+  ffi.Pointer<ffi.Uint64> out,
+  ffi.Pointer<ffi.Uint64> base,
+  ffi.Pointer<ffi.Uint64> exp,
+  ffi.Pointer<ffi.Uint64> ctx,
+);
+
+typedef _MontModPowMulxDart = void Function(
+  ffi.Pointer<ffi.Uint64> out,
+  ffi.Pointer<ffi.Uint64> base,
+  ffi.Pointer<ffi.Uint64> exp,
+  ffi.Pointer<ffi.Uint64> ctx,
+);
+
+/// Kernel MULX carregado uma vez e compartilhado por todos os contextos
+ExecutableMemory? _mulxCode;
+_MontModPowMulxDart? _mulxModPow;
+
+_MontModPowMulxDart _loadMulxKernel() {
+  if (_mulxModPow != null) return _mulxModPow!;
+  if (Platform.isWindows) {
+    _mulxCode = ExecutableMemory.allocate(Uint8List.fromList([
+      ...windowsSysVThunk(kWindowsThunkSize - kWindowsThunkCallEnd),
+      ...kMontgomeryModPowMulxShellcode,
+    ]));
+  } else {
+    _mulxCode = ExecutableMemory.allocate(Uint8List.fromList(kMontgomeryModPowMulxShellcode));
+  }
+  _mulxModPow = _mulxCode!.pointer.cast<ffi.NativeFunction<_MontModPowMulxNative>>().asFunction<_MontModPowMulxDart>(isLeaf: true);
+  return _mulxModPow!;
+}
+
 // ============================================================================
 // Shellcode compilado de C (mont_modpow_*.c)
 // ============================================================================
@@ -185,6 +223,22 @@ class MontgomeryAsmContext {
   ffi.Pointer<ffi.Uint64>? _bufAcc;
   ffi.Pointer<ffi.Uint64>? _bufBase;
 
+  // Kernel MULX: bloco de contexto (n, R^2, temporários e tabela) e buffers
+  // de base/saída com [_mulxLimbs] limbs, mais o buffer do expoente
+  _MontModPowMulxDart? _modpowMulx;
+  int _mulxLimbs = 0;
+  ffi.Pointer<ffi.Uint64>? _mulxCtx;
+  ffi.Pointer<ffi.Uint64>? _mulxBase;
+  ffi.Pointer<ffi.Uint64>? _mulxOut;
+  ffi.Pointer<ffi.Uint64>? _mulxExp;
+  int _mulxExpCapacity = 0;
+
+  /// Limbs suportados pelo kernel MULX
+  static const int mulxMaxLimbs = 64;
+
+  /// Verdadeiro quando [modPow] usa o kernel MULX/ADX
+  bool get usesMulxKernel => _modpowMulx != null;
+
   // Buffers de trabalho para modPow (reutilizáveis)
   Uint64List? _workAcc;
   Uint64List? _workTemp;
@@ -211,6 +265,15 @@ class MontgomeryAsmContext {
 
     if (!MontgomeryAsmSupport.isAsmSupported) return;
 
+    if (numLimbs > 4 && numLimbs <= mulxMaxLimbs && MontgomeryAsmSupport.isModernSupported) {
+      try {
+        _initMulx();
+        return;
+      } catch (e) {
+        _modpowMulx = null;
+      }
+    }
+
     try {
       if (numLimbs == 4) {
         // Shellcode otimizado para 256-bit com modPow integrado
@@ -248,6 +311,39 @@ class MontgomeryAsmContext {
     }
   }
 
+  /// Prepara o bloco de contexto do kernel MULX. O número de limbs é
+  /// arredondado para múltiplo de 4 (limbs altos zerados); R passa a ser
+  /// 2^(64 * limbs arredondados), então R^2 mod n é recalculado.
+  void _initMulx() {
+    final limbs = (numLimbs + 3) & ~3;
+    final ctxWords = 71 + 7 * limbs + 64 * limbs;
+    final ctx = pkg_ffi.calloc<ffi.Uint64>(ctxWords);
+    final words = ctx.asTypedList(ctxWords);
+    words[0] = limbs;
+    words[1] = n0;
+    for (var i = 0; i < numLimbs; i++) {
+      words[4 + i] = modulus[i];
+    }
+    final rrPadded = limbs == numLimbs ? rr : _computeRR64(modulus, numLimbs, limbs);
+    for (var i = 0; i < limbs; i++) {
+      words[4 + limbs + i] = rrPadded[i];
+    }
+    _mulxLimbs = limbs;
+    _mulxCtx = ctx;
+    _mulxBase = pkg_ffi.calloc<ffi.Uint64>(limbs);
+    _mulxOut = pkg_ffi.calloc<ffi.Uint64>(limbs);
+    _modpowMulx = _loadMulxKernel();
+  }
+
+  /// Janela fixa por tamanho do expoente (tabela de 2^w entradas)
+  static int _mulxWindow(int bits) {
+    if (bits >= 1536) return 6;
+    if (bits >= 384) return 5;
+    if (bits >= 96) return 4;
+    if (bits >= 24) return 3;
+    return 1;
+  }
+
   factory MontgomeryAsmContext.fromModulus(Uint8List modulusBytes) {
     final numLimbs = (modulusBytes.length + 7) ~/ 8;
     final modulus = _bytesToLimbs64(modulusBytes, numLimbs);
@@ -373,6 +469,11 @@ class MontgomeryAsmContext {
       return _modPowAsm256(baseBytes, expBytes);
     }
     
+    // Kernel MULX/ADX: 5 a 64 limbs
+    if (_modpowMulx != null) {
+      return _modPowMulx(baseBytes, expBytes);
+    }
+
     // Shellcode genérico para tamanhos até 1024-bit (16 limbs)
     // MAX_LIMBS no código C é 16
     if (_modpowGenericAsm != null && numLimbs <= 16) {
@@ -473,6 +574,94 @@ class MontgomeryAsmContext {
     return _limbs64ToBytes(result, numLimbs);
   }
   
+  /// modPow com o kernel MULX. O tempo depende só do tamanho do módulo e
+  /// do comprimento de [expBytes] (zeros à esquerda contam), não dos bits.
+  Uint8List _modPowMulx(Uint8List baseBytes, Uint8List expBytes) {
+    final limbs = _mulxLimbs;
+    final bits = expBytes.length * 8;
+    if (_isZero(expBytes)) {
+      return _limbs64ToBytes(Uint64List(numLimbs)..[0] = 1, numLimbs);
+    }
+
+    // Base reduzida (< n) nos limbs baixos; os altos ficam em zero
+    final baseList = _mulxBase!.asTypedList(limbs);
+    baseList.fillRange(0, limbs, 0);
+    final base = baseBytes.length <= numLimbs * 8 ? _packLimbs64(baseBytes, numLimbs) : null;
+    if (base == null || _cmpUnsigned(base, modulus) >= 0) {
+      final reduced = _bytesToBigIntUnsigned(baseBytes) % _limbsToBigInt(modulus);
+      baseList.setRange(0, numLimbs, _bigIntToLimbs64(reduced, numLimbs));
+    } else {
+      baseList.setRange(0, numLimbs, base);
+    }
+
+    // Expoente com um limb extra em zero
+    final expLimbs = (bits + 63) ~/ 64 + 1;
+    if (expLimbs > _mulxExpCapacity) {
+      if (_mulxExp != null) pkg_ffi.calloc.free(_mulxExp!);
+      _mulxExp = pkg_ffi.calloc<ffi.Uint64>(expLimbs);
+      _mulxExpCapacity = expLimbs;
+    }
+    final expList = _mulxExp!.asTypedList(_mulxExpCapacity);
+    expList.fillRange(0, _mulxExpCapacity, 0);
+    expList.setRange(0, expLimbs - 1, _packLimbs64(expBytes, expLimbs - 1));
+
+    final ctx = _mulxCtx!.asTypedList(4);
+    ctx[2] = bits;
+    ctx[3] = _mulxWindow(bits);
+    _modpowMulx!(_mulxOut!, _mulxBase!, _mulxExp!, _mulxCtx!);
+
+    final out = _mulxOut!.asTypedList(limbs);
+    final result = Uint64List(numLimbs);
+    for (var i = 0; i < numLimbs; i++) {
+      result[i] = out[i];
+    }
+    return _limbs64ToBytes(result, numLimbs);
+  }
+
+  static bool _isZero(Uint8List bytes) {
+    var acc = 0;
+    for (final b in bytes) {
+      acc |= b;
+    }
+    return acc == 0;
+  }
+
+  /// Big-endian -> limbs little-endian de 64 bits, 8 bytes por vez
+  static Uint64List _packLimbs64(Uint8List bytes, int numLimbs) {
+    final limbs = Uint64List(numLimbs);
+    for (var i = 0; i < bytes.length; i++) {
+      final pos = bytes.length - 1 - i;
+      limbs[i >> 3] |= bytes[pos] << ((i & 7) * 8);
+    }
+    return limbs;
+  }
+
+  static BigInt _bytesToBigIntUnsigned(Uint8List bytes) {
+    var result = BigInt.zero;
+    for (final b in bytes) {
+      result = (result << 8) | BigInt.from(b);
+    }
+    return result;
+  }
+
+  static BigInt _limbsToBigInt(Uint64List limbs) {
+    var result = BigInt.zero;
+    for (var i = limbs.length - 1; i >= 0; i--) {
+      result = (result << 64) | BigInt.from(limbs[i]).toUnsigned(64);
+    }
+    return result;
+  }
+
+  static Uint64List _bigIntToLimbs64(BigInt value, int numLimbs) {
+    final limbs = Uint64List(numLimbs);
+    final mask64 = (BigInt.one << 64) - BigInt.one;
+    for (var i = 0; i < numLimbs; i++) {
+      limbs[i] = (value & mask64).toSigned(64).toInt();
+      value >>= 64;
+    }
+    return limbs;
+  }
+
   /// modPow fallback usando BigInt (para tamanhos > 1024-bit ou sem shellcode)
   Uint8List _modPowDart(Uint8List baseBytes, Uint8List expBytes) {
     // Converte para BigInt
@@ -555,6 +744,10 @@ class MontgomeryAsmContext {
     if (_bufN != null) pkg_ffi.calloc.free(_bufN!);
     if (_bufAcc != null) pkg_ffi.calloc.free(_bufAcc!);
     if (_bufBase != null) pkg_ffi.calloc.free(_bufBase!);
+    if (_mulxCtx != null) pkg_ffi.calloc.free(_mulxCtx!);
+    if (_mulxBase != null) pkg_ffi.calloc.free(_mulxBase!);
+    if (_mulxOut != null) pkg_ffi.calloc.free(_mulxOut!);
+    if (_mulxExp != null) pkg_ffi.calloc.free(_mulxExp!);
     _execMem?.free();
   }
 
@@ -605,20 +798,21 @@ class MontgomeryAsmContext {
     return (-x) & 0xFFFFFFFF;
   }
 
-  static Uint64List _computeRR64(Uint64List mod, int numLimbs) {
-    // Calcula R^2 mod n onde R = 2^(numLimbs*64)
+  static Uint64List _computeRR64(Uint64List mod, int numLimbs, [int? rLimbs]) {
+    // Calcula R^2 mod n onde R = 2^(rLimbs*64) (por padrão rLimbs = numLimbs)
+    rLimbs ??= numLimbs;
     // Usa BigInt apenas no setup (roda uma vez)
     BigInt mVal = BigInt.zero;
     for (int i = numLimbs - 1; i >= 0; i--) {
       mVal = (mVal << 64) | BigInt.from(mod[i]).toUnsigned(64);
     }
 
-    BigInt r = BigInt.one << (numLimbs * 64);
+    BigInt r = BigInt.one << (rLimbs * 64);
     BigInt rrVal = (r * r) % mVal;
 
-    final rr = Uint64List(numLimbs);
+    final rr = Uint64List(rLimbs);
     final mask64 = BigInt.parse('FFFFFFFFFFFFFFFF', radix: 16);
-    for (int i = 0; i < numLimbs; i++) {
+    for (int i = 0; i < rLimbs; i++) {
       rr[i] = (rrVal & mask64).toSigned(64).toInt();
       rrVal >>= 64;
     }
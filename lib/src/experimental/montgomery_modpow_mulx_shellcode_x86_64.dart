@@ -0,0 +1,106 @@
+// dart format width=5000
+// AUTO-GENERATED - DO NOT EDIT
+// Shellcode montado de asm/mont_modpow_mulx_x86_64.S
+//   as --64 -o mont_modpow_mulx_x86_64.o mont_modpow_mulx_x86_64.S
+//   objcopy -O binary -j .text mont_modpow_mulx_x86_64.o mont_modpow_mulx_x86_64.bin
+// Tamanho: 1536 bytes
+
+/// Shellcode x86_64 (System V) com a entrada `mont_modpow_mulx` (offset 0).
+const List<int> kMontgomeryModPowMulxShellcode = [
+  0x53, 0x55, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57, 0x48, 0x83, 0xEC, 0x48, 0x48, 0x89,
+  0x3C, 0x24, 0x48, 0x89, 0x74, 0x24, 0x08, 0x48, 0x89, 0x54, 0x24, 0x10, 0x49, 0x89, 0xCF, 0x49,
+  0x8B, 0x1F, 0x49, 0x8D, 0x6C, 0xDF, 0x28, 0x48, 0x8D, 0x6C, 0xDD, 0x00, 0x48, 0x8D, 0x04, 0x5B,
+  0x48, 0x8D, 0x44, 0xC5, 0x10, 0x48, 0x89, 0x44, 0x24, 0x18, 0x48, 0x8D, 0x04, 0xD8, 0x48, 0x89,
+  0x44, 0x24, 0x20, 0x49, 0x8B, 0x4F, 0x18, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x48, 0xD3, 0xE0, 0x48,
+  0x89, 0x44, 0x24, 0x30, 0x48, 0x8B, 0x7C, 0x24, 0x20, 0x48, 0x89, 0xD9, 0x31, 0xC0, 0xF3, 0x48,
+  0xAB, 0x48, 0x8B, 0x44, 0x24, 0x20, 0x48, 0xC7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x49, 0x89, 0xC4,
+  0x4D, 0x8D, 0x6C, 0xDF, 0x20, 0x4C, 0x8B, 0x74, 0x24, 0x18, 0xE8, 0x76, 0x01, 0x00, 0x00, 0x4C,
+  0x8B, 0x64, 0x24, 0x18, 0x31, 0xC0, 0xE8, 0xEE, 0x04, 0x00, 0x00, 0x4C, 0x8B, 0x64, 0x24, 0x08,
+  0x4D, 0x8D, 0x6C, 0xDF, 0x20, 0x4C, 0x8B, 0x74, 0x24, 0x20, 0xE8, 0x56, 0x01, 0x00, 0x00, 0x4C,
+  0x8B, 0x64, 0x24, 0x20, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0xCB, 0x04, 0x00, 0x00, 0x48, 0x8B,
+  0x74, 0x24, 0x20, 0x48, 0x8B, 0x7C, 0x24, 0x18, 0x48, 0x89, 0xD9, 0xF3, 0x48, 0xA5, 0x48, 0xC7,
+  0x44, 0x24, 0x38, 0x02, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x44, 0x24, 0x38, 0x48, 0x3B, 0x44, 0x24,
+  0x30, 0x73, 0x28, 0x4C, 0x8B, 0x64, 0x24, 0x18, 0x4C, 0x8B, 0x6C, 0x24, 0x20, 0x4D, 0x89, 0xE6,
+  0xE8, 0x10, 0x01, 0x00, 0x00, 0x4C, 0x8B, 0x64, 0x24, 0x18, 0x48, 0x8B, 0x44, 0x24, 0x38, 0xE8,
+  0x85, 0x04, 0x00, 0x00, 0x48, 0xFF, 0x44, 0x24, 0x38, 0xEB, 0xCC, 0x49, 0x8B, 0x47, 0x10, 0x49,
+  0x8B, 0x4F, 0x18, 0x48, 0x8D, 0x44, 0x08, 0xFF, 0x31, 0xD2, 0x48, 0xF7, 0xF1, 0x48, 0xFF, 0xC8,
+  0x48, 0x0F, 0xAF, 0xC1, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x89, 0xC1, 0x48, 0xC1, 0xE8, 0x06,
+  0x48, 0x8B, 0x54, 0x24, 0x10, 0x4C, 0x8B, 0x44, 0xC2, 0x08, 0x48, 0x8B, 0x04, 0xC2, 0x4C, 0x0F,
+  0xAD, 0xC0, 0x48, 0x8B, 0x4C, 0x24, 0x30, 0x48, 0xFF, 0xC9, 0x48, 0x21, 0xC8, 0x4C, 0x8B, 0x74,
+  0x24, 0x18, 0xE8, 0x60, 0x04, 0x00, 0x00, 0x48, 0x8B, 0x44, 0x24, 0x28, 0x48, 0x85, 0xC0, 0x74,
+  0x6D, 0x49, 0x2B, 0x47, 0x18, 0x48, 0x89, 0x44, 0x24, 0x28, 0x49, 0x8B, 0x47, 0x18, 0x48, 0x89,
+  0x44, 0x24, 0x38, 0x4C, 0x8B, 0x64, 0x24, 0x18, 0x4D, 0x89, 0xE6, 0xE8, 0x01, 0x02, 0x00, 0x00,
+  0x48, 0xFF, 0x4C, 0x24, 0x38, 0x75, 0xEC, 0x48, 0x8B, 0x44, 0x24, 0x28, 0x48, 0x89, 0xC1, 0x48,
+  0xC1, 0xE8, 0x06, 0x48, 0x8B, 0x54, 0x24, 0x10, 0x4C, 0x8B, 0x44, 0xC2, 0x08, 0x48, 0x8B, 0x04,
+  0xC2, 0x4C, 0x0F, 0xAD, 0xC0, 0x48, 0x8B, 0x4C, 0x24, 0x30, 0x48, 0xFF, 0xC9, 0x48, 0x21, 0xC8,
+  0x4C, 0x8B, 0x74, 0x24, 0x20, 0xE8, 0xFD, 0x03, 0x00, 0x00, 0x4C, 0x8B, 0x64, 0x24, 0x18, 0x4C,
+  0x8B, 0x6C, 0x24, 0x20, 0x4D, 0x89, 0xE6, 0xE8, 0x39, 0x00, 0x00, 0x00, 0xEB, 0x89, 0x48, 0x8B,
+  0x7C, 0x24, 0x20, 0x48, 0x89, 0xD9, 0x31, 0xC0, 0xF3, 0x48, 0xAB, 0x4C, 0x8B, 0x6C, 0x24, 0x20,
+  0x49, 0xC7, 0x45, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4C, 0x8B, 0x64, 0x24, 0x18, 0x4C, 0x8B, 0x34,
+  0x24, 0xE8, 0x0F, 0x00, 0x00, 0x00, 0x48, 0x83, 0xC4, 0x48, 0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D,
+  0x41, 0x5C, 0x5D, 0x5B, 0xC3, 0x48, 0x8D, 0x4B, 0x02, 0x48, 0x89, 0xEF, 0x31, 0xC0, 0xF3, 0x48,
+  0xAB, 0x45, 0x31, 0xDB, 0x4B, 0x8B, 0x14, 0xDC, 0x4C, 0x89, 0xEE, 0x48, 0x89, 0xEF, 0x48, 0x89,
+  0xD9, 0x48, 0xC1, 0xE9, 0x02, 0x45, 0x31, 0xC0, 0xC4, 0x62, 0xFB, 0xF6, 0x0E, 0x66, 0x48, 0x0F,
+  0x38, 0xF6, 0x07, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC0, 0x48, 0x89, 0x07, 0xC4, 0x62, 0xFB, 0xF6,
+  0x46, 0x08, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0x47, 0x08, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48,
+  0x89, 0x47, 0x08, 0xC4, 0x62, 0xFB, 0xF6, 0x4E, 0x10, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0x47, 0x10,
+  0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC0, 0x48, 0x89, 0x47, 0x10, 0xC4, 0x62, 0xFB, 0xF6, 0x46, 0x18,
+  0x66, 0x48, 0x0F, 0x38, 0xF6, 0x47, 0x18, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48, 0x89, 0x47,
+  0x18, 0x48, 0x8D, 0x76, 0x20, 0x48, 0x8D, 0x7F, 0x20, 0x48, 0x8D, 0x49, 0xFF, 0xE3, 0x02, 0xEB,
+  0x97, 0x41, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x07, 0x66, 0x49, 0x0F, 0x38, 0xF6, 0xC0,
+  0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48, 0x89, 0x07, 0x48, 0x8B, 0x47, 0x08, 0x66, 0x49, 0x0F,
+  0x38, 0xF6, 0xC1, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48, 0x89, 0x47, 0x08, 0x48, 0x8B, 0x55,
+  0x00, 0x49, 0x0F, 0xAF, 0x57, 0x08, 0x49, 0x8D, 0x77, 0x20, 0x48, 0x89, 0xEF, 0x48, 0x89, 0xD9,
+  0x48, 0xC1, 0xE9, 0x02, 0x45, 0x31, 0xC0, 0xC4, 0x62, 0xFB, 0xF6, 0x0E, 0x66, 0x48, 0x0F, 0x38,
+  0xF6, 0x07, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC0, 0x48, 0x89, 0x47, 0xF8, 0xC4, 0x62, 0xFB, 0xF6,
+  0x46, 0x08, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0x47, 0x08, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48,
+  0x89, 0x07, 0xC4, 0x62, 0xFB, 0xF6, 0x4E, 0x10, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0x47, 0x10, 0xF3,
+  0x49, 0x0F, 0x38, 0xF6, 0xC0, 0x48, 0x89, 0x47, 0x08, 0xC4, 0x62, 0xFB, 0xF6, 0x46, 0x18, 0x66,
+  0x48, 0x0F, 0x38, 0xF6, 0x47, 0x18, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48, 0x89, 0x47, 0x10,
+  0x48, 0x8D, 0x76, 0x20, 0x48, 0x8D, 0x7F, 0x20, 0x48, 0x8D, 0x49, 0xFF, 0xE3, 0x02, 0xEB, 0x97,
+  0x41, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x07, 0x66, 0x49, 0x0F, 0x38, 0xF6, 0xC0, 0xF3,
+  0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48, 0x89, 0x47, 0xF8, 0x48, 0x8B, 0x47, 0x08, 0x66, 0x49, 0x0F,
+  0x38, 0xF6, 0xC1, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48, 0x89, 0x07, 0x4C, 0x89, 0x4F, 0x08,
+  0x49, 0xFF, 0xC3, 0x49, 0x39, 0xDB, 0x0F, 0x82, 0x98, 0xFE, 0xFF, 0xFF, 0xE9, 0xB2, 0x01, 0x00,
+  0x00, 0x4C, 0x8D, 0x54, 0xDD, 0x10, 0x4C, 0x89, 0xD7, 0x48, 0x8D, 0x0C, 0x1B, 0x31, 0xC0, 0xF3,
+  0x48, 0xAB, 0x45, 0x31, 0xDB, 0x48, 0x8D, 0x4B, 0xFF, 0x4C, 0x29, 0xD9, 0x74, 0x56, 0x4B, 0x8B,
+  0x14, 0xDC, 0x4B, 0x8D, 0x74, 0xDC, 0x08, 0x4B, 0x8D, 0x04, 0x1B, 0x49, 0x8D, 0x7C, 0xC2, 0x08,
+  0x45, 0x31, 0xC0, 0xC4, 0x62, 0xFB, 0xF6, 0x0E, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0x07, 0xF3, 0x49,
+  0x0F, 0x38, 0xF6, 0xC0, 0x48, 0x89, 0x07, 0x4D, 0x89, 0xC8, 0x48, 0x8D, 0x76, 0x08, 0x48, 0x8D,
+  0x7F, 0x08, 0x48, 0x8D, 0x49, 0xFF, 0xE3, 0x02, 0xEB, 0xD9, 0x41, 0xB9, 0x00, 0x00, 0x00, 0x00,
+  0x66, 0x4D, 0x0F, 0x38, 0xF6, 0xC1, 0xF3, 0x4D, 0x0F, 0x38, 0xF6, 0xC1, 0x4C, 0x89, 0x07, 0x49,
+  0xFF, 0xC3, 0xEB, 0xA1, 0x4C, 0x89, 0xE6, 0x4C, 0x89, 0xD7, 0x48, 0x89, 0xD9, 0x45, 0x31, 0xC0,
+  0x48, 0x8B, 0x16, 0xC4, 0x62, 0xFB, 0xF6, 0xCA, 0x4C, 0x8B, 0x07, 0x66, 0x4D, 0x0F, 0x38, 0xF6,
+  0xC0, 0xF3, 0x4C, 0x0F, 0x38, 0xF6, 0xC0, 0x4C, 0x89, 0x07, 0x4C, 0x8B, 0x47, 0x08, 0x66, 0x4D,
+  0x0F, 0x38, 0xF6, 0xC0, 0xF3, 0x4D, 0x0F, 0x38, 0xF6, 0xC1, 0x4C, 0x89, 0x47, 0x08, 0x48, 0x8D,
+  0x76, 0x08, 0x48, 0x8D, 0x7F, 0x10, 0x48, 0x8D, 0x49, 0xFF, 0xE3, 0x02, 0xEB, 0xC2, 0x4C, 0x89,
+  0xD6, 0x48, 0x89, 0xEF, 0x48, 0x89, 0xD9, 0xF3, 0x48, 0xA5, 0x48, 0xC7, 0x44, 0xDD, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x48, 0xC7, 0x44, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x45, 0x31, 0xDB, 0x48,
+  0x8B, 0x55, 0x00, 0x49, 0x0F, 0xAF, 0x57, 0x08, 0x49, 0x8D, 0x77, 0x20, 0x48, 0x89, 0xEF, 0x48,
+  0x89, 0xD9, 0x48, 0xC1, 0xE9, 0x02, 0x45, 0x31, 0xC0, 0xC4, 0x62, 0xFB, 0xF6, 0x0E, 0x66, 0x48,
+  0x0F, 0x38, 0xF6, 0x07, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC0, 0x48, 0x89, 0x47, 0xF8, 0xC4, 0x62,
+  0xFB, 0xF6, 0x46, 0x08, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0x47, 0x08, 0xF3, 0x49, 0x0F, 0x38, 0xF6,
+  0xC1, 0x48, 0x89, 0x07, 0xC4, 0x62, 0xFB, 0xF6, 0x4E, 0x10, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0x47,
+  0x10, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC0, 0x48, 0x89, 0x47, 0x08, 0xC4, 0x62, 0xFB, 0xF6, 0x46,
+  0x18, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0x47, 0x18, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48, 0x89,
+  0x47, 0x10, 0x48, 0x8D, 0x76, 0x20, 0x48, 0x8D, 0x7F, 0x20, 0x48, 0x8D, 0x49, 0xFF, 0xE3, 0x02,
+  0xEB, 0x97, 0x41, 0xB9, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x07, 0x66, 0x49, 0x0F, 0x38, 0xF6,
+  0xC0, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48, 0x89, 0x47, 0xF8, 0x48, 0x8B, 0x47, 0x08, 0x66,
+  0x49, 0x0F, 0x38, 0xF6, 0xC1, 0xF3, 0x49, 0x0F, 0x38, 0xF6, 0xC1, 0x48, 0x89, 0x07, 0x4C, 0x89,
+  0x4F, 0x08, 0x49, 0x8D, 0x04, 0x1B, 0x49, 0x8B, 0x04, 0xC2, 0x48, 0x01, 0x44, 0xDD, 0xF8, 0x48,
+  0x83, 0x54, 0xDD, 0x00, 0x00, 0x49, 0xFF, 0xC3, 0x49, 0x39, 0xDB, 0x0F, 0x82, 0x2E, 0xFF, 0xFF,
+  0xFF, 0xEB, 0x00, 0x49, 0x8D, 0x77, 0x20, 0x48, 0x89, 0xEF, 0x4D, 0x89, 0xF2, 0x48, 0x89, 0xD9,
+  0xF8, 0x48, 0x8B, 0x07, 0x48, 0x1B, 0x06, 0x49, 0x89, 0x02, 0x48, 0x8D, 0x76, 0x08, 0x48, 0x8D,
+  0x7F, 0x08, 0x4D, 0x8D, 0x52, 0x08, 0x48, 0x8D, 0x49, 0xFF, 0xE3, 0x02, 0xEB, 0xE3, 0x48, 0x8B,
+  0x07, 0x48, 0x83, 0xD8, 0x00, 0x48, 0x19, 0xD2, 0x31, 0xC9, 0x49, 0x8B, 0x04, 0xCE, 0x4C, 0x8B,
+  0x44, 0xCD, 0x00, 0x49, 0x31, 0xC0, 0x49, 0x21, 0xD0, 0x4C, 0x31, 0xC0, 0x49, 0x89, 0x04, 0xCE,
+  0x48, 0xFF, 0xC1, 0x48, 0x39, 0xD9, 0x72, 0xE2, 0xC3, 0x48, 0x8D, 0x3C, 0x9B, 0x48, 0x8D, 0xBC,
+  0xFD, 0x10, 0x02, 0x00, 0x00, 0x48, 0x8D, 0x3C, 0xC7, 0x48, 0x8B, 0x54, 0x24, 0x38, 0x48, 0xC1,
+  0xE2, 0x03, 0x31, 0xC9, 0x49, 0x8B, 0x04, 0xCC, 0x48, 0x89, 0x07, 0x48, 0x01, 0xD7, 0x48, 0xFF,
+  0xC1, 0x48, 0x39, 0xD9, 0x72, 0xEE, 0xC3, 0x48, 0x8D, 0x3C, 0x9B, 0x48, 0x8D, 0x74, 0xFD, 0x10,
+  0x4C, 0x8B, 0x4C, 0x24, 0x38, 0x31, 0xC9, 0x31, 0xD2, 0x48, 0x39, 0xC1, 0x0F, 0x94, 0xC2, 0x48,
+  0xF7, 0xDA, 0x48, 0x89, 0x14, 0xCE, 0x48, 0xFF, 0xC1, 0x4C, 0x39, 0xC9, 0x72, 0xE9, 0x48, 0x8D,
+  0xBE, 0x00, 0x02, 0x00, 0x00, 0x45, 0x31, 0xD2, 0x31, 0xC0, 0x31, 0xC9, 0x48, 0x8B, 0x14, 0xCF,
+  0x48, 0x23, 0x14, 0xCE, 0x48, 0x09, 0xD0, 0x48, 0xFF, 0xC1, 0x4C, 0x39, 0xC9, 0x72, 0xED, 0x4B,
+  0x89, 0x04, 0xD6, 0x4A, 0x8D, 0x3C, 0xCF, 0x49, 0xFF, 0xC2, 0x49, 0x39, 0xDA, 0x72, 0xD9, 0xC3,
+];
@@ -16,6 +16,8 @@ import 'dart:io' show Platform;
 import 'dart:typed_data';
 import 'package:ffi/ffi.dart' as pkgffi;
 
+import '../utils/aes.dart';
+
 /// Verifica se a plataforma suporta AES-NI
 class AesNiSupport {
   static bool? _supported;
@@ -1433,6 +1435,74 @@ class RijndaelAsmX8664 {
   }
 }
 
+/// AES-CBC sobre [RijndaelAsmX8664]; mesma API de `Dart_AES`
+///
+/// Selecionado por `createAES(key, iv, implementations: ['asm-x86_64', ...])`.
+/// O encadeamento fica em Dart e cada bloco é uma chamada ao shellcode
+/// AES-NI, sem alocação por bloco. Os buffers nativos são liberados por
+/// [dispose] ou quando a instância é coletada.
+class AesCbcAsm extends AES {
+  static final Finalizer<RijndaelAsmX8664> _finalizer = Finalizer((rijndael) => rijndael.dispose());
+
+  final RijndaelAsmX8664 _rijndael;
+  final Uint8List _block = Uint8List(16);
+
+  AesCbcAsm(Uint8List key, Uint8List iv)
+      : _rijndael = RijndaelAsmX8664(key),
+        super(Uint8List.fromList(key), aesModeCBC, Uint8List.fromList(iv), 'asm-x86_64') {
+    _finalizer.attach(this, _rijndael, detach: this);
+  }
+
+  /// Verdadeiro quando AES-NI está disponível
+  static bool get isSupported => AesNiSupport.isSupported;
+
+  @override
+  Uint8List encrypt(Uint8List plaintext) {
+    if (plaintext.length % 16 != 0) {
+      throw ArgumentError('Plaintext length must be a multiple of 16 bytes for CBC');
+    }
+    final out = Uint8List(plaintext.length);
+    final block = _block;
+    var chain = iv;
+    for (int i = 0; i < plaintext.length; i += 16) {
+      for (int j = 0; j < 16; j++) {
+        block[j] = plaintext[i + j] ^ chain[j];
+      }
+      final outBlock = Uint8List.sublistView(out, i, i + 16);
+      _rijndael.encryptInto(block, outBlock);
+      chain = outBlock;
+    }
+    iv = Uint8List.fromList(chain);
+    return out;
+  }
+
+  @override
+  Uint8List decrypt(Uint8List ciphertext) {
+    if (ciphertext.length % 16 != 0) {
+      throw ArgumentError('Ciphertext length must be a multiple of 16 bytes for CBC');
+    }
+    final out = Uint8List(ciphertext.length);
+    final block = _block;
+    var chain = iv;
+    for (int i = 0; i < ciphertext.length; i += 16) {
+      final inBlock = Uint8List.sublistView(ciphertext, i, i + 16);
+      _rijndael.decryptInto(inBlock, block);
+      for (int j = 0; j < 16; j++) {
+        out[i + j] = block[j] ^ chain[j];
+      }
+      chain = inBlock;
+    }
+    iv = Uint8List.fromList(chain);
+    return out;
+  }
+
+  /// Libera os buffers nativos e o shellcode
+  void dispose() {
+    _finalizer.detach(this);
+    _rijndael.dispose();
+  }
+}
+
 // --- Funções Helper ---
 
 /// Encripta um bloco usando AES-NI se disponível
@@ -0,0 +1,56 @@
+// dart format width=5000
+//
+// Thunk de entrada Windows x64 para shellcode escrito na ABI System V
+//
+// Os kernels em asm/*.S seguem a System V AMD64 ABI; no Windows cada entrada
+// recebe um destes thunks antes do corpo, no mesmo bloco executável.
+
+/// Tamanho do thunk gerado por [windowsSysVThunk]
+const int kWindowsThunkSize = 182;
+
+/// Offset, dentro do thunk, do fim da instrução `call rel32`
+const int kWindowsThunkCallEnd = 0x63;
+
+/// Thunk Windows x64 -> System V: salva rdi, rsi e xmm6-xmm15 (não
+/// voláteis no Windows), move rcx, rdx, r8, r9 para rdi, rsi, rdx, rcx e
+/// chama o corpo em `fim do call + callDisplacement`.
+List<int> windowsSysVThunk(int callDisplacement) {
+  return [
+    0x57, // push rdi
+    0x56, // push rsi
+    0x48, 0x81, 0xEC, 0xA8, 0x00, 0x00, 0x00, // sub rsp, 168
+    0xF3, 0x0F, 0x7F, 0x34, 0x24, // movdqu [rsp], xmm6
+    0xF3, 0x0F, 0x7F, 0x7C, 0x24, 0x10, // movdqu [rsp+16], xmm7
+    0xF3, 0x44, 0x0F, 0x7F, 0x44, 0x24, 0x20, // movdqu [rsp+32], xmm8
+    0xF3, 0x44, 0x0F, 0x7F, 0x4C, 0x24, 0x30, // movdqu [rsp+48], xmm9
+    0xF3, 0x44, 0x0F, 0x7F, 0x54, 0x24, 0x40, // movdqu [rsp+64], xmm10
+    0xF3, 0x44, 0x0F, 0x7F, 0x5C, 0x24, 0x50, // movdqu [rsp+80], xmm11
+    0xF3, 0x44, 0x0F, 0x7F, 0x64, 0x24, 0x60, // movdqu [rsp+96], xmm12
+    0xF3, 0x44, 0x0F, 0x7F, 0x6C, 0x24, 0x70, // movdqu [rsp+112], xmm13
+    0xF3, 0x44, 0x0F, 0x7F, 0xB4, 0x24, 0x80, 0x00, 0x00, 0x00, // movdqu [rsp+128], xmm14
+    0xF3, 0x44, 0x0F, 0x7F, 0xBC, 0x24, 0x90, 0x00, 0x00, 0x00, // movdqu [rsp+144], xmm15
+    0x48, 0x89, 0xCF, // mov rdi, rcx
+    0x48, 0x89, 0xD6, // mov rsi, rdx
+    0x4C, 0x89, 0xC2, // mov rdx, r8
+    0x4C, 0x89, 0xC9, // mov rcx, r9
+    0xE8, // call rel32
+    callDisplacement & 0xFF,
+    (callDisplacement >> 8) & 0xFF,
+    (callDisplacement >> 16) & 0xFF,
+    (callDisplacement >> 24) & 0xFF,
+    0xF3, 0x0F, 0x6F, 0x34, 0x24, // movdqu xmm6, [rsp]
+    0xF3, 0x0F, 0x6F, 0x7C, 0x24, 0x10, // movdqu xmm7, [rsp+16]
+    0xF3, 0x44, 0x0F, 0x6F, 0x44, 0x24, 0x20, // movdqu xmm8, [rsp+32]
+    0xF3, 0x44, 0x0F, 0x6F, 0x4C, 0x24, 0x30, // movdqu xmm9, [rsp+48]
+    0xF3, 0x44, 0x0F, 0x6F, 0x54, 0x24, 0x40, // movdqu xmm10, [rsp+64]
+    0xF3, 0x44, 0x0F, 0x6F, 0x5C, 0x24, 0x50, // movdqu xmm11, [rsp+80]
+    0xF3, 0x44, 0x0F, 0x6F, 0x64, 0x24, 0x60, // movdqu xmm12, [rsp+96]
+    0xF3, 0x44, 0x0F, 0x6F, 0x6C, 0x24, 0x70, // movdqu xmm13, [rsp+112]
+    0xF3, 0x44, 0x0F, 0x6F, 0xB4, 0x24, 0x80, 0x00, 0x00, 0x00, // movdqu xmm14, [rsp+128]
+    0xF3, 0x44, 0x0F, 0x6F, 0xBC, 0x24, 0x90, 0x00, 0x00, 0x00, // movdqu xmm15, [rsp+144]
+    0x48, 0x81, 0xC4, 0xA8, 0x00, 0x00, 0x00, // add rsp, 168
+    0x5E, // pop rsi
+    0x5F, // pop rdi
+    0xC3, // ret
+  ];
+}
@@ -0,0 +1,187 @@
+// dart format width=5000
+// AUTO-GENERATED - DO NOT EDIT
+// Shellcode montado de asm/x25519_mulx_x86_64.S
+//   as --64 -o x25519_mulx_x86_64.o x25519_mulx_x86_64.S
+//   objcopy -O binary -j .text x25519_mulx_x86_64.o x25519_mulx_x86_64.bin
+// Tamanho: 2821 bytes
+
+/// Shellcode x86_64 (System V) com a entrada `x25519_scalarmult` (offset 0).
+const List<int> kX25519MulxShellcode = [
+  0x53, 0x55, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57, 0x48, 0x81, 0xEC, 0x78, 0x02, 0x00,
+  0x00, 0x48, 0x89, 0xBC, 0x24, 0x60, 0x02, 0x00, 0x00, 0x48, 0x8B, 0x06, 0x48, 0x83, 0xE0, 0xF8,
+  0x48, 0x89, 0x84, 0x24, 0x40, 0x02, 0x00, 0x00, 0x48, 0x8B, 0x46, 0x08, 0x48, 0x89, 0x84, 0x24,
+  0x48, 0x02, 0x00, 0x00, 0x48, 0x8B, 0x46, 0x10, 0x48, 0x89, 0x84, 0x24, 0x50, 0x02, 0x00, 0x00,
+  0x48, 0x8B, 0x46, 0x18, 0x48, 0x0F, 0xBA, 0xF0, 0x3F, 0x48, 0x0F, 0xBA, 0xE8, 0x3E, 0x48, 0x89,
+  0x84, 0x24, 0x58, 0x02, 0x00, 0x00, 0x31, 0xC9, 0x48, 0x8B, 0x02, 0x48, 0x89, 0x04, 0x24, 0x48,
+  0x89, 0x44, 0x24, 0x60, 0x48, 0x89, 0x4C, 0x24, 0x20, 0x48, 0x89, 0x4C, 0x24, 0x40, 0x48, 0x89,
+  0x8C, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x42, 0x08, 0x48, 0x89, 0x44, 0x24, 0x08, 0x48,
+  0x89, 0x44, 0x24, 0x68, 0x48, 0x89, 0x4C, 0x24, 0x28, 0x48, 0x89, 0x4C, 0x24, 0x48, 0x48, 0x89,
+  0x8C, 0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x42, 0x10, 0x48, 0x89, 0x44, 0x24, 0x10, 0x48,
+  0x89, 0x44, 0x24, 0x70, 0x48, 0x89, 0x4C, 0x24, 0x30, 0x48, 0x89, 0x4C, 0x24, 0x50, 0x48, 0x89,
+  0x8C, 0x24, 0x90, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x42, 0x18, 0x48, 0x0F, 0xBA, 0xF0, 0x3F, 0x48,
+  0x89, 0x44, 0x24, 0x18, 0x48, 0x89, 0x44, 0x24, 0x78, 0x48, 0x89, 0x4C, 0x24, 0x38, 0x48, 0x89,
+  0x4C, 0x24, 0x58, 0x48, 0x89, 0x8C, 0x24, 0x98, 0x00, 0x00, 0x00, 0x48, 0xC7, 0x44, 0x24, 0x20,
+  0x01, 0x00, 0x00, 0x00, 0x48, 0xC7, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x48, 0x89, 0x8C, 0x24, 0x68, 0x02, 0x00, 0x00, 0x48, 0xC7, 0x84, 0x24, 0x70, 0x02, 0x00, 0x00,
+  0xFE, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x8C, 0x24, 0x70, 0x02, 0x00, 0x00, 0x48, 0x89, 0xC8, 0x48,
+  0xC1, 0xE8, 0x06, 0x48, 0x8B, 0x84, 0xC4, 0x40, 0x02, 0x00, 0x00, 0x48, 0xD3, 0xE8, 0x83, 0xE0,
+  0x01, 0x48, 0x8B, 0x9C, 0x24, 0x68, 0x02, 0x00, 0x00, 0x48, 0x31, 0xC3, 0x48, 0x89, 0x84, 0x24,
+  0x68, 0x02, 0x00, 0x00, 0x48, 0xF7, 0xDB, 0x48, 0x8B, 0x44, 0x24, 0x20, 0x48, 0x8B, 0x4C, 0x24,
+  0x60, 0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31, 0xD1,
+  0x48, 0x89, 0x44, 0x24, 0x20, 0x48, 0x89, 0x4C, 0x24, 0x60, 0x48, 0x8B, 0x44, 0x24, 0x28, 0x48,
+  0x8B, 0x4C, 0x24, 0x68, 0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0,
+  0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24, 0x28, 0x48, 0x89, 0x4C, 0x24, 0x68, 0x48, 0x8B, 0x44,
+  0x24, 0x30, 0x48, 0x8B, 0x4C, 0x24, 0x70, 0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA,
+  0x48, 0x31, 0xD0, 0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x89, 0x4C, 0x24, 0x70,
+  0x48, 0x8B, 0x44, 0x24, 0x38, 0x48, 0x8B, 0x4C, 0x24, 0x78, 0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA,
+  0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24, 0x38, 0x48, 0x89,
+  0x4C, 0x24, 0x78, 0x48, 0x8B, 0x44, 0x24, 0x40, 0x48, 0x8B, 0x8C, 0x24, 0x80, 0x00, 0x00, 0x00,
+  0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31, 0xD1, 0x48,
+  0x89, 0x44, 0x24, 0x40, 0x48, 0x89, 0x8C, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x44, 0x24,
+  0x48, 0x48, 0x8B, 0x8C, 0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48,
+  0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24, 0x48, 0x48, 0x89, 0x8C,
+  0x24, 0x88, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x44, 0x24, 0x50, 0x48, 0x8B, 0x8C, 0x24, 0x90, 0x00,
+  0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31,
+  0xD1, 0x48, 0x89, 0x44, 0x24, 0x50, 0x48, 0x89, 0x8C, 0x24, 0x90, 0x00, 0x00, 0x00, 0x48, 0x8B,
+  0x44, 0x24, 0x58, 0x48, 0x8B, 0x8C, 0x24, 0x98, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0x31,
+  0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24, 0x58, 0x48,
+  0x89, 0x8C, 0x24, 0x98, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0xA0, 0x00, 0x00, 0x00, 0x4C,
+  0x8D, 0x4C, 0x24, 0x20, 0x4C, 0x8D, 0x54, 0x24, 0x40, 0xE8, 0x9A, 0x07, 0x00, 0x00, 0x4C, 0x8D,
+  0x84, 0x24, 0xE0, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x4C, 0x24, 0x20, 0x4C, 0x8D, 0x54, 0x24, 0x40,
+  0xE8, 0xCF, 0x07, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x40, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x4C,
+  0x24, 0x60, 0x4C, 0x8D, 0x94, 0x24, 0x80, 0x00, 0x00, 0x00, 0xE8, 0x69, 0x07, 0x00, 0x00, 0x4C,
+  0x8D, 0x84, 0x24, 0x60, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x4C, 0x24, 0x60, 0x4C, 0x8D, 0x94, 0x24,
+  0x80, 0x00, 0x00, 0x00, 0xE8, 0x9B, 0x07, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0xC0, 0x00, 0x00,
+  0x00, 0x4C, 0x8D, 0x8C, 0x24, 0xA0, 0x00, 0x00, 0x00, 0xE8, 0x82, 0x05, 0x00, 0x00, 0x4C, 0x8D,
+  0x84, 0x24, 0x00, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0xE0, 0x00, 0x00, 0x00, 0xE8, 0x6D,
+  0x05, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x80, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x60,
+  0x01, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0xA0, 0x00, 0x00, 0x00, 0xE8, 0x53, 0x05, 0x00, 0x00,
+  0x4C, 0x8D, 0x84, 0x24, 0xA0, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x40, 0x01, 0x00, 0x00,
+  0x4C, 0x8D, 0x94, 0x24, 0xE0, 0x00, 0x00, 0x00, 0xE8, 0x36, 0x05, 0x00, 0x00, 0x4C, 0x8D, 0x84,
+  0x24, 0x20, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0xC0, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x94,
+  0x24, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x1A, 0x07, 0x00, 0x00, 0x4C, 0x8D, 0x44, 0x24, 0x60, 0x4C,
+  0x8D, 0x8C, 0x24, 0x80, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0xA0, 0x01, 0x00, 0x00, 0xE8,
+  0xB4, 0x06, 0x00, 0x00, 0x4C, 0x8D, 0x44, 0x24, 0x60, 0x4C, 0x8D, 0x4C, 0x24, 0x60, 0xE8, 0xED,
+  0x04, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x80,
+  0x01, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0xA0, 0x01, 0x00, 0x00, 0xE8, 0xD4, 0x06, 0x00, 0x00,
+  0x4C, 0x8D, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x80, 0x00, 0x00, 0x00,
+  0xE8, 0xBB, 0x04, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x8C,
+  0x24, 0x80, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x14, 0x24, 0xE8, 0xA5, 0x04, 0x00, 0x00, 0x4C, 0x8D,
+  0x44, 0x24, 0x20, 0x4C, 0x8D, 0x8C, 0x24, 0xC0, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0x00,
+  0x01, 0x00, 0x00, 0xE8, 0x8B, 0x04, 0x00, 0x00, 0x4C, 0x8D, 0x44, 0x24, 0x40, 0x4C, 0x8D, 0x8C,
+  0x24, 0x20, 0x01, 0x00, 0x00, 0xE8, 0xC6, 0x06, 0x00, 0x00, 0x4C, 0x8D, 0x44, 0x24, 0x40, 0x4C,
+  0x8D, 0x4C, 0x24, 0x40, 0x4C, 0x8D, 0x94, 0x24, 0x00, 0x01, 0x00, 0x00, 0xE8, 0x17, 0x06, 0x00,
+  0x00, 0x4C, 0x8D, 0x44, 0x24, 0x40, 0x4C, 0x8D, 0x4C, 0x24, 0x40, 0x4C, 0x8D, 0x94, 0x24, 0x20,
+  0x01, 0x00, 0x00, 0xE8, 0x4B, 0x04, 0x00, 0x00, 0x48, 0x83, 0xAC, 0x24, 0x70, 0x02, 0x00, 0x00,
+  0x01, 0x0F, 0x83, 0xDD, 0xFC, 0xFF, 0xFF, 0x48, 0x8B, 0x9C, 0x24, 0x68, 0x02, 0x00, 0x00, 0x48,
+  0xF7, 0xDB, 0x48, 0x8B, 0x44, 0x24, 0x20, 0x48, 0x8B, 0x4C, 0x24, 0x60, 0x48, 0x89, 0xC2, 0x48,
+  0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24, 0x20,
+  0x48, 0x89, 0x4C, 0x24, 0x60, 0x48, 0x8B, 0x44, 0x24, 0x28, 0x48, 0x8B, 0x4C, 0x24, 0x68, 0x48,
+  0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31, 0xD1, 0x48, 0x89,
+  0x44, 0x24, 0x28, 0x48, 0x89, 0x4C, 0x24, 0x68, 0x48, 0x8B, 0x44, 0x24, 0x30, 0x48, 0x8B, 0x4C,
+  0x24, 0x70, 0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31,
+  0xD1, 0x48, 0x89, 0x44, 0x24, 0x30, 0x48, 0x89, 0x4C, 0x24, 0x70, 0x48, 0x8B, 0x44, 0x24, 0x38,
+  0x48, 0x8B, 0x4C, 0x24, 0x78, 0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31,
+  0xD0, 0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24, 0x38, 0x48, 0x89, 0x4C, 0x24, 0x78, 0x48, 0x8B,
+  0x44, 0x24, 0x40, 0x48, 0x8B, 0x8C, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0x31,
+  0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24, 0x40, 0x48,
+  0x89, 0x8C, 0x24, 0x80, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x44, 0x24, 0x48, 0x48, 0x8B, 0x8C, 0x24,
+  0x88, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0,
+  0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24, 0x48, 0x48, 0x89, 0x8C, 0x24, 0x88, 0x00, 0x00, 0x00,
+  0x48, 0x8B, 0x44, 0x24, 0x50, 0x48, 0x8B, 0x8C, 0x24, 0x90, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2,
+  0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48, 0x31, 0xD0, 0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24,
+  0x50, 0x48, 0x89, 0x8C, 0x24, 0x90, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x44, 0x24, 0x58, 0x48, 0x8B,
+  0x8C, 0x24, 0x98, 0x00, 0x00, 0x00, 0x48, 0x89, 0xC2, 0x48, 0x31, 0xCA, 0x48, 0x21, 0xDA, 0x48,
+  0x31, 0xD0, 0x48, 0x31, 0xD1, 0x48, 0x89, 0x44, 0x24, 0x58, 0x48, 0x89, 0x8C, 0x24, 0x98, 0x00,
+  0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0xC0, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x4C, 0x24, 0x40, 0xE8,
+  0xEC, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0xE0, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24,
+  0xC0, 0x01, 0x00, 0x00, 0xB8, 0x02, 0x00, 0x00, 0x00, 0xE8, 0x72, 0x04, 0x00, 0x00, 0x4C, 0x8D,
+  0x84, 0x24, 0xE0, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x4C, 0x24, 0x40, 0x4C, 0x8D, 0x94, 0x24, 0xE0,
+  0x01, 0x00, 0x00, 0xE8, 0xBB, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0xC0, 0x01, 0x00, 0x00,
+  0x4C, 0x8D, 0x8C, 0x24, 0xC0, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0xE0, 0x01, 0x00, 0x00,
+  0xE8, 0x9E, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x8C,
+  0x24, 0xC0, 0x01, 0x00, 0x00, 0xE8, 0x86, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0xE0, 0x01,
+  0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0xE0, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0x00, 0x02,
+  0x00, 0x00, 0xE8, 0x6C, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C,
+  0x8D, 0x8C, 0x24, 0xE0, 0x01, 0x00, 0x00, 0xB8, 0x05, 0x00, 0x00, 0x00, 0xE8, 0xEF, 0x03, 0x00,
+  0x00, 0x4C, 0x8D, 0x84, 0x24, 0xE0, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x00, 0x02, 0x00,
+  0x00, 0x4C, 0x8D, 0x94, 0x24, 0xE0, 0x01, 0x00, 0x00, 0xE8, 0x35, 0x02, 0x00, 0x00, 0x4C, 0x8D,
+  0x84, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0xE0, 0x01, 0x00, 0x00, 0xB8, 0x0A,
+  0x00, 0x00, 0x00, 0xE8, 0xB8, 0x03, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x00, 0x02, 0x00, 0x00,
+  0x4C, 0x8D, 0x8C, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0xE0, 0x01, 0x00, 0x00,
+  0xE8, 0xFE, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x20, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x8C,
+  0x24, 0x00, 0x02, 0x00, 0x00, 0xB8, 0x14, 0x00, 0x00, 0x00, 0xE8, 0x81, 0x03, 0x00, 0x00, 0x4C,
+  0x8D, 0x84, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x20, 0x02, 0x00, 0x00, 0x4C,
+  0x8D, 0x94, 0x24, 0x00, 0x02, 0x00, 0x00, 0xE8, 0xC7, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24,
+  0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x00, 0x02, 0x00, 0x00, 0xB8, 0x0A, 0x00, 0x00,
+  0x00, 0xE8, 0x4A, 0x03, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0xE0, 0x01, 0x00, 0x00, 0x4C, 0x8D,
+  0x8C, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0xE0, 0x01, 0x00, 0x00, 0xE8, 0x90,
+  0x01, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0xE0,
+  0x01, 0x00, 0x00, 0xB8, 0x32, 0x00, 0x00, 0x00, 0xE8, 0x13, 0x03, 0x00, 0x00, 0x4C, 0x8D, 0x84,
+  0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x94,
+  0x24, 0xE0, 0x01, 0x00, 0x00, 0xE8, 0x59, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x20, 0x02,
+  0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x00, 0x02, 0x00, 0x00, 0xB8, 0x64, 0x00, 0x00, 0x00, 0xE8,
+  0xDC, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24,
+  0x20, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0x00, 0x02, 0x00, 0x00, 0xE8, 0x22, 0x01, 0x00,
+  0x00, 0x4C, 0x8D, 0x84, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x00, 0x02, 0x00,
+  0x00, 0xB8, 0x32, 0x00, 0x00, 0x00, 0xE8, 0xA5, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0xE0,
+  0x01, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0x00, 0x02, 0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0xE0,
+  0x01, 0x00, 0x00, 0xE8, 0xEB, 0x00, 0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0xE0, 0x01, 0x00, 0x00,
+  0x4C, 0x8D, 0x8C, 0x24, 0xE0, 0x01, 0x00, 0x00, 0xB8, 0x05, 0x00, 0x00, 0x00, 0xE8, 0x6E, 0x02,
+  0x00, 0x00, 0x4C, 0x8D, 0x84, 0x24, 0xE0, 0x01, 0x00, 0x00, 0x4C, 0x8D, 0x8C, 0x24, 0xE0, 0x01,
+  0x00, 0x00, 0x4C, 0x8D, 0x94, 0x24, 0xC0, 0x01, 0x00, 0x00, 0xE8, 0xB4, 0x00, 0x00, 0x00, 0x4C,
+  0x8D, 0x44, 0x24, 0x20, 0x4C, 0x8D, 0x4C, 0x24, 0x20, 0x4C, 0x8D, 0x94, 0x24, 0xE0, 0x01, 0x00,
+  0x00, 0xE8, 0x9D, 0x00, 0x00, 0x00, 0x48, 0x8B, 0x74, 0x24, 0x20, 0x48, 0x8B, 0x7C, 0x24, 0x28,
+  0x48, 0x8B, 0x6C, 0x24, 0x30, 0x4C, 0x8B, 0x5C, 0x24, 0x38, 0x4C, 0x89, 0xD8, 0x48, 0xC1, 0xE8,
+  0x3F, 0x49, 0x0F, 0xBA, 0xF3, 0x3F, 0x48, 0x6B, 0xC0, 0x13, 0x48, 0x01, 0xC6, 0x48, 0x83, 0xD7,
+  0x00, 0x48, 0x83, 0xD5, 0x00, 0x49, 0x83, 0xD3, 0x00, 0x48, 0x89, 0xF0, 0x48, 0x83, 0xC0, 0x13,
+  0x48, 0x89, 0xFB, 0x48, 0x83, 0xD3, 0x00, 0x48, 0x89, 0xE9, 0x48, 0x83, 0xD1, 0x00, 0x4C, 0x89,
+  0xDA, 0x48, 0x83, 0xD2, 0x00, 0x48, 0x0F, 0xBA, 0xF2, 0x3F, 0x48, 0x0F, 0x42, 0xF0, 0x48, 0x0F,
+  0x42, 0xFB, 0x48, 0x0F, 0x42, 0xE9, 0x4C, 0x0F, 0x42, 0xDA, 0x48, 0x8B, 0x84, 0x24, 0x60, 0x02,
+  0x00, 0x00, 0x48, 0x89, 0x30, 0x48, 0x89, 0x78, 0x08, 0x48, 0x89, 0x68, 0x10, 0x4C, 0x89, 0x58,
+  0x18, 0x31, 0xC0, 0xB9, 0x4F, 0x00, 0x00, 0x00, 0x48, 0x89, 0xE7, 0xF3, 0x48, 0xAB, 0x48, 0x81,
+  0xC4, 0x78, 0x02, 0x00, 0x00, 0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5D, 0x5B, 0xC3,
+  0x4D, 0x89, 0xCA, 0x49, 0x8B, 0x12, 0xC4, 0xC2, 0xCB, 0xF6, 0x39, 0xC4, 0xC2, 0xFB, 0xF6, 0x69,
+  0x08, 0x48, 0x01, 0xC7, 0xC4, 0x42, 0xFB, 0xF6, 0x59, 0x10, 0x48, 0x11, 0xC5, 0xC4, 0x42, 0xFB,
+  0xF6, 0x61, 0x18, 0x49, 0x11, 0xC3, 0x49, 0x83, 0xD4, 0x00, 0x49, 0x8B, 0x52, 0x08, 0x31, 0xC9,
+  0xC4, 0xC2, 0xFB, 0xF6, 0x19, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0xF8, 0xF3, 0x48, 0x0F, 0x38, 0xF6,
+  0xEB, 0xC4, 0xC2, 0xFB, 0xF6, 0x59, 0x08, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0xE8, 0xF3, 0x4C, 0x0F,
+  0x38, 0xF6, 0xDB, 0xC4, 0xC2, 0xFB, 0xF6, 0x59, 0x10, 0x66, 0x4C, 0x0F, 0x38, 0xF6, 0xD8, 0xF3,
+  0x4C, 0x0F, 0x38, 0xF6, 0xE3, 0xC4, 0x42, 0xFB, 0xF6, 0x69, 0x18, 0x66, 0x4C, 0x0F, 0x38, 0xF6,
+  0xE0, 0xF3, 0x4C, 0x0F, 0x38, 0xF6, 0xE9, 0x66, 0x4C, 0x0F, 0x38, 0xF6, 0xE9, 0x49, 0x8B, 0x52,
+  0x10, 0x31, 0xC9, 0xC4, 0xC2, 0xFB, 0xF6, 0x19, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0xE8, 0xF3, 0x4C,
+  0x0F, 0x38, 0xF6, 0xDB, 0xC4, 0xC2, 0xFB, 0xF6, 0x59, 0x08, 0x66, 0x4C, 0x0F, 0x38, 0xF6, 0xD8,
+  0xF3, 0x4C, 0x0F, 0x38, 0xF6, 0xE3, 0xC4, 0xC2, 0xFB, 0xF6, 0x59, 0x10, 0x66, 0x4C, 0x0F, 0x38,
+  0xF6, 0xE0, 0xF3, 0x4C, 0x0F, 0x38, 0xF6, 0xEB, 0xC4, 0x42, 0xFB, 0xF6, 0x71, 0x18, 0x66, 0x4C,
+  0x0F, 0x38, 0xF6, 0xE8, 0xF3, 0x4C, 0x0F, 0x38, 0xF6, 0xF1, 0x66, 0x4C, 0x0F, 0x38, 0xF6, 0xF1,
+  0x49, 0x8B, 0x52, 0x18, 0x31, 0xC9, 0xC4, 0xC2, 0xFB, 0xF6, 0x19, 0x66, 0x4C, 0x0F, 0x38, 0xF6,
+  0xD8, 0xF3, 0x4C, 0x0F, 0x38, 0xF6, 0xE3, 0xC4, 0xC2, 0xFB, 0xF6, 0x59, 0x08, 0x66, 0x4C, 0x0F,
+  0x38, 0xF6, 0xE0, 0xF3, 0x4C, 0x0F, 0x38, 0xF6, 0xEB, 0xC4, 0xC2, 0xFB, 0xF6, 0x59, 0x10, 0x66,
+  0x4C, 0x0F, 0x38, 0xF6, 0xE8, 0xF3, 0x4C, 0x0F, 0x38, 0xF6, 0xF3, 0xC4, 0x42, 0xFB, 0xF6, 0x79,
+  0x18, 0x66, 0x4C, 0x0F, 0x38, 0xF6, 0xF0, 0xF3, 0x4C, 0x0F, 0x38, 0xF6, 0xF9, 0x66, 0x4C, 0x0F,
+  0x38, 0xF6, 0xF9, 0xBA, 0x26, 0x00, 0x00, 0x00, 0x31, 0xC9, 0xC4, 0xC2, 0xFB, 0xF6, 0xDC, 0x66,
+  0x48, 0x0F, 0x38, 0xF6, 0xF0, 0xF3, 0x48, 0x0F, 0x38, 0xF6, 0xFB, 0xC4, 0xC2, 0xFB, 0xF6, 0xDD,
+  0x66, 0x48, 0x0F, 0x38, 0xF6, 0xF8, 0xF3, 0x48, 0x0F, 0x38, 0xF6, 0xEB, 0xC4, 0xC2, 0xFB, 0xF6,
+  0xDE, 0x66, 0x48, 0x0F, 0x38, 0xF6, 0xE8, 0xF3, 0x4C, 0x0F, 0x38, 0xF6, 0xDB, 0xC4, 0xC2, 0xE3,
+  0xF6, 0xC7, 0x66, 0x4C, 0x0F, 0x38, 0xF6, 0xDB, 0xF3, 0x48, 0x0F, 0x38, 0xF6, 0xC1, 0x66, 0x48,
+  0x0F, 0x38, 0xF6, 0xC1, 0x48, 0x6B, 0xC0, 0x26, 0x48, 0x01, 0xC6, 0x48, 0x83, 0xD7, 0x00, 0x48,
+  0x83, 0xD5, 0x00, 0x49, 0x83, 0xD3, 0x00, 0x48, 0x19, 0xC0, 0x83, 0xE0, 0x26, 0x48, 0x01, 0xC6,
+  0x49, 0x89, 0x30, 0x49, 0x89, 0x78, 0x08, 0x49, 0x89, 0x68, 0x10, 0x4D, 0x89, 0x58, 0x18, 0xC3,
+  0x50, 0xE8, 0x5A, 0xFE, 0xFF, 0xFF, 0x4D, 0x89, 0xC1, 0x48, 0xFF, 0x0C, 0x24, 0x74, 0x07, 0xE8,
+  0x4C, 0xFE, 0xFF, 0xFF, 0xEB, 0xF3, 0x58, 0xC3, 0x49, 0x8B, 0x01, 0x49, 0x8B, 0x59, 0x08, 0x49,
+  0x8B, 0x49, 0x10, 0x49, 0x8B, 0x51, 0x18, 0x49, 0x03, 0x02, 0x49, 0x13, 0x5A, 0x08, 0x49, 0x13,
+  0x4A, 0x10, 0x49, 0x13, 0x52, 0x18, 0x48, 0x19, 0xF6, 0x83, 0xE6, 0x26, 0x48, 0x01, 0xF0, 0x48,
+  0x83, 0xD3, 0x00, 0x48, 0x83, 0xD1, 0x00, 0x48, 0x83, 0xD2, 0x00, 0x48, 0x19, 0xF6, 0x83, 0xE6,
+  0x26, 0x48, 0x01, 0xF0, 0x49, 0x89, 0x00, 0x49, 0x89, 0x58, 0x08, 0x49, 0x89, 0x48, 0x10, 0x49,
+  0x89, 0x50, 0x18, 0xC3, 0x49, 0x8B, 0x01, 0x49, 0x8B, 0x59, 0x08, 0x49, 0x8B, 0x49, 0x10, 0x49,
+  0x8B, 0x51, 0x18, 0x49, 0x2B, 0x02, 0x49, 0x1B, 0x5A, 0x08, 0x49, 0x1B, 0x4A, 0x10, 0x49, 0x1B,
+  0x52, 0x18, 0x48, 0x19, 0xF6, 0x83, 0xE6, 0x26, 0x48, 0x29, 0xF0, 0x48, 0x83, 0xDB, 0x00, 0x48,
+  0x83, 0xD9, 0x00, 0x48, 0x83, 0xDA, 0x00, 0x48, 0x19, 0xF6, 0x83, 0xE6, 0x26, 0x48, 0x29, 0xF0,
+  0x49, 0x89, 0x00, 0x49, 0x89, 0x58, 0x08, 0x49, 0x89, 0x48, 0x10, 0x49, 0x89, 0x50, 0x18, 0xC3,
+  0xBA, 0x42, 0xDB, 0x01, 0x00, 0xC4, 0xC2, 0xCB, 0xF6, 0x39, 0xC4, 0xC2, 0xFB, 0xF6, 0x69, 0x08,
+  0x48, 0x01, 0xC7, 0xC4, 0x42, 0xFB, 0xF6, 0x59, 0x10, 0x48, 0x11, 0xC5, 0xC4, 0x42, 0xFB, 0xF6,
+  0x61, 0x18, 0x49, 0x11, 0xC3, 0x49, 0x83, 0xD4, 0x00, 0x4D, 0x6B, 0xE4, 0x26, 0x4C, 0x01, 0xE6,
+  0x48, 0x83, 0xD7, 0x00, 0x48, 0x83, 0xD5, 0x00, 0x49, 0x83, 0xD3, 0x00, 0x48, 0x19, 0xC0, 0x83,
+  0xE0, 0x26, 0x48, 0x01, 0xC6, 0x49, 0x89, 0x30, 0x49, 0x89, 0x78, 0x08, 0x49, 0x89, 0x68, 0x10,
+  0x4D, 0x89, 0x58, 0x18, 0xC3,
+];
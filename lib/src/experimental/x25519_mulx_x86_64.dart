@@ -0,0 +1,62 @@
+// dart format width=5000
+//
+// X25519 com kernel nativo MULX/ADCX/ADOX (asm/x25519_mulx_x86_64.S)
+//
+// A escada de Montgomery inteira (255 passos), a inversão de z e a redução
+// final rodam numa única chamada FFI leaf, com limbs de 64 bits e produto
+// 4x4 em duas cadeias de carry. Requer BMI2 + ADX (Intel Broadwell, AMD Zen).
+//
+// Referência: RFC 7748; Oliveira et al., "How to (pre-)compute a ladder"
+
+import 'dart:ffi' as ffi;
+import 'dart:io' show Platform;
+import 'dart:typed_data';
+
+import 'montgomery_asm_x86_64.dart' show MontgomeryAsmSupport;
+import 'rijndael_fast_asm_x86_64.dart' show ExecutableMemory;
+import 'win64_thunk_x86_64.dart';
+import 'x25519_mulx_shellcode_x86_64.dart';
+
+/// Assinatura nativa de `x25519_scalarmult(out, scalar, point)`
+typedef X25519NativeFunc = ffi.Void Function(ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>);
+typedef X25519DartFunc = void Function(ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>, ffi.Pointer<ffi.Uint8>);
+
+/// X25519 nativo; mesma interface de `x25519()` em utils/x25519.dart
+class X25519Mulx {
+  static ExecutableMemory? _code;
+  static X25519DartFunc? _scalarMult;
+
+  /// Verdadeiro quando BMI2 e ADX estão disponíveis
+  static bool get isSupported => MontgomeryAsmSupport.isX64Supported && MontgomeryAsmSupport.isModernSupported;
+
+  static X25519DartFunc _ensureCode() {
+    if (_scalarMult != null) return _scalarMult!;
+    if (!isSupported) {
+      throw UnsupportedError('BMI2/ADX não suportado nesta plataforma');
+    }
+    if (Platform.isWindows) {
+      _code = ExecutableMemory.allocate(Uint8List.fromList([
+        ...windowsSysVThunk(kWindowsThunkSize - kWindowsThunkCallEnd),
+        ...kX25519MulxShellcode,
+      ]));
+    } else {
+      _code = ExecutableMemory.allocate(Uint8List.fromList(kX25519MulxShellcode));
+    }
+    _scalarMult = _code!.pointer.cast<ffi.NativeFunction<X25519NativeFunc>>().asFunction<X25519DartFunc>(isLeaf: true);
+    return _scalarMult!;
+  }
+
+  /// Calcula X25519([k], [u]); ambos com 32 bytes
+  static Uint8List scalarMult(List<int> k, List<int> u) {
+    if (k.length != 32 || u.length != 32) {
+      throw ArgumentError('X25519 inputs must be 32 bytes long');
+    }
+    final func = _ensureCode();
+    final scalar = Uint8List.fromList(k);
+    final point = Uint8List.fromList(u);
+    final out = Uint8List(32);
+    func(out.address, scalar.address, point.address);
+    scalar.fillRange(0, 32, 0);
+    return out;
+  }
+}
@@ -0,0 +1,140 @@
+/// Precomputed per-group state for finite-field Diffie-Hellman.
+library;
+
+import 'dart:collection';
+
+import 'experimental/montgomery_asm_x86_64.dart';
+import 'ffdhe_groups.dart';
+import 'mathtls.dart';
+import 'utils/cryptomath.dart';
+import 'utils/montgomery.dart';
+
+/// Montgomery contexts, a fixed-base comb for the generator and the
+/// ephemeral exponent length for one DH group.
+///
+/// Contexts are built on first use and cached by [of], so every handshake
+/// on a group after the first skips the R² and comb precomputation. The
+/// generator side ([publicValue]) runs on the comb, the peer side
+/// ([sharedSecret]) on the MULX/ADX kernel when the CPU has it and the
+/// prime fits in it, and on the portable Montgomery engine otherwise.
+class FfdheContext {
+  FfdheContext._(this.generator, this.prime, this.exponentBits,
+      {required bool native})
+      : _montgomery = MontgomeryContext(prime),
+        _native = native ? _nativeContext(prime) : null;
+
+  /// Returns the context for the group, cached per prime.
+  ///
+  /// The well-known groups of ffdhe_groups.dart stay cached for the life
+  /// of the isolate; other (server-chosen) groups go through a small LRU
+  /// and use only the portable engine.
+  static FfdheContext of(BigInt generator, BigInt prime) {
+    final known = _known[prime];
+    if (known != null && known.generator == generator) {
+      return known;
+    }
+    final named = _namedGroups[prime];
+    if (named != null && named.generator == generator) {
+      return _known[prime] = FfdheContext._(
+          generator, prime, exponentBitsFor(prime),
+          native: true);
+    }
+    final key = (generator, prime);
+    final cached = _custom.remove(key);
+    if (cached != null) {
+      _custom[key] = cached;
+      return cached;
+    }
+    final context = FfdheContext._(generator, prime, exponentBitsFor(prime),
+        native: false);
+    _custom[key] = context;
+    if (_custom.length > _customCacheSize) {
+      _custom.remove(_custom.keys.first);
+    }
+    return context;
+  }
+
+  /// Ephemeral exponent length for [prime]: the RFC 7919 §5.2 sizes for
+  /// the ffdhe groups, otherwise twice the strength of the group (RFC
+  /// 3526, Section 1).
+  static int exponentBitsFor(BigInt prime) =>
+      _rfc7919ExponentBits[prime] ?? paramStrength(prime) * 2;
+
+  static const int _customCacheSize = 8;
+  static final Map<BigInt, FfdheContext> _known = <BigInt, FfdheContext>{};
+  static final LinkedHashMap<(BigInt, BigInt), FfdheContext> _custom =
+      LinkedHashMap<(BigInt, BigInt), FfdheContext>();
+  static final Map<BigInt, FfdheGroup> _namedGroups = <BigInt, FfdheGroup>{
+    for (final group in ffdheParameters.values) group.prime: group,
+    for (final group in rfc7919Groups) group.prime: group,
+  };
+  static final Map<BigInt, int> _rfc7919ExponentBits = <BigInt, int>{
+    ffdhe2048.prime: 225,
+    ffdhe3072.prime: 275,
+    ffdhe4096.prime: 325,
+    ffdhe6144.prime: 375,
+    ffdhe8192.prime: 400,
+  };
+
+  final BigInt generator;
+  final BigInt prime;
+
+  /// Length of the private exponents drawn by [randomExponent].
+  final int exponentBits;
+
+  final MontgomeryContext _montgomery;
+  final MontgomeryAsmContext? _native;
+  late final MontgomeryComb _comb =
+      MontgomeryComb(_montgomery, generator, exponentBits);
+
+  /// Whether [sharedSecret] runs on the native kernel.
+  bool get usesNativeKernel => _native != null;
+
+  /// A random private exponent of [exponentBits] bits.
+  BigInt randomExponent() {
+    final bytes = getRandomBytes((exponentBits + 7) ~/ 8);
+    final extra = bytes.length * 8 - exponentBits;
+    bytes[0] &= 0xff >> extra;
+    final exponent = bytesToNumber(bytes);
+    return exponent < BigInt.two ? randomExponent() : exponent;
+  }
+
+  /// generator^[exponent] mod prime.
+  BigInt publicValue(BigInt exponent) {
+    if (exponent.bitLength <= exponentBits) {
+      return _comb.modPow(exponent);
+    }
+    return _montgomery.modPow(generator, exponent,
+        exponentBits: prime.bitLength);
+  }
+
+  /// [peerValue]^[exponent] mod prime.
+  BigInt sharedSecret(BigInt peerValue, BigInt exponent) {
+    final native = _native;
+    if (native != null) {
+      // The exponent is padded to its public length so the kernel's
+      // schedule does not depend on its leading zero bits.
+      final length = exponent.bitLength <= exponentBits
+          ? (exponentBits + 7) ~/ 8
+          : numBytes(exponent);
+      return bytesToNumber(native.modPow(numberToByteArray(peerValue),
+          numberToByteArray(exponent, howManyBytes: length)));
+    }
+    return _montgomery.modPow(peerValue, exponent,
+        exponentBits: exponentBits);
+  }
+
+  static MontgomeryAsmContext? _nativeContext(BigInt prime) {
+    if (prime.bitLength > 64 * MontgomeryAsmContext.mulxMaxLimbs ||
+        !MontgomeryAsmSupport.isX64Supported ||
+        !MontgomeryAsmSupport.isModernSupported) {
+      return null;
+    }
+    final context = MontgomeryAsmContext.fromModulus(numberToByteArray(prime));
+    if (!context.usesMulxKernel) {
+      context.dispose();
+      return null;
+    }
+    return context;
+  }
+}
@@ -5,53 +5,122 @@
 import 'dart:typed_data';
 import 'package:crypto/crypto.dart' as crypto;
 
+import 'crypto/streaming_digest.dart';
+
 /// Store and calculate necessary hashes for handshake protocol.
 ///
 /// Calculates message digests of messages exchanged in handshake protocol
 /// of SSLv3 and TLS.
 class HandshakeHashes {
-  late _HashWrapper _handshakeMD5;
-  late _HashWrapper _handshakeSHA;
-  late _HashWrapper _handshakeSHA224;
-  late _HashWrapper _handshakeSHA256;
-  late _HashWrapper _handshakeSHA384;
-  late _HashWrapper _handshakeSHA512;
-  final _handshakeBuffer = <int>[];
-
   /// Create instance.
-  HandshakeHashes() {
-    _handshakeMD5 = _HashWrapper(() => crypto.md5);
-    _handshakeSHA = _HashWrapper(() => crypto.sha1);
-    _handshakeSHA224 = _HashWrapper(() => crypto.sha224);
-    _handshakeSHA256 = _HashWrapper(() => crypto.sha256);
-    _handshakeSHA384 = _HashWrapper(() => crypto.sha384);
-    _handshakeSHA512 = _HashWrapper(() => crypto.sha512);
+  ///
+  /// By default every supported digest plus the raw transcript is maintained.
+  /// With [deferred] set, only the raw transcript is buffered until
+  /// [retainOnly] is called once the cipher suite is known; digests requested
+  /// before that are computed from the buffer.
+  HandshakeHashes({bool deferred = false}) : _deferred = deferred {
+    if (!deferred) {
+      for (final name in allDigests) {
+        _digests[name] = StreamingDigest(name);
+      }
+    }
   }
 
+  /// Names of all digests maintained in the default (non-deferred) mode.
+  static const List<String> allDigests = [
+    'md5',
+    'sha1',
+    'sha224',
+    'sha256',
+    'sha384',
+    'sha512',
+  ];
+
+  // Running digests: each keeps only its compression state and one partial
+  // block, so digest()/copy() do not depend on the transcript length.
+  final Map<String, StreamingDigest> _digests = {};
+
+  // Raw transcript, needed for 'intrinsic' (EdDSA) signatures and while
+  // deferred. Null once dropped by retainOnly().
+  BytesBuilder? _handshakeBuffer = BytesBuilder();
+
+  bool _deferred;
+
+  /// True while the transcript is only buffered, before [retainOnly].
+  bool get isDeferred => _deferred;
+
+  /// Names of digests currently maintained incrementally.
+  Iterable<String> get retainedDigests => _digests.keys;
+
+  /// Whether the raw transcript (the 'intrinsic' digest) is still available.
+  bool get retainsIntrinsic => _handshakeBuffer != null;
+
   /// Reset all hashes and replace with the state from another HandshakeHashes.
   /// Used for HelloRetryRequest transcript replacement (RFC 8446 Section 4.4.1).
   void replaceWith(HandshakeHashes other) {
-    _handshakeMD5 = other._handshakeMD5.copy();
-    _handshakeSHA = other._handshakeSHA.copy();
-    _handshakeSHA224 = other._handshakeSHA224.copy();
-    _handshakeSHA256 = other._handshakeSHA256.copy();
-    _handshakeSHA384 = other._handshakeSHA384.copy();
-    _handshakeSHA512 = other._handshakeSHA512.copy();
-    _handshakeBuffer.clear();
-    _handshakeBuffer.addAll(other._handshakeBuffer);
+    _copyStateFrom(other);
+  }
+
+  void _copyStateFrom(HandshakeHashes other) {
+    if (identical(other, this)) {
+      return;
+    }
+    _digests.clear();
+    other._digests.forEach((name, value) => _digests[name] = value.copy());
+    final buffer = other._handshakeBuffer;
+    _handshakeBuffer =
+        buffer == null ? null : (BytesBuilder()..add(buffer.toBytes()));
+    _deferred = other._deferred;
+  }
+
+  /// Keep only the digests in [digestNames] from now on.
+  ///
+  /// Called once ServerHello fixes the protocol version and cipher suite.
+  /// Missing digests are rebuilt from the buffered transcript, all others are
+  /// dropped. The raw transcript is kept only when [keepIntrinsic] is set.
+  void retainOnly(Iterable<String> digestNames, {bool keepIntrinsic = false}) {
+    final retained = <String, StreamingDigest>{};
+    for (final name in digestNames) {
+      if (retained.containsKey(name)) {
+        continue;
+      }
+      retained[name] = _runningDigest(name);
+    }
+    if (!keepIntrinsic) {
+      _handshakeBuffer = null;
+    } else if (_handshakeBuffer == null) {
+      throw StateError('Raw handshake transcript is no longer available');
+    }
+    _digests
+      ..clear()
+      ..addAll(retained);
+    _deferred = false;
   }
 
   /// Add [data] to hash input.
   ///
   /// [data] - serialized TLS handshake message
   void update(Uint8List data) {
-    _handshakeMD5.update(data);
-    _handshakeSHA.update(data);
-    _handshakeSHA224.update(data);
-    _handshakeSHA256.update(data);
-    _handshakeSHA384.update(data);
-    _handshakeSHA512.update(data);
-    _handshakeBuffer.addAll(data);
+    for (final hash in _digests.values) {
+      hash.update(data);
+    }
+    _handshakeBuffer?.add(data);
+  }
+
+  /// Returns a running digest for [name] that the caller may mutate.
+  StreamingDigest _runningDigest(String name) {
+    final existing = _digests[name];
+    if (existing != null) {
+      return existing.copy();
+    }
+    if (!StreamingDigest.isSupported(name)) {
+      throw ArgumentError('Unknown digest name: $name');
+    }
+    final buffer = _handshakeBuffer;
+    if (buffer == null) {
+      throw StateError('Digest $name is not retained by this transcript');
+    }
+    return StreamingDigest(name)..update(buffer.toBytes());
   }
 
   /// Calculate and return digest for the already consumed data.
@@ -63,29 +132,23 @@ class HandshakeHashes {
   Uint8List digest([String? digest]) {
     if (digest == null) {
       // SSLv3/TLS 1.0/1.1 use MD5+SHA1
-      final md5Bytes = _handshakeMD5.digest();
-      final sha1Bytes = _handshakeSHA.digest();
+      final md5Bytes = this.digest('md5');
+      final sha1Bytes = this.digest('sha1');
       return Uint8List.fromList([...md5Bytes, ...sha1Bytes]);
     }
 
-    switch (digest) {
-      case 'md5':
-        return _handshakeMD5.digest();
-      case 'sha1':
-        return _handshakeSHA.digest();
-      case 'sha224':
-        return _handshakeSHA224.digest();
-      case 'sha256':
-        return _handshakeSHA256.digest();
-      case 'sha384':
-        return _handshakeSHA384.digest();
-      case 'sha512':
-        return _handshakeSHA512.digest();
-      case 'intrinsic':
-        return Uint8List.fromList(_handshakeBuffer);
-      default:
-        throw ArgumentError('Unknown digest name: $digest');
+    if (digest == 'intrinsic') {
+      final buffer = _handshakeBuffer;
+      if (buffer == null) {
+        throw StateError('Raw handshake transcript is not retained');
+      }
+      return buffer.toBytes();
     }
+    final running = _digests[digest];
+    if (running != null) {
+      return running.digest();
+    }
+    return _runningDigest(digest).digest();
   }
 
   /// Calculate and return digest for already consumed data (SSLv3 version).
@@ -95,8 +158,8 @@ class HandshakeHashes {
   /// [masterSecret] - value of the master secret
   /// [label] - label to include in the calculation
   Uint8List digestSSL(Uint8List masterSecret, Uint8List label) {
-    final imacMD5 = _handshakeMD5.copy();
-    final imacSHA = _handshakeSHA.copy();
+    final imacMD5 = _runningDigest('md5');
+    final imacSHA = _runningDigest('sha1');
 
     // The below difference in input for MD5 and SHA-1 is why we can't reuse
     // digest() method
@@ -131,37 +194,6 @@ class HandshakeHashes {
   /// Return a copy of the object with all the hashes in the same state
   /// as the source object.
   HandshakeHashes copy() {
-    final other = HandshakeHashes();
-    other._handshakeMD5 = _handshakeMD5.copy();
-    other._handshakeSHA = _handshakeSHA.copy();
-    other._handshakeSHA224 = _handshakeSHA224.copy();
-    other._handshakeSHA256 = _handshakeSHA256.copy();
-    other._handshakeSHA384 = _handshakeSHA384.copy();
-    other._handshakeSHA512 = _handshakeSHA512.copy();
-    other._handshakeBuffer.addAll(_handshakeBuffer);
-    return other;
-  }
-}
-
-/// Wrapper for hash functions that maintains incremental state.
-class _HashWrapper {
-  final crypto.Hash Function() _hashFactory;
-  final List<int> _buffer = [];
-  
-  _HashWrapper(this._hashFactory);
-
-  void update(Uint8List data) {
-    _buffer.addAll(data);
-  }
-
-  Uint8List digest() {
-    final hash = _hashFactory();
-    return Uint8List.fromList(hash.convert(_buffer).bytes);
-  }
-
-  _HashWrapper copy() {
-    final other = _HashWrapper(_hashFactory);
-    other._buffer.addAll(_buffer);
-    return other;
+    return HandshakeHashes(deferred: true).._copyStateFrom(this);
   }
 }
@@ -5,6 +5,7 @@
 import 'dart:typed_data';
 
 import 'constants.dart';
+import 'utils/cipher_backends.dart';
 import 'x509.dart';
 
 // Cipher names
@@ -109,7 +110,8 @@ List<(int, int)> _resolveVersionPreference(
   return _filterProtocolVersions(seed, minVersion, maxVersion);
 }
 
-const cipherImplementations = ['openssl', 'pycrypto', 'dart'];
+/// Cipher backends in preference order; see [CipherBackends].
+const allCipherImplementations = CipherBackends.all;
 const _certificateTypes = ['x509'];
 
 const rsaSignatureHashes = ['sha512', 'sha384', 'sha256', 'sha224', 'sha1'];
@@ -279,6 +281,7 @@ class HandshakeSettings {
     this.maxKeySize = 8193,
     List<String>? cipherNames,
     List<String>? macNames,
+    List<String>? cipherImplementations,
     List<String>? certificateTypes,
     (int, int)? minVersion,
     (int, int)? maxVersion,
@@ -325,6 +328,8 @@ class HandshakeSettings {
             supportedVersions != null && supportedVersions.isEmpty,
         cipherNames = cipherNames ?? _cipherNames,
         macNames = macNames ?? _macNames,
+        cipherImplementations = List<String>.unmodifiable(
+            cipherImplementations ?? allCipherImplementations),
         certificateTypes = certificateTypes ?? _certificateTypes,
         rsaSigHashes = rsaSigHashes ?? rsaSignatureHashes,
         dsaSigHashes = dsaSigHashes ?? dsaSignatureHashes,
@@ -373,6 +378,11 @@ class HandshakeSettings {
   /// The allowed MAC algorithms
   final List<String> macNames;
 
+  /// Cipher backends to use, in preference order. Each record cipher gets
+  /// the first one the CPU can run; `'dart'` always works. The backend in
+  /// use is reported by `getCipherImplementation()` on the connection.
+  final List<String> cipherImplementations;
+
   /// The allowed certificate types
   final List<String> certificateTypes;
 
@@ -501,6 +511,7 @@ class HandshakeSettings {
     int? maxKeySize,
     List<String>? cipherNames,
     List<String>? macNames,
+    List<String>? cipherImplementations,
     List<String>? certificateTypes,
     (int, int)? minVersion,
     (int, int)? maxVersion,
@@ -546,6 +557,8 @@ class HandshakeSettings {
       maxKeySize: maxKeySize ?? this.maxKeySize,
       cipherNames: cipherNames ?? this.cipherNames,
       macNames: macNames ?? this.macNames,
+      cipherImplementations:
+          cipherImplementations ?? this.cipherImplementations,
       certificateTypes: certificateTypes ?? this.certificateTypes,
       minVersion: minVersion ?? this.minVersion,
       maxVersion: maxVersion ?? this.maxVersion,
@@ -662,6 +675,16 @@ class HandshakeSettings {
       }
     }
 
+    // Validate cipher implementations
+    if (cipherImplementations.isEmpty) {
+      throw ArgumentError('cipherImplementations cannot be empty');
+    }
+    for (final impl in cipherImplementations) {
+      if (!allCipherImplementations.contains(impl)) {
+        throw ArgumentError('Unknown cipher implementation: $impl');
+      }
+    }
+
     // Validate certificate types
     if (certificateTypes.isEmpty) {
       throw ArgumentError('certificateTypes cannot be empty');
@@ -6,6 +6,8 @@ import 'package:pointycastle/ecc/api.dart' show ECDomainParameters, ECPoint;
 
 import 'constants.dart';
 import 'errors.dart';
+import 'experimental/x25519_mulx_x86_64.dart';
+import 'ffdhe_context.dart';
 import 'ffdhe_groups.dart';
 import 'handshake_hashes.dart';
 import 'handshake_settings.dart';
@@ -19,6 +21,7 @@ import 'utils/dsakey.dart';
 import 'utils/ecdsakey.dart';
 import 'utils/eddsakey.dart';
 import 'utils/lists.dart';
+import 'utils/nist_curves.dart';
 import 'utils/rsakey.dart';
 import 'utils/tlshashlib.dart' as tlshash;
 import 'utils/x25519.dart';
@@ -1559,11 +1562,17 @@ class FFDHKeyExchange extends RawDHKeyExchange {
     if (this.generator <= BigInt.one || this.generator >= this.prime) {
       throw TLSIllegalParameterException('Invalid DH generator');
     }
+    if (!this.prime.isOdd) {
+      throw TLSIllegalParameterException('Invalid DH prime');
+    }
   }
 
   final BigInt generator;
   final BigInt prime;
 
+  /// Cached Montgomery state of the group.
+  late final FfdheContext _context = FfdheContext.of(generator, prime);
+
   static BigInt _resolveGenerator(int groupName, BigInt? explicitGenerator) {
     if (groupName != 0) {
       final group = rfc7919GroupMap[groupName];
@@ -1597,16 +1606,11 @@ class FFDHKeyExchange extends RawDHKeyExchange {
   }
 
   @override
-  BigInt getRandomPrivateKey() {
-    // Per RFC 3526, Section 1, the exponent should have double the entropy
-    // of the strength of the group
-    final neededBytes = (paramStrength(prime) * 2 / 8).ceil();
-    return bytesToNumber(getRandomBytes(neededBytes));
-  }
+  BigInt getRandomPrivateKey() => _context.randomExponent();
 
   @override
   Uint8List calcPublicValue(dynamic privateKey, [String? pointFormat]) {
-    final dhY = powMod(generator, privateKey as BigInt, prime);
+    final dhY = _context.publicValue(privateKey as BigInt);
     if (dhY == BigInt.one || dhY == prime - BigInt.one) {
       throw TLSIllegalParameterException('Small subgroup capture');
     }
@@ -1635,7 +1639,7 @@ class FFDHKeyExchange extends RawDHKeyExchange {
       throw TLSIllegalParameterException('Invalid DH public value');
     }
 
-    final shared = powMod(dhY, privateKey as BigInt, prime);
+    final shared = _context.sharedSecret(dhY, privateKey as BigInt);
     if (shared == BigInt.one) {
       throw TLSIllegalParameterException('Small subgroup capture');
     }
@@ -1654,6 +1658,11 @@ class ECDHKeyExchange extends RawDHKeyExchange {
 
   static final _xGroups = {GroupName.x25519, GroupName.x448};
 
+  /// X25519 backend: the MULX/ADX kernel when the CPU has it, otherwise the
+  /// pure Dart ladder.
+  static final Uint8List Function(List<int>, List<int>) _x25519 =
+      X25519Mulx.isSupported ? X25519Mulx.scalarMult : x25519;
+
   /// Verify using constant time operation that the bytearray is not zero
   // ignore: unused_element
   static void _nonZeroCheck(Uint8List value) {
@@ -1675,8 +1684,7 @@ class ECDHKeyExchange extends RawDHKeyExchange {
       return getRandomBytes(size);
     }
 
-    final params = _domainParameters();
-    final order = params.n;
+    final order = _nistCurve?.n ?? _domainParameters().n;
     final bytesNeeded = (order.bitLength + 7) ~/ 8;
     while (true) {
       final candidate = bytesToNumber(getRandomBytes(bytesNeeded)) % order;
@@ -1691,18 +1699,23 @@ class ECDHKeyExchange extends RawDHKeyExchange {
     if (_xGroups.contains(groupName)) {
       final scalar = _coerceMontgomeryScalar(privateKey);
       if (groupName == GroupName.x25519) {
-        return x25519(scalar, X25519_G);
+        return _x25519(scalar, X25519_G);
       }
       return x448(scalar, X448_G);
     }
 
-    final params = _domainParameters();
-    final scalar = _coerceClassicScalar(privateKey, params);
     final format = pointFormat ?? 'uncompressed';
     if (format != 'uncompressed') {
       throw TLSIllegalParameterException(
           'Unsupported EC point format: $format');
     }
+    final nist = _nistCurve;
+    if (nist != null) {
+      final (x, y) = nist.mulBase(_coerceClassicScalar(privateKey, nist.n));
+      return nist.encodePoint(x, y);
+    }
+    final params = _domainParameters();
+    final scalar = _coerceClassicScalar(privateKey, params.n);
     final point = params.G * scalar;
     if (point == null || point.isInfinity) {
       throw TLSIllegalParameterException('Invalid EC scalar');
@@ -1726,13 +1739,12 @@ class ECDHKeyExchange extends RawDHKeyExchange {
 
       final scalar = _coerceMontgomeryScalar(privateKey);
       final secret = groupName == GroupName.x25519
-          ? x25519(scalar, peerShare)
+          ? _x25519(scalar, peerShare)
           : x448(scalar, peerShare);
       _nonZeroCheck(secret);
       return secret;
     }
 
-    final params = _domainParameters();
     final acceptedFormats = validPointFormats ?? const {'uncompressed'};
     if (acceptedFormats.isEmpty) {
       throw TLSDecodeError('Empty EC point formats extension');
@@ -1741,6 +1753,20 @@ class ECDHKeyExchange extends RawDHKeyExchange {
       throw TLSIllegalParameterException('Unsupported EC point encoding');
     }
 
+    final nist = _nistCurve;
+    if (nist != null) {
+      final (BigInt, BigInt) peer;
+      try {
+        peer = nist.decodePoint(peerShare);
+      } on ArgumentError {
+        throw TLSIllegalParameterException('Invalid EC point');
+      }
+      return nist.sharedSecret(
+          _coerceClassicScalar(privateKey, nist.n), peer.$1, peer.$2);
+    }
+
+    final params = _domainParameters();
+
     ECPoint point;
     try {
       final decoded = params.curve.decodePoint(peerShare);
@@ -1757,7 +1783,7 @@ class ECDHKeyExchange extends RawDHKeyExchange {
       throw TLSIllegalParameterException('Invalid EC point');
     }
 
-    final scalar = _coerceClassicScalar(privateKey, params);
+    final scalar = _coerceClassicScalar(privateKey, params.n);
     final shared = point * scalar;
     if (shared == null || shared.isInfinity) {
       throw TLSIllegalParameterException('Invalid peer key share');
@@ -1791,26 +1817,29 @@ class ECDHKeyExchange extends RawDHKeyExchange {
     throw TLSInternalError('Unsupported private key representation');
   }
 
-  BigInt _coerceClassicScalar(dynamic value, ECDomainParameters params) {
+  BigInt _coerceClassicScalar(dynamic value, BigInt order) {
     if (value is BigInt) {
-      final reduced = value % params.n;
+      final reduced = value % order;
       if (reduced == BigInt.zero) {
         throw TLSIllegalParameterException('Invalid EC private key');
       }
       return reduced;
     }
     if (value is Uint8List) {
-      return _coerceClassicScalar(bytesToNumber(value), params);
+      return _coerceClassicScalar(bytesToNumber(value), order);
     }
     if (value is List<int>) {
       return _coerceClassicScalar(
         bytesToNumber(Uint8List.fromList(value)),
-        params,
+        order,
       );
     }
     throw TLSInternalError('Unsupported EC private key representation');
   }
 
+  /// Dedicated engine for P-256 and P-384, null for the other curves.
+  NistCurve? get _nistCurve => NistCurve.byName(GroupName.toStr(groupName));
+
   ECDomainParameters _domainParameters() {
     final curveName = GroupName.toStr(groupName);
     if (curveName.isEmpty) {
@@ -3,35 +3,42 @@ import 'dart:math' as math;
 import 'package:crypto/crypto.dart';
 
 import 'constants.dart';
+import 'tls13_key_schedule.dart';
 import 'utils/cryptomath.dart';
 import 'utils/tlshmac.dart';
 import 'ffdhe_groups.dart';
 
-const _tls13TranscriptLabels = <String>{
-  'c e traffic',
-  's e traffic',
-  'c hs traffic',
-  's hs traffic',
-  'c ap traffic',
-  's ap traffic',
-  'exp master',
-  'res master',
-};
+/// How [calcKey] derives each TLS 1.3 label.
+enum _Tls13LabelKind {
+  /// Derive-Secret over the handshake transcript.
+  transcript,
 
-const _tls13ContextFreeDeriveLabels = <String>{
-  'derived',
-  'ext binder',
-  'res binder',
-};
+  /// Derive-Secret over an empty transcript.
+  contextFree,
 
-const _tls13ExpandDefaultLenLabels = <String>{
-  'finished',
-  'traffic upd',
-};
+  /// HKDF-Expand-Label with empty context, hash-length output by default.
+  defaultLength,
+
+  /// HKDF-Expand-Label with empty context and a caller-given length.
+  keyMaterial,
+}
 
-const _tls13KeyMaterialLabels = <String>{
-  'key',
-  'iv',
+const _tls13Labels = <String, _Tls13LabelKind>{
+  'c e traffic': _Tls13LabelKind.transcript,
+  's e traffic': _Tls13LabelKind.transcript,
+  'c hs traffic': _Tls13LabelKind.transcript,
+  's hs traffic': _Tls13LabelKind.transcript,
+  'c ap traffic': _Tls13LabelKind.transcript,
+  's ap traffic': _Tls13LabelKind.transcript,
+  'exp master': _Tls13LabelKind.transcript,
+  'res master': _Tls13LabelKind.transcript,
+  'derived': _Tls13LabelKind.contextFree,
+  'ext binder': _Tls13LabelKind.contextFree,
+  'res binder': _Tls13LabelKind.contextFree,
+  'finished': _Tls13LabelKind.defaultLength,
+  'traffic upd': _Tls13LabelKind.defaultLength,
+  'key': _Tls13LabelKind.keyMaterial,
+  'iv': _Tls13LabelKind.keyMaterial,
 };
 
 /// Return approximate security level in bits for DH/DSA/RSA parameters.
@@ -51,55 +58,169 @@ int paramStrength(BigInt param) {
   return 256; // NIST SP 800-57
 }
 
-/// Internal P_hash function for TLS PRF calculation.
-Uint8List pHash(String macName, List<int> secret, List<int> seed, int length) {
-  final ret = Uint8List(length);
-  final seedBytes = Uint8List.fromList(seed);
-  var A = seedBytes;
-  var index = 0;
-
-  final mac = TlsHmac(secret, digestmod: macName);
+/// P_hash (RFC 5246, section 5) on one keyed HMAC.
+///
+/// The HMAC pads are absorbed once per secret. Every HMAC then restarts
+/// from that keyed state, with A(i) and the output block kept in fixed
+/// buffers, and the label and seed parts are fed in place rather than
+/// concatenated.
+class PHash {
+  PHash(String macName, List<int> secret)
+      : _mac = TlsHmac(secret, digestmod: macName);
+
+  final TlsHmac _mac;
+
+  int get digestSize => _mac.digestSize;
+
+  /// Writes `P_hash(secret, label || seed || seed2)` to
+  /// `out[offset:offset + length]`, or XORs it in with [xor].
+  void expandInto(List<int> label, List<int> seed, List<int>? seed2,
+      Uint8List out, {int offset = 0, int? length, bool xor = false}) {
+    final end = offset + (length ?? out.length - offset);
+    final mac = _mac;
+    final size = mac.digestSize;
+    final a = Uint8List(size);
+    final block = Uint8List(size);
+
+    // A(1) = HMAC(label || seed)
+    mac.reset();
+    mac.update(label);
+    mac.update(seed);
+    if (seed2 != null) {
+      mac.update(seed2);
+    }
+    mac.finishInto(a);
+
+    var pos = offset;
+    while (pos < end) {
+      mac.reset();
+      mac.update(a);
+      mac.update(label);
+      mac.update(seed);
+      if (seed2 != null) {
+        mac.update(seed2);
+      }
+      mac.finishInto(block);
+      final n = math.min(size, end - pos);
+      if (xor) {
+        for (var i = 0; i < n; i++) {
+          out[pos + i] ^= block[i];
+        }
+      } else {
+        out.setRange(pos, pos + n, block);
+      }
+      pos += n;
+      if (pos < end) {
+        // A(i + 1) = HMAC(A(i))
+        mac.reset();
+        mac.update(a);
+        mac.finishInto(a);
+      }
+    }
+  }
+}
 
-  while (index < length) {
-    final aFun = mac.copy();
-    aFun.update(A);
-    A = aFun.digest();
+/// TLS 1.0-1.2 PRF keyed with one secret.
+///
+/// TLS 1.0 and 1.1 XOR P_MD5 over the first half of the secret with P_SHA1
+/// over the second half; TLS 1.2 runs a single P_SHA256, or P_SHA384 for
+/// the suites in [CipherSuite.sha384PrfSuites]. Derivations from the same
+/// secret can share one instance and its keyed HMAC states.
+class TlsPrf {
+  factory TlsPrf(List<int> version, int cipherSuite, List<int> secret) {
+    if (version[0] == 3 && (version[1] == 1 || version[1] == 2)) {
+      final half = (secret.length + 1) ~/ 2;
+      return TlsPrf._(
+        PHash('md5', secret.sublist(0, half)),
+        PHash('sha1', secret.sublist(secret.length ~/ 2)),
+        null,
+      );
+    }
+    if (version[0] == 3 && version[1] == 3) {
+      final hashName = CipherSuite.sha384PrfSuites.contains(cipherSuite)
+          ? 'sha384'
+          : 'sha256';
+      return TlsPrf._(PHash(hashName, secret), null, hashName);
+    }
+    throw ArgumentError('No TLS PRF for protocol version $version');
+  }
 
-    final outFun = mac.copy();
-    outFun.update(A);
-    outFun.update(seedBytes);
-    final output = outFun.digest();
+  TlsPrf._(this._primary, this._secondary, this._hashName);
+
+  static final Uint8List _masterSecretLabel =
+      Uint8List.fromList('master secret'.codeUnits);
+  static final Uint8List _extendedMasterSecretLabel =
+      Uint8List.fromList('extended master secret'.codeUnits);
+  static final Uint8List _keyExpansionLabel =
+      Uint8List.fromList('key expansion'.codeUnits);
+  static final Uint8List _clientFinishedLabel =
+      Uint8List.fromList('client finished'.codeUnits);
+  static final Uint8List _serverFinishedLabel =
+      Uint8List.fromList('server finished'.codeUnits);
+
+  final PHash _primary;
+  final PHash? _secondary;
+
+  /// Transcript hash used for the session hash and Finished; null selects
+  /// the MD5 || SHA1 pair of TLS 1.0 and 1.1.
+  final String? _hashName;
+
+  /// Fills [out] with `PRF(secret, label, seed || seed2)`.
+  void expandInto(
+      List<int> label, List<int> seed, List<int>? seed2, Uint8List out) {
+    _primary.expandInto(label, seed, seed2, out);
+    _secondary?.expandInto(label, seed, seed2, out, xor: true);
+  }
 
-    final howMany = math.min(length - index, output.length);
-    ret.setRange(index, index + howMany, output);
-    index += howMany;
+  /// Returns [length] bytes of `PRF(secret, label, seed || seed2)`.
+  Uint8List expand(List<int> label, List<int> seed, int length,
+      [List<int>? seed2]) {
+    final out = Uint8List(length);
+    expandInto(label, seed, seed2, out);
+    return out;
   }
+
+  /// Handshake transcript hash this PRF pairs with.
+  Uint8List sessionHash(dynamic handshakeHashes) =>
+      handshakeHashes.digest(_hashName) as Uint8List;
+
+  /// Master secret, keyed with the premaster secret.
+  Uint8List masterSecret(List<int> clientRandom, List<int> serverRandom) =>
+      expand(_masterSecretLabel, clientRandom, 48, serverRandom);
+
+  /// Extended master secret (RFC 7627), keyed with the premaster secret.
+  Uint8List extendedMasterSecret(dynamic handshakeHashes) =>
+      expand(_extendedMasterSecretLabel, sessionHash(handshakeHashes), 48);
+
+  /// Key block, keyed with the master secret.
+  Uint8List keyBlock(
+          List<int> clientRandom, List<int> serverRandom, int length) =>
+      expand(_keyExpansionLabel, serverRandom, length, clientRandom);
+
+  /// Finished verify_data, keyed with the master secret.
+  Uint8List verifyData(dynamic handshakeHashes, bool isClient) => expand(
+      isClient ? _clientFinishedLabel : _serverFinishedLabel,
+      sessionHash(handshakeHashes),
+      12);
+}
+
+/// Internal P_hash function for TLS PRF calculation.
+Uint8List pHash(String macName, List<int> secret, List<int> seed, int length) {
+  final ret = Uint8List(length);
+  PHash(macName, secret).expandInto(const [], seed, null, ret);
   return ret;
 }
 
 /// TLS 1.0/1.1 PRF (uses both MD5 and SHA1).
 Uint8List prf(List<int> secret, List<int> label, List<int> seed, int length) {
-  final secretLen = secret.length;
-  final halfLen = (secretLen / 2).ceil();
-
-  // Split secret into two halves (may share a byte if odd length)
-  final s1 = secret.sublist(0, halfLen);
-  final s2 = secret.sublist((secretLen / 2).floor());
-
-  // Run left half through P_MD5 and right half through P_SHA1
-  final pMd5 = pHash('md5', s1, [...label, ...seed], length);
-  final pSha1 = pHash('sha1', s2, [...label, ...seed], length);
-
-  // XOR the outputs
-  for (var i = 0; i < length; i++) {
-    pMd5[i] ^= pSha1[i];
-  }
-  return pMd5;
+  return TlsPrf(const [3, 1], 0, secret).expand(label, seed, length);
 }
 
 /// TLS 1.2 PRF using SHA256.
 Uint8List prf12(List<int> secret, List<int> label, List<int> seed, int length) {
-  return pHash('sha256', secret, [...label, ...seed], length);
+  final ret = Uint8List(length);
+  PHash('sha256', secret).expandInto(label, seed, null, ret);
+  return ret;
 }
 
 /// TLS 1.2 PRF using SHA384 (for certain cipher suites).
@@ -109,7 +230,9 @@ Uint8List prf12Sha384(
   List<int> seed,
   int length,
 ) {
-  return pHash('sha384', secret, [...label, ...seed], length);
+  final ret = Uint8List(length);
+  PHash('sha384', secret).expandInto(label, seed, null, ret);
+  return ret;
 }
 
 /// SSL 3.0 PRF.
@@ -294,103 +417,62 @@ Uint8List calcKey(
     }
   }
 
-  // TLS 1.0/1.1
-  else if (version[0] == 3 && (version[1] == 1 || version[1] == 2)) {
-    List<int> seed;
-    final labelStr = String.fromCharCodes(label);
-    if (labelStr == 'extended master secret') {
-      final md5 = handshakeHashes.digest('md5');
-      final sha1 = handshakeHashes.digest('sha1');
-      seed = [...md5, ...sha1];
-    } else if (labelStr.endsWith('finished')) {
-      seed = handshakeHashes.digest();
-    } else {
-      // key expansion or master secret
-      assert(clientRandom != null && serverRandom != null);
-      if (labelStr == 'key expansion') {
-        seed = [...serverRandom!, ...clientRandom!];
-      } else {
-        seed = [...clientRandom!, ...serverRandom!];
-      }
-    }
-    return prf(secret, label, seed, outputLength ?? 48);
-  }
-
-  // TLS 1.2
-  else if (version[0] == 3 && version[1] == 3) {
-    final useSha384 = CipherSuite.sha384PrfSuites.contains(cipherSuite);
-    List<int> seed;
+  // TLS 1.0-1.2
+  else if (version[0] == 3 && version[1] >= 1 && version[1] <= 3) {
+    final prf = TlsPrf(version, cipherSuite, secret);
     final labelStr = String.fromCharCodes(label);
-
-    if (labelStr == 'extended master secret') {
-      seed = handshakeHashes.digest(useSha384 ? 'sha384' : 'sha256');
-    } else if (labelStr.endsWith('finished')) {
-      seed = handshakeHashes.digest(useSha384 ? 'sha384' : 'sha256');
-    } else {
-      // key expansion or master secret
-      assert(clientRandom != null && serverRandom != null);
-      if (labelStr == 'key expansion') {
-        seed = [...serverRandom!, ...clientRandom!];
-      } else {
-        seed = [...clientRandom!, ...serverRandom!];
-      }
+    final length = outputLength ?? 48;
+    if (labelStr == 'extended master secret' || labelStr.endsWith('finished')) {
+      return prf.expand(label, prf.sessionHash(handshakeHashes), length);
     }
-
-    if (useSha384) {
-      return prf12Sha384(secret, label, seed, outputLength ?? 48);
-    } else {
-      return prf12(secret, label, seed, outputLength ?? 48);
+    // key expansion or master secret
+    assert(clientRandom != null && serverRandom != null);
+    if (labelStr == 'key expansion') {
+      return prf.expand(label, serverRandom!, length, clientRandom);
     }
+    return prf.expand(label, clientRandom!, length, serverRandom);
   }
 
   // TLS 1.3 and later
   else {
     assert(version[0] == 3 && version[1] >= 4);
-    final useSha384 = CipherSuite.sha384PrfSuites.contains(cipherSuite);
-    final prfName = useSha384 ? 'sha384' : 'sha256';
-    final digestLength = useSha384 ? 48 : 32;
+    final hkdf = Tls13Hkdf.forCipherSuite(cipherSuite);
     final labelString = String.fromCharCodes(label);
-    final labelBytes = Uint8List.fromList(label);
-    final baseSecret = Uint8List.fromList(secret);
-
-    Uint8List deriveSecret({required bool requireTranscript}) {
-      if (requireTranscript && handshakeHashes == null) {
-        throw ArgumentError(
-          'handshakeHashes required for TLS 1.3 label $labelString',
-        );
-      }
-      final transcript = requireTranscript ? handshakeHashes : null;
-      return derive_secret(baseSecret, labelBytes, transcript, prfName);
-    }
-
-    Uint8List expandLabel(int outLen, {Uint8List? context}) {
-      final ctx = context ?? Uint8List(0);
-      return HKDF_expand_label(baseSecret, labelBytes, ctx, outLen, prfName);
-    }
-
-    if (_tls13TranscriptLabels.contains(labelString)) {
-      return deriveSecret(requireTranscript: true);
-    }
-
-    if (_tls13ContextFreeDeriveLabels.contains(labelString)) {
-      return deriveSecret(requireTranscript: false);
-    }
-
-    if (_tls13ExpandDefaultLenLabels.contains(labelString)) {
-      final outLen = outputLength ?? digestLength;
-      return expandLabel(outLen);
+    // Keep the caller's secret object so the HMAC key state cached for it
+    // is reused by later labels.
+    final baseSecret = secret is Uint8List ? secret : Uint8List.fromList(secret);
+
+    switch (_tls13Labels[labelString]) {
+      case _Tls13LabelKind.transcript:
+        if (handshakeHashes == null) {
+          throw ArgumentError(
+            'handshakeHashes required for TLS 1.3 label $labelString',
+          );
+        }
+        final Uint8List transcriptHash;
+        if (handshakeHashes is Uint8List) {
+          transcriptHash = handshakeHashes;
+        } else if (handshakeHashes is List<int>) {
+          transcriptHash = Uint8List.fromList(handshakeHashes);
+        } else {
+          transcriptHash = handshakeHashes.digest(hkdf.hashName) as Uint8List;
+        }
+        return hkdf.deriveSecret(baseSecret, label, transcriptHash);
+      case _Tls13LabelKind.contextFree:
+        return hkdf.deriveSecret(baseSecret, label, null);
+      case _Tls13LabelKind.defaultLength:
+        return hkdf.expandLabel(
+            baseSecret, label, const [], outputLength ?? hkdf.hashLength);
+      case _Tls13LabelKind.keyMaterial:
+        if (outputLength == null) {
+          throw ArgumentError(
+            'outputLength required for TLS 1.3 label $labelString',
+          );
+        }
+        return hkdf.expandLabel(baseSecret, label, const [], outputLength);
+      case null:
+        throw ArgumentError('Unsupported TLS 1.3 label: $labelString');
     }
-
-    if (_tls13KeyMaterialLabels.contains(labelString)) {
-      if (outputLength == null) {
-        throw ArgumentError(
-          'outputLength required for TLS 1.3 label $labelString',
-        );
-      }
-      return expandLabel(outputLength);
-    }
-
-    throw ArgumentError('Unsupported TLS 1.3 label: $labelString');
   }
 }
 
@@ -5,8 +5,8 @@ library;
 
 import 'dart:math';
 import 'dart:typed_data';
-import 'package:pointycastle/digests/sha3.dart';
-import 'package:pointycastle/digests/shake.dart';
+import '../../crypto/keccak.dart';
+import 'field.dart';
 import 'parameters.dart';
 import 'polynomial.dart';
 import 'modules.dart';
@@ -36,91 +36,129 @@ class MlKem {
   // ===== Hash Functions (Section 4 of FIPS 203) =====
 
   /// H: SHA3-256 hash (FIPS 203 Section 4)
-  Uint8List _hashH(Uint8List input) {
-    final digest = SHA3Digest(256);
-    final out = Uint8List(digest.digestSize);
-    digest.update(input, 0, input.length);
-    digest.doFinal(out, 0);
-    return out;
-  }
+  Uint8List _hashH(Uint8List input) => sha3_256(input);
 
   /// J: SHAKE256 with 32-byte output
-  Uint8List _hashJ(Uint8List input) {
-    return _shake(256, input, 32);
-  }
+  Uint8List _hashJ(Uint8List input) => shake256(input, 32);
 
   /// G: SHA3-512 split into two 32-byte values
   (Uint8List, Uint8List) _hashG(Uint8List input) {
-    final digest = SHA3Digest(512);
-    final out = Uint8List(digest.digestSize);
-    digest.update(input, 0, input.length);
-    digest.doFinal(out, 0);
+    final out = sha3_512(input);
     return (
       Uint8List.sublistView(out, 0, 32),
       Uint8List.sublistView(out, 32, 64),
     );
   }
 
-  /// XOF: SHAKE128 - Extendable Output Function
-  /// Per FIPS 203 Section 4.9: XOF(rho, i, j) = SHAKE128(rho || i || j)
-  Uint8List _xof(Uint8List rho, int i, int j) {
-    // SHAKE128(rho || i || j) with sufficient output
-    final input = Uint8List.fromList([...rho, i, j]);
-    return _shake128(input, 840);
-  }
-
   /// PRF: SHAKE256 for pseudorandom function
   Uint8List _prf(int eta, Uint8List s, int b) {
-    final input = Uint8List.fromList([...s, b]);
-    return _shake256(input, 64 * eta);
-  }
-
-  /// SHAKE128 XOF
-  Uint8List _shake128(Uint8List input, int outputLen) {
-    return _shake(128, input, outputLen);
-  }
-
-  /// SHAKE256 XOF
-  Uint8List _shake256(Uint8List input, int outputLen) {
-    return _shake(256, input, outputLen);
-  }
-
-  Uint8List _shake(int strength, Uint8List input, int outputLen) {
-    final digest = SHAKEDigest(strength);
-    digest.update(input, 0, input.length);
-    final out = Uint8List(outputLen);
-    digest.doFinalRange(out, 0, out.length);
-    return out;
+    final prf = KeccakSponge.shake256()
+      ..absorb(s)
+      ..absorb([b]);
+    return prf.read(64 * eta);
   }
 
   // ===== Matrix and Vector Generation =====
 
+  /// SHAKE128 blocks squeezed up front per matrix entry; 3 blocks (168
+  /// coefficient candidates each) almost always suffice.
+  static const int _xofBlocks = 3;
+  static const int _shake128Rate = 168;
+
   /// Generate matrix A from seed rho
+  ///
+  /// XOF(rho, i, j) = SHAKE128(rho || i || j) (FIPS 203 Section 4.9). The
+  /// k*k streams are expanded four at a time on [KeccakX4], and each one is
+  /// squeezed further, a block at a time, only while its rejection sampling
+  /// (Algorithm 7: SampleNTT) still needs bytes.
   PolyMatrix _generateMatrix(Uint8List rho, {bool transpose = false}) {
     final k = params.k;
-    final rows = <List<Polynomial>>[];
-    
-    for (var i = 0; i < k; i++) {
-      final row = <Polynomial>[];
-      for (var j = 0; j < k; j++) {
-        final xofBytes = transpose ? _xof(rho, i, j) : _xof(rho, j, i);
-        row.add(Polynomial.sampleNtt(xofBytes));
+    final entries = k * k;
+    final coeffs = [for (var e = 0; e < entries; e++) Int16List(mlKemDegree)];
+    final xof = KeccakX4.shake128();
+    final buffers = [
+      for (var l = 0; l < 4; l++) Uint8List(_xofBlocks * _shake128Rate)
+    ];
+    final blockViews = [
+      for (final buffer in buffers)
+        Uint8List.sublistView(buffer, 0, _shake128Rate)
+    ];
+    final filled = List<int>.filled(4, 0);
+
+    for (var base = 0; base < entries; base += 4) {
+      final lanes = entries - base < 4 ? entries - base : 4;
+      xof.absorbAll([
+        for (var l = 0; l < lanes; l++)
+          [
+            ...rho,
+            // A_hat[i][j] = SampleNTT(XOF(rho, j, i)); the transpose swaps them.
+            transpose ? (base + l) ~/ k : (base + l) % k,
+            transpose ? (base + l) % k : (base + l) ~/ k,
+          ],
+      ]);
+      xof.squeezeBlocks(buffers, _xofBlocks);
+      var pending = false;
+      for (var l = 0; l < lanes; l++) {
+        filled[l] = _sampleNtt(coeffs[base + l], 0, buffers[l]);
+        pending |= filled[l] < mlKemDegree;
+      }
+      while (pending) {
+        xof.squeezeBlocks(blockViews, 1);
+        pending = false;
+        for (var l = 0; l < lanes; l++) {
+          if (filled[l] < mlKemDegree) {
+            filled[l] = _sampleNtt(coeffs[base + l], filled[l], blockViews[l]);
+            pending |= filled[l] < mlKemDegree;
+          }
+        }
       }
-      rows.add(row);
     }
-    
-    return PolyMatrix(rows);
+
+    return PolyMatrix([
+      for (var i = 0; i < k; i++)
+        [
+          for (var j = 0; j < k; j++)
+            Polynomial(coeffs[i * k + j], isNtt: true)
+        ],
+    ]);
+  }
+
+  /// Rejection-samples coefficients below q from [bytes] (3 bytes per two
+  /// candidates) into [coeffs] from index [filled]; returns the new count.
+  static int _sampleNtt(Int16List coeffs, int filled, Uint8List bytes) {
+    var j = filled;
+    for (var i = 0; i + 3 <= bytes.length && j < mlKemDegree; i += 3) {
+      final d1 = bytes[i] | ((bytes[i + 1] & 0x0f) << 8);
+      final d2 = (bytes[i + 1] >> 4) | (bytes[i + 2] << 4);
+      if (d1 < mlKemModulus) {
+        coeffs[j++] = d1;
+      }
+      if (d2 < mlKemModulus && j < mlKemDegree) {
+        coeffs[j++] = d2;
+      }
+    }
+    return j;
   }
 
   /// Generate error vector from seed
+  ///
+  /// The k PRF streams are expanded together on [KeccakX4].
   (PolyVector, int) _generateErrorVector(Uint8List sigma, int eta, int N) {
-    final elements = <Polynomial>[];
-    for (var i = 0; i < params.k; i++) {
-      final prfOutput = _prf(eta, sigma, N);
-      elements.add(Polynomial.sampleCbd(prfOutput, eta));
-      N++;
-    }
-    return (PolyVector(elements), N);
+    final k = params.k;
+    final length = 64 * eta;
+    const rate = 136;
+    final blocks = (length + rate - 1) ~/ rate;
+    final outputs = [for (var i = 0; i < k; i++) Uint8List(blocks * rate)];
+    final prf = KeccakX4.shake256()
+      ..absorbAll([
+        for (var i = 0; i < k; i++) [...sigma, N + i]
+      ]);
+    prf.squeezeBlocks(outputs, blocks);
+    final elements = <Polynomial>[
+      for (final output in outputs)
+        Polynomial.sampleCbd(Uint8List.sublistView(output, 0, length), eta),
+    ];
+    return (PolyVector(elements), N + k);
   }
 
   /// Generate single error polynomial
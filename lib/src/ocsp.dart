@@ -1,6 +1,7 @@
 import 'dart:typed_data';
 
 import 'errors.dart';
+import 'signature_cache.dart';
 import 'signed.dart';
 import 'x509.dart';
 import 'utils/asn1parser.dart';
@@ -168,12 +169,16 @@ class OCSPResponse extends SignedObject {
     }
   }
 
-  bool verifySignature(Object publicKey, {SignatureSettings? settings}) {
-    return super.verifySignature(publicKey, settings: settings);
+  bool verifySignature(
+    Object publicKey, {
+    SignatureSettings? settings,
+    SignatureVerificationCache? cache,
+  }) {
+    return super.verifySignature(publicKey, settings: settings, cache: cache);
   }
 
   /// Validates the OCSP response against the issuer certificate.
-  bool validate(X509 issuer) {
+  bool validate(X509 issuer, {SignatureVerificationCache? cache}) {
     // 1. Identify Signer
     X509? signer;
     if (responderIdType == 2) { // KeyHash
@@ -212,7 +217,7 @@ class OCSPResponse extends SignedObject {
       if (issuer.publicKey == null) {
         throw TLSHandshakeFailure('Issuer public key missing');
       }
-      if (!signer.verify(issuer.publicKey!)) {
+      if (!signer.verifyIssuedBy(issuer, cache: cache)) {
         throw TLSHandshakeFailure('OCSP signer certificate not signed by issuer');
       }
       
@@ -229,7 +234,8 @@ class OCSPResponse extends SignedObject {
       throw TLSHandshakeFailure('Signer public key missing');
     }
 
-    verifySignature(signer.publicKey!);
+    verifySignature(signer.publicKey!,
+        cache: cache ?? SignatureVerificationCache.shared);
 
     return true;
   }
@@ -0,0 +1,284 @@
+import 'dart:async';
+import 'dart:io' show Platform;
+import 'dart:isolate';
+import 'dart:typed_data';
+
+import 'recordlayer.dart';
+import 'tls_protocol.dart';
+
+/// An AEAD write state reduced to what is needed to rebuild it in another
+/// isolate: the suite, the raw key and fixed nonce, and the record framing.
+class RecordSealParams {
+  RecordSealParams({
+    required this.cipherSuite,
+    required this.key,
+    required this.fixedNonce,
+    required this.recordVersion,
+    required this.version,
+    required this.tls13,
+    this.implementations,
+  });
+
+  final int cipherSuite;
+  final Uint8List key;
+  final Uint8List fixedNonce;
+
+  /// Version written in the record headers.
+  final TlsProtocolVersion recordVersion;
+
+  /// Negotiated version (part of the TLS 1.2 additional data).
+  final TlsProtocolVersion version;
+  final bool tls13;
+  final List<String>? implementations;
+
+  /// A fresh write state equivalent to the exported one.
+  ConnectionState createState() => ConnectionState()
+    ..cipherSuite = cipherSuite
+    ..aeadKey = key
+    ..fixedNonce = fixedNonce
+    ..encContext =
+        RecordLayer.createAeadCipher(cipherSuite, key, implementations);
+
+  Map<String, Object?> _toMessage() => <String, Object?>{
+        'cipherSuite': cipherSuite,
+        // Key material goes over as transferable data rather than through
+        // the object graph copier.
+        'keys': TransferableTypedData.fromList(<Uint8List>[key, fixedNonce]),
+        'keyLength': key.length,
+        'recordVersion': <int>[recordVersion.major, recordVersion.minor],
+        'version': <int>[version.major, version.minor],
+        'tls13': tls13,
+        'implementations': implementations,
+      };
+
+  static RecordSealParams _fromMessage(Map<dynamic, dynamic> message) {
+    final keys = (message['keys'] as TransferableTypedData)
+        .materialize()
+        .asUint8List();
+    final keyLength = message['keyLength'] as int;
+    final recordVersion = message['recordVersion'] as List<int>;
+    final version = message['version'] as List<int>;
+    return RecordSealParams(
+      cipherSuite: message['cipherSuite'] as int,
+      key: Uint8List.sublistView(keys, 0, keyLength),
+      fixedNonce: Uint8List.sublistView(keys, keyLength),
+      recordVersion: TlsProtocolVersion(recordVersion[0], recordVersion[1]),
+      version: TlsProtocolVersion(version[0], version[1]),
+      tls13: message['tls13'] as bool,
+      implementations: (message['implementations'] as List?)?.cast<String>(),
+    );
+  }
+}
+
+/// Seals batches of records of one write state on a pool of worker
+/// isolates.
+///
+/// AEAD nonces depend only on the sequence number, so the caller reserves
+/// a run of sequence numbers ([RecordLayer.reserveWriteSequence]) and
+/// [seal] splits the records into contiguous slices, one per worker. The
+/// sealed slices come back in order, ready to be written to the socket.
+/// A sealer is bound to the write state it was started with; after a key
+/// change it must be closed and a new one started.
+class ParallelRecordSealer {
+  ParallelRecordSealer._(this._isolates, this._commandPorts,
+      this._responsePort, this._errorPort) {
+    _responseSubscription = _responsePort.listen(_handleResponse);
+    _errorSubscription = _errorPort.listen((dynamic message) {
+      final description = message is List && message.isNotEmpty
+          ? message.first.toString()
+          : 'Record sealing isolate error';
+      _failAll(StateError(description));
+    });
+  }
+
+  final List<Isolate> _isolates;
+  final List<SendPort> _commandPorts;
+  final ReceivePort _responsePort;
+  final ReceivePort _errorPort;
+  late final StreamSubscription<dynamic> _responseSubscription;
+  late final StreamSubscription<dynamic> _errorSubscription;
+  final Map<int, Completer<Uint8List>> _pending = <int, Completer<Uint8List>>{};
+  int _nextRequestId = 0;
+  bool _closed = false;
+
+  /// Number of worker isolates.
+  int get workers => _commandPorts.length;
+
+  /// Spawns [workers] isolates (by default one per processor, minus the
+  /// one running the connection) keyed with [params].
+  static Future<ParallelRecordSealer> start(RecordSealParams params,
+      {int? workers}) async {
+    final count = workers ??
+        (Platform.numberOfProcessors > 1 ? Platform.numberOfProcessors - 1 : 1);
+    if (count < 1) {
+      throw ArgumentError.value(workers, 'workers', 'must be positive');
+    }
+    final responsePort = ReceivePort();
+    final errorPort = ReceivePort();
+    final isolates = <Isolate>[];
+    final commandPorts = <SendPort>[];
+    try {
+      for (var i = 0; i < count; i++) {
+        final readyPort = ReceivePort();
+        isolates.add(await Isolate.spawn<Map<String, Object?>>(
+          _sealWorkerEntry,
+          <String, Object?>{
+            'readyPort': readyPort.sendPort,
+            'responsePort': responsePort.sendPort,
+            'params': params._toMessage(),
+          },
+          errorsAreFatal: true,
+          onError: errorPort.sendPort,
+          debugName: 'tlslite_record_sealer_$i',
+        ));
+        commandPorts.add(await readyPort.first as SendPort);
+        readyPort.close();
+      }
+    } catch (_) {
+      for (final isolate in isolates) {
+        isolate.kill(priority: Isolate.immediate);
+      }
+      responsePort.close();
+      errorPort.close();
+      rethrow;
+    }
+    return ParallelRecordSealer._(
+        isolates, commandPorts, responsePort, errorPort);
+  }
+
+  /// Seals [records] (record plaintexts, in order) as record numbers
+  /// `firstSeq`, `firstSeq + 1`, ... of type [contentType] and returns the
+  /// framed records, split in consecutive buffers.
+  Future<List<Uint8List>> seal(
+      int firstSeq, int contentType, List<Uint8List> records) {
+    if (_closed) {
+      throw StateError('Record sealer is closed');
+    }
+    final slices = records.length < workers ? records.length : workers;
+    final futures = <Future<Uint8List>>[];
+    var start = 0;
+    for (var i = 0; i < slices; i++) {
+      final end = start + (records.length - start) ~/ (slices - i);
+      final slice = records.sublist(start, end);
+      final lengths = Int32List(slice.length);
+      for (var j = 0; j < slice.length; j++) {
+        lengths[j] = slice[j].length;
+      }
+      final id = _nextRequestId++;
+      final completer = Completer<Uint8List>();
+      _pending[id] = completer;
+      _commandPorts[i].send(<String, Object?>{
+        'id': id,
+        'seq': firstSeq + start,
+        'type': contentType,
+        'lengths': lengths,
+        'data': TransferableTypedData.fromList(slice),
+      });
+      futures.add(completer.future);
+      start = end;
+    }
+    return Future.wait(futures);
+  }
+
+  /// Stops the workers; pending [seal] calls fail.
+  Future<void> close() async {
+    if (_closed) {
+      return;
+    }
+    _closed = true;
+    for (final isolate in _isolates) {
+      isolate.kill(priority: Isolate.immediate);
+    }
+    await _responseSubscription.cancel();
+    await _errorSubscription.cancel();
+    _responsePort.close();
+    _errorPort.close();
+    _failAll(StateError('Record sealer closed'));
+  }
+
+  void _handleResponse(dynamic message) {
+    if (message is! Map) {
+      return;
+    }
+    final completer = _pending.remove(message['id'] as int?);
+    if (completer == null) {
+      return;
+    }
+    if (message['ok'] as bool? ?? false) {
+      completer.complete((message['data'] as TransferableTypedData)
+          .materialize()
+          .asUint8List());
+    } else {
+      completer.completeError(StateError(
+          message['message'] as String? ?? 'Record sealing failed'));
+    }
+  }
+
+  void _failAll(Object error) {
+    final pending = _pending.values.toList();
+    _pending.clear();
+    for (final completer in pending) {
+      if (!completer.isCompleted) {
+        completer.completeError(error);
+      }
+    }
+  }
+}
+
+@pragma('vm:entry-point')
+void _sealWorkerEntry(Map<String, Object?> init) {
+  final readyPort = init['readyPort'] as SendPort;
+  final responsePort = init['responsePort'] as SendPort;
+  final params =
+      RecordSealParams._fromMessage(init['params'] as Map<dynamic, dynamic>);
+  final state = params.createState();
+  final cipher = state.encContext;
+  final recordOverhead = 5 +
+      ((cipher.name as String).contains('aes') && !params.tls13 ? 8 : 0) +
+      (cipher.tagLength as int);
+
+  final commandPort = ReceivePort();
+  readyPort.send(commandPort.sendPort);
+
+  commandPort.listen((dynamic message) {
+    if (message is! Map) {
+      return;
+    }
+    final id = message['id'] as int;
+    try {
+      final seq = message['seq'] as int;
+      final contentType = message['type'] as int;
+      final lengths = message['lengths'] as Int32List;
+      final data =
+          (message['data'] as TransferableTypedData).materialize().asUint8List();
+
+      var total = 0;
+      for (final length in lengths) {
+        total += recordOverhead + length;
+      }
+      final out = Uint8List(total);
+      var inPos = 0;
+      var outPos = 0;
+      for (var i = 0; i < lengths.length; i++) {
+        final record =
+            Uint8List.sublistView(data, inPos, inPos + lengths[i]);
+        outPos += state.sealRecord(seq + i, record, contentType, out, outPos,
+            recordVersion: params.recordVersion,
+            version: params.version,
+            tls13: params.tls13);
+        inPos += lengths[i];
+      }
+      responsePort.send(<String, Object?>{
+        'id': id,
+        'ok': true,
+        'data': TransferableTypedData.fromList(<Uint8List>[out]),
+      });
+    } catch (error) {
+      responsePort.send(<String, Object?>{
+        'id': id,
+        'ok': false,
+        'message': error.toString(),
+      });
+    }
+  });
+}
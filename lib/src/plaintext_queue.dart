@@ -0,0 +1,111 @@
+import 'dart:collection';
+import 'dart:typed_data';
+
+/// FIFO of decrypted application data, kept as the record payloads
+/// themselves plus a read offset into the first one.
+///
+/// Appending never copies. Reads that fit in the head record return a view
+/// of it; reads that span records copy once into the result. The queue
+/// takes ownership of the chunks passed to [add], and views handed out by
+/// [take]/[takeChunk] alias them, so neither side may mutate them later.
+class PlaintextQueue {
+  final ListQueue<Uint8List> _chunks = ListQueue<Uint8List>();
+
+  /// Bytes of the head chunk already consumed.
+  int _headOffset = 0;
+
+  int _length = 0;
+
+  /// Number of buffered bytes.
+  int get length => _length;
+
+  bool get isEmpty => _length == 0;
+
+  bool get isNotEmpty => _length != 0;
+
+  /// Appends [chunk] without copying it.
+  void add(Uint8List chunk) {
+    if (chunk.isEmpty) {
+      return;
+    }
+    _chunks.addLast(chunk);
+    _length += chunk.length;
+  }
+
+  /// Drops everything buffered.
+  void clear() {
+    _chunks.clear();
+    _headOffset = 0;
+    _length = 0;
+  }
+
+  /// Removes and returns up to [max] bytes (everything when null) from the
+  /// rest of the head chunk, as a view. Returns an empty list when empty.
+  Uint8List takeChunk([int? max]) {
+    if (_length == 0) {
+      return Uint8List(0);
+    }
+    final head = _chunks.first;
+    final available = head.length - _headOffset;
+    final n = max == null || max > available ? available : max;
+    final view = Uint8List.sublistView(head, _headOffset, _headOffset + n);
+    _consume(n);
+    return view;
+  }
+
+  /// Removes and returns the next [count] bytes (clamped to [length]).
+  ///
+  /// Zero-copy when they all come from the head chunk.
+  Uint8List take(int count) {
+    if (count > _length) {
+      count = _length;
+    }
+    if (count == 0) {
+      return Uint8List(0);
+    }
+    if (count <= _chunks.first.length - _headOffset) {
+      return takeChunk(count);
+    }
+    final out = Uint8List(count);
+    copyInto(out);
+    return out;
+  }
+
+  /// Moves up to `buffer.length - offset` bytes into [buffer] starting at
+  /// [offset] and returns how many were copied.
+  int copyInto(Uint8List buffer, [int offset = 0]) {
+    var pos = offset;
+    while (pos < buffer.length && _length != 0) {
+      final head = _chunks.first;
+      final available = head.length - _headOffset;
+      final room = buffer.length - pos;
+      final n = room < available ? room : available;
+      buffer.setRange(pos, pos + n, head, _headOffset);
+      pos += n;
+      _consume(n);
+    }
+    return pos - offset;
+  }
+
+  /// Contiguous copy of the buffered bytes, without consuming them.
+  Uint8List toBytes() {
+    final out = Uint8List(_length);
+    var pos = 0;
+    var skip = _headOffset;
+    for (final chunk in _chunks) {
+      out.setRange(pos, pos + chunk.length - skip, chunk, skip);
+      pos += chunk.length - skip;
+      skip = 0;
+    }
+    return out;
+  }
+
+  void _consume(int n) {
+    _length -= n;
+    _headOffset += n;
+    if (_headOffset == _chunks.first.length) {
+      _chunks.removeFirst();
+      _headOffset = 0;
+    }
+  }
+}
@@ -12,9 +12,12 @@ import 'utils/cipherfactory.dart';
 import 'utils/codec.dart';
 import 'utils/constanttime.dart';
 import 'utils/cryptomath.dart';
+import 'utils/tlshmac.dart';
 import 'utils/tripledes.dart';
 import 'errors.dart';
 import 'mathtls.dart';
+import 'parallel_record_sealer.dart';
+import 'tls13_key_schedule.dart';
 
 
 import 'utils/binary_io.dart';
@@ -49,6 +52,12 @@ class RecordSocket {
 
   /// Send message through socket
   Future<void> send(Message msg, [int padding = 0]) async {
+    queue(msg, padding);
+    await _output.flush();
+  }
+
+  /// Frame [msg] into the output buffer without flushing it.
+  void queue(Message msg, [int padding = 0]) {
     final data = msg.write();
     Uint8List headerBytes;
     
@@ -62,41 +71,63 @@ class RecordSocket {
 
     _output.writeBytes(headerBytes);
     _output.writeBytes(data);
+  }
+
+  /// Send a record that is already framed (header included)
+  Future<void> sendRecordBytes(Uint8List record) async {
+    _output.writeBytes(record);
     await _output.flush();
   }
 
+  /// Append an already framed record to the output buffer without flushing.
+  void queueRecordBytes(Uint8List record) {
+    _output.writeBytes(record);
+  }
+
+  /// Bytes queued but not yet flushed.
+  int get pendingBytes => _output.length;
+
+  /// Hand everything queued to the transport in one write.
+  Future<void> flush() => _output.flush();
+
   /// Read record from socket
+  ///
+  /// The header is decoded straight from the input without intermediate
+  /// buffers, and the returned payload is the view handed out by
+  /// [BinaryInput.readBytes] (stable, never overwritten), so no copy of the
+  /// record body is made here.
   Future<(dynamic, Uint8List)> recv() async {
     try {
       // Read first byte
       await _input.ensureBytes(1);
       final firstByte = _input.readUint8();
-      var buf = <int>[firstByte];
-      
-      bool ssl2 = false;
+
+      dynamic header;
       if (ContentType.all.contains(firstByte)) {
-        ssl2 = false;
         // SSLv3 record layer header is 5 bytes long, we already read 1
         await _input.ensureBytes(4);
-        buf.addAll(_input.readBytes(4));
+        final major = _input.readUint8();
+        final minor = _input.readUint8();
+        final length = _input.readInt16() & 0xffff;
+        header = RecordHeader3()
+            .create(TlsProtocolVersion(major, minor), firstByte, length);
       } else {
-        ssl2 = true;
         // if header has no padding the header is 2 bytes long, 3 otherwise
         // at the same time we already read 1 byte
-        final readLen = (firstByte & 0x80) != 0 ? 1 : 2;
-        await _input.ensureBytes(readLen);
-        buf.addAll(_input.readBytes(readLen));
-      }
-
-      dynamic header;
-      final headerBytes = Uint8List.fromList(buf);
-      if (ssl2) {
-        header = RecordHeader2().parse(Parser(headerBytes));
-        if ((header.padding > header.length) || (header.padding != 0 && header.length % 8 != 0)) {
+        final header2 = RecordHeader2();
+        if ((firstByte & 0x80) != 0) {
+          await _input.ensureBytes(1);
+          header2.create(((firstByte & 0x7f) << 8) | _input.readUint8(), 0);
+        } else {
+          await _input.ensureBytes(2);
+          final length = ((firstByte & 0x3f) << 8) | _input.readUint8();
+          header2.create(length, _input.readUint8());
+        }
+        if ((header2.padding > header2.length) ||
+            (header2.padding != 0 && header2.length % 8 != 0)) {
           throw TLSIllegalParameterException('Malformed record layer header');
         }
-      } else {
-        header = RecordHeader3().parse(Parser(headerBytes));
+        header = header2;
       }
 
       // Check the record header fields
@@ -110,8 +141,8 @@ class RecordSocket {
       }
 
       await _input.ensureBytes(header.length);
-      final data = Uint8List.fromList(_input.readBytes(header.length));
-      return (header, data);
+      final data = _input.readBytes(header.length);
+      return (header, data is Uint8List ? data : Uint8List.fromList(data));
     } on StateError catch (error) {
       throw TLSAbruptCloseError(error.message);
     } on SocketException catch (error) {
@@ -124,12 +155,22 @@ class RecordSocket {
 class ConnectionState {
   ConnectionState();
 
-  dynamic macContext; // TlsHmac?
+  TlsHmac? macContext;
   dynamic encContext; // Cipher object
   Uint8List? fixedNonce;
   int seqnum = 0;
   bool encryptThenMAC = false;
 
+  /// Cipher suite and raw key of an AEAD state, kept so the state can be
+  /// rebuilt in another isolate (see [RecordLayer.exportWriteState]).
+  int cipherSuite = 0;
+  Uint8List? aeadKey;
+
+  /// Per-connection scratch for AEAD nonces and TLS 1.2 additional data,
+  /// reused record after record (ciphers never keep a reference to them).
+  Uint8List? _nonceScratch;
+  final Uint8List _aadScratch = Uint8List(13);
+
   Uint8List getSeqNumBytes() {
     final writer = Writer();
     writer.add(seqnum, 8);
@@ -137,6 +178,61 @@ class ConnectionState {
     return writer.bytes;
   }
 
+  /// Returns the AEAD nonce for record number [seq].
+  ///
+  /// With [xorSeq] the sequence number is XORed into the right end of
+  /// [fixedNonce] (TLS 1.3, RFC 7905 ChaCha20); otherwise it is appended
+  /// as the explicit part (TLS 1.2 AES-GCM/AES-CCM). The result lives in a
+  /// scratch buffer that is overwritten by the next call.
+  Uint8List aeadNonce(int seq, bool xorSeq) {
+    final fixed = fixedNonce!;
+    final length = xorSeq ? fixed.length : fixed.length + 8;
+    var nonce = _nonceScratch;
+    if (nonce == null || nonce.length != length) {
+      nonce = _nonceScratch = Uint8List(length);
+    }
+    nonce.setRange(0, fixed.length, fixed);
+    if (xorSeq) {
+      for (var i = 0; i < 8; i++) {
+        nonce[length - 1 - i] ^= (seq >>> (8 * i)) & 0xff;
+      }
+    } else {
+      for (var i = 0; i < 8; i++) {
+        nonce[length - 1 - i] = (seq >>> (8 * i)) & 0xff;
+      }
+    }
+    return nonce;
+  }
+
+  /// TLS 1.3 AEAD additional data (the record header), written into the
+  /// same scratch buffer as [tls12AdditionalData].
+  Uint8List tls13AdditionalData(
+      int contentType, TlsProtocolVersion version, int length) {
+    final aad = _aadScratch;
+    aad[0] = contentType;
+    aad[1] = version.major;
+    aad[2] = version.minor;
+    aad[3] = (length >> 8) & 0xff;
+    aad[4] = length & 0xff;
+    return Uint8List.sublistView(aad, 0, 5);
+  }
+
+  /// TLS 1.2 AEAD additional data: `seq_num || type || version || length`,
+  /// written into a scratch buffer that is overwritten by the next call.
+  Uint8List tls12AdditionalData(
+      int seq, int contentType, TlsProtocolVersion version, int length) {
+    final aad = _aadScratch;
+    for (var i = 0; i < 8; i++) {
+      aad[7 - i] = (seq >>> (8 * i)) & 0xff;
+    }
+    aad[8] = contentType;
+    aad[9] = version.major;
+    aad[10] = version.minor;
+    aad[11] = (length >> 8) & 0xff;
+    aad[12] = length & 0xff;
+    return aad;
+  }
+
   ConnectionState copy() {
     final ret = ConnectionState();
     ret.macContext = macContext?.copy();
@@ -148,8 +244,55 @@ class ConnectionState {
     ret.fixedNonce = fixedNonce;
     ret.seqnum = seqnum;
     ret.encryptThenMAC = encryptThenMAC;
+    ret.cipherSuite = cipherSuite;
+    ret.aeadKey = aeadKey;
     return ret;
   }
+
+  /// Seals [buf] as record number [seq] with this AEAD state and writes the
+  /// complete record (header, explicit nonce when used, ciphertext and tag)
+  /// into [out] at [offset]. Returns the number of bytes written.
+  ///
+  /// Does not touch [seqnum]; callers assign the sequence numbers.
+  int sealRecord(int seq, Uint8List buf, int contentType, Uint8List out,
+      int offset,
+      {required TlsProtocolVersion recordVersion,
+      required TlsProtocolVersion version,
+      required bool tls13}) {
+    final cipher = encContext;
+    final explicitNonceLength =
+        (cipher.name as String).contains("aes") && !tls13 ? 8 : 0;
+    final payloadLength =
+        explicitNonceLength + buf.length + (cipher.tagLength as int);
+    if (offset < 0 || out.length - offset < 5 + payloadLength) {
+      throw ArgumentError('Output buffer too small for record');
+    }
+
+    out[offset] = contentType;
+    out[offset + 1] = recordVersion.major;
+    out[offset + 2] = recordVersion.minor;
+    out[offset + 3] = (payloadLength >> 8) & 0xff;
+    out[offset + 4] = payloadLength & 0xff;
+
+    final Uint8List authData;
+    if (!tls13) {
+      authData = tls12AdditionalData(seq, contentType, version, buf.length);
+    } else {
+      authData = Uint8List.sublistView(out, offset, offset + 5);
+    }
+
+    final xorSeq = tls13 ||
+        (cipher.name == "chacha20-poly1305" && fixedNonce!.length == 12);
+    final nonce = aeadNonce(seq, xorSeq);
+    var pos = offset + 5;
+    if (explicitNonceLength != 0) {
+      out.setRange(pos, pos + explicitNonceLength, nonce,
+          nonce.length - explicitNonceLength);
+      pos += explicitNonceLength;
+    }
+    pos += cipher.sealInto(nonce, buf, authData, out, pos) as int;
+    return pos - offset;
+  }
 }
 
 /// Implementation of TLS record layer protocol
@@ -177,6 +320,13 @@ class RecordLayer {
 
   bool handshakeFinished = false;
   int sendRecordLimit = 1 << 14;
+
+  /// Cipher backends passed to the last pending state calculation, reused
+  /// for the keys derived by TLS 1.3 KeyUpdate.
+  List<String>? _cipherImplementations;
+
+  /// Size of an SSL 3.0+ record header (type, version, length).
+  static const int _recordHeaderLength = 5;
   
   // TLS 1.3 properties
   bool _earlyDataOk = false;
@@ -240,6 +390,7 @@ class RecordLayer {
   String? getCipherImplementation() => _writeState.encContext?.implementation;
 
   void shutdown() {
+    _writeEpoch++;
     _writeState = ConnectionState();
     _readState = ConnectionState();
     _pendingWriteState = ConnectionState();
@@ -335,7 +486,7 @@ class RecordLayer {
     }
     final explicitIv = Uint8List.fromList(buf.sublist(0, blockLength));
     _applyExplicitIv(cipher, explicitIv);
-    return buf.sublist(blockLength);
+    return Uint8List.sublistView(buf, blockLength);
   }
 
   Uint8List addPadding(Uint8List data) {
@@ -348,6 +499,15 @@ class RecordLayer {
   }
 
   Uint8List calculateMAC(dynamic mac, Uint8List seqnumBytes, int contentType, Uint8List data) {
+    if (mac is TlsHmac) {
+      var seq = 0;
+      for (final b in seqnumBytes) {
+        seq = (seq << 8) | b;
+      }
+      final out = Uint8List(mac.digestSize);
+      mac.macRecord(seq, contentType, _macVersion(), data, out);
+      return out;
+    }
     mac.update(seqnumBytes);
     mac.update(Uint8List.fromList([contentType]));
     // assert version in ((3, 0), (3, 1), (3, 2), (3, 3))
@@ -359,22 +519,54 @@ class RecordLayer {
     mac.update(data);
     return Uint8List.fromList(mac.digest());
   }
-  
+
+  /// Version bytes covered by the record MAC; SSLv3 leaves them out.
+  List<int>? _macVersion() {
+    if (version == const TlsProtocolVersion(3, 0)) {
+      return null;
+    }
+    return [version.major, version.minor];
+  }
+
+  /// Checks the MAC of [content] against [received] for the next read
+  /// sequence number, without copying either.
+  bool _checkRecordMac(
+      TlsHmac mac, int recordType, Uint8List content, Uint8List received) {
+    final seq = _readState.seqnum++;
+    final calculated = Uint8List(mac.digestSize);
+    mac.macRecord(seq, recordType, _macVersion(), content, calculated);
+    return ctCompareDigest(calculated, received);
+  }
+
   Uint8List _macThenEncrypt(Uint8List data, int contentType) {
-    if (_writeState.macContext != null) {
-      final seqnumBytes = _writeState.getSeqNumBytes();
-      final mac = _writeState.macContext.copy();
-      final macBytes = calculateMAC(mac, seqnumBytes, contentType, data);
-      data = Uint8List.fromList([...data, ...macBytes]);
+    final mac = _writeState.macContext;
+    final cipher = _writeState.encContext;
+    final isBlock = cipher != null && _cipherIsBlock(cipher);
+    var padded = false;
+    if (mac != null) {
+      // Payload, MAC and CBC padding share one buffer sized up front.
+      final macEnd = data.length + mac.digestSize;
+      final padLength = isBlock ? blockSize - macEnd % blockSize : 0;
+      final buf = Uint8List(macEnd + padLength);
+      buf.setRange(0, data.length, data);
+      mac.macRecord(_writeState.seqnum++, contentType, _macVersion(), data,
+          buf, data.length);
+      if (padLength > 0) {
+        buf.fillRange(macEnd, buf.length, padLength - 1);
+      }
+      data = buf;
+      padded = isBlock;
     }
 
-    if (_writeState.encContext != null) {
+    if (cipher != null) {
       Uint8List? explicitIv;
-      if (_cipherIsBlock(_writeState.encContext)) {
+      if (isBlock) {
         explicitIv = _prepareExplicitIvForWrite();
-        data = addPadding(data);
+        if (!padded) {
+          data = addPadding(data);
+        }
       }
-      data = _writeState.encContext.encrypt(data);
+      data = cipher.encrypt(data);
       if (explicitIv != null) {
         data = Uint8List.fromList([...explicitIv, ...data]);
       }
@@ -395,64 +587,88 @@ class RecordLayer {
       }
     }
     
-    if (_writeState.macContext != null) {
-      final seqnumBytes = _writeState.getSeqNumBytes();
-      final mac = _writeState.macContext.copy();
-      final macBytes = calculateMAC(mac, seqnumBytes, contentType, buf);
-      buf = Uint8List.fromList([...buf, ...macBytes]);
+    final mac = _writeState.macContext;
+    if (mac != null) {
+      final out = Uint8List(buf.length + mac.digestSize);
+      out.setRange(0, buf.length, buf);
+      mac.macRecord(_writeState.seqnum++, contentType, _macVersion(), buf,
+          out, buf.length);
+      buf = out;
     }
     return buf;
   }
   
-  Uint8List _getNonce(ConnectionState state, Uint8List seqnum) {
-    if ((state.encContext.name == "chacha20-poly1305" && state.fixedNonce!.length == 12) || _isTls13Plus()) {
-      final pad = Uint8List(state.fixedNonce!.length - seqnum.length);
-      final paddedSeq = Uint8List.fromList([...pad, ...seqnum]);
-      final nonce = Uint8List(state.fixedNonce!.length);
-      for (var i = 0; i < nonce.length; i++) {
-        nonce[i] = paddedSeq[i] ^ state.fixedNonce![i];
-      }
-      return nonce;
-    } else {
-      return Uint8List.fromList([...state.fixedNonce!, ...seqnum]);
+  /// Whether [state] builds nonces by XORing the sequence number into the
+  /// fixed nonce rather than sending it as an explicit nonce.
+  bool _xorsSeqIntoNonce(ConnectionState state) {
+    return (state.encContext.name == "chacha20-poly1305" &&
+            state.fixedNonce!.length == 12) ||
+        _isTls13Plus();
+  }
+
+  /// Length of the complete record (header included) that
+  /// [sealRecordInto] produces for [plaintextLength] bytes.
+  int sealedRecordLength(int plaintextLength) {
+    final cipher = _writeState.encContext;
+    final explicitNonce = (cipher.name as String).contains("aes") && !_isTls13Plus();
+    return _recordHeaderLength +
+        (explicitNonce ? 8 : 0) +
+        plaintextLength +
+        (cipher.tagLength as int);
+  }
+
+  /// Seals [buf] with the current AEAD write state and writes the complete
+  /// record (header, explicit nonce when used, ciphertext and tag) into
+  /// [out] at [offset]. Returns the number of bytes written.
+  ///
+  /// [contentType] is the record type placed on the wire (already
+  /// application_data for TLS 1.3).
+  int sealRecordInto(Uint8List buf, int contentType, Uint8List out,
+      [int offset = 0]) {
+    final state = _writeState;
+    return state.sealRecord(state.seqnum++, buf, contentType, out, offset,
+        recordVersion: _recordSocket.version,
+        version: version,
+        tls13: _isTls13Plus());
+  }
+
+  /// Counts write state changes (new keys, KeyUpdate, shutdown), so that
+  /// an exported write state can be recognised as stale.
+  int get writeEpoch => _writeEpoch;
+  int _writeEpoch = 0;
+
+  /// Snapshot of the current AEAD write state for sealing records in
+  /// another isolate, or null when the write state is not an AEAD one.
+  RecordSealParams? exportWriteState() {
+    final state = _writeState;
+    final key = state.aeadKey;
+    if (key == null || !(state.encContext?.isAEAD ?? false)) {
+      return null;
     }
+    return RecordSealParams(
+      cipherSuite: state.cipherSuite,
+      key: key,
+      fixedNonce: state.fixedNonce!,
+      recordVersion: _recordSocket.version,
+      version: version,
+      tls13: _isTls13Plus(),
+      implementations: _cipherImplementations,
+    );
   }
-  
+
+  /// Claims [count] consecutive write sequence numbers and returns the
+  /// first; the records must then be sealed elsewhere with exactly those.
+  int reserveWriteSequence(int count) {
+    final first = _writeState.seqnum;
+    _writeState.seqnum += count;
+    return first;
+  }
+
+  /// Seals [buf] into a freshly allocated, ready to send record.
   Uint8List _encryptThenSeal(Uint8List buf, int contentType) {
-    final seqNumBytes = _writeState.getSeqNumBytes();
-    
-    Uint8List authData;
-    
-    if (!_isTls13Plus()) {
-      authData = Uint8List.fromList([
-        ...seqNumBytes,
-        contentType,
-        version.major,
-        version.minor,
-        buf.length >> 8,
-        buf.length & 0xff
-      ]);
-    } else {
-      final outLen = buf.length + (_writeState.encContext.tagLength as int);
-      authData = Uint8List.fromList([
-        contentType,
-        _recordSocket.version.major,
-        _recordSocket.version.minor,
-        outLen >> 8,
-        outLen & 0xff
-      ]);
-    }
-    
-    final nonce = _getNonce(_writeState, seqNumBytes);
-    
-    // Assuming seal returns ciphertext + tag
-    buf = _writeState.encContext.seal(nonce, buf, authData);
-    
-    if (_writeState.encContext.name.contains("aes") && !_isTls13Plus()) {
-      buf = Uint8List.fromList([...seqNumBytes, ...buf]);
-    }
-    
-    return buf;
+    final record = Uint8List(sealedRecordLength(buf.length));
+    sealRecordInto(buf, contentType, record);
+    return record;
   }
   
   (Uint8List, int) _ssl2Encrypt(Uint8List data) {
@@ -466,7 +682,7 @@ class RecordLayer {
     }
     
     if (_writeState.macContext != null) {
-      final mac = _writeState.macContext.copy();
+      final mac = _writeState.macContext!.copy();
       mac.update(data); // compatHMAC(data)
       mac.update(seqnumBytes.sublist(seqnumBytes.length - 4)); // compatHMAC(seqnumBytes[-4:])
       final macBytes = mac.digest();
@@ -481,18 +697,78 @@ class RecordLayer {
   }
 
   Future<void> sendRecord(Message msg) async {
-    var data = msg.write();
-    var contentType = msg.contentType;
-
-    if (_isTls13Plus() && _writeState.encContext != null && contentType != ContentType.change_cipher_spec) {
-      data = Uint8List.fromList([...data, contentType]);
-      if (padding_cb != null) {
-        final maxPadding = sendRecordLimit - data.length - 1;
-        final padding = padding_cb(data.length, contentType, maxPadding) as List<int>;
-        data = Uint8List.fromList([...data, ...padding]);
-      }
-      contentType = ContentType.application_data;
+    bufferRecord(msg);
+    await _recordSocket.flush();
+  }
+
+  /// The plaintext that gets protected for [msg] and the record type on
+  /// the wire: TLS 1.3 appends the real type and the padding (TLSInnerPlaintext)
+  /// and sends everything as application_data.
+  (Uint8List, int) recordPlaintext(Message msg) {
+    final data = msg.write();
+    if (!_wrapsInnerPlaintext(msg.contentType)) {
+      return (data, msg.contentType);
     }
+    final padding = _innerPadding(data.length, msg.contentType);
+    final inner = Uint8List(data.length + 1 + (padding?.length ?? 0));
+    _writeInnerPlaintext(inner, 0, data, msg.contentType, padding);
+    return (inner, ContentType.application_data);
+  }
+
+  /// Whether records of [contentType] are sent as TLSInnerPlaintext.
+  bool _wrapsInnerPlaintext(int contentType) =>
+      _isTls13Plus() &&
+      _writeState.encContext != null &&
+      contentType != ContentType.change_cipher_spec;
+
+  /// Padding chosen by [padding_cb] for [length] bytes of content, or null.
+  List<int>? _innerPadding(int length, int contentType) {
+    if (padding_cb == null) {
+      return null;
+    }
+    final maxPadding = sendRecordLimit - length - 2;
+    return padding_cb(length + 1, contentType, maxPadding) as List<int>;
+  }
+
+  /// Writes `content || type || padding` into [out] at [offset].
+  static void _writeInnerPlaintext(Uint8List out, int offset, Uint8List data,
+      int contentType, List<int>? padding) {
+    out.setRange(offset, offset + data.length, data);
+    offset += data.length;
+    out[offset++] = contentType;
+    if (padding != null) {
+      out.setRange(offset, offset + padding.length, padding);
+    }
+  }
+
+  /// Seals [msg] as a TLS 1.3 record: TLSInnerPlaintext is laid out where
+  /// the ciphertext goes in the record buffer and encrypted in place, so
+  /// the record is the only allocation besides the message encoding.
+  Uint8List _sealInnerPlaintext(Message msg) {
+    final data = msg.write();
+    final padding = _innerPadding(data.length, msg.contentType);
+    final innerLength = data.length + 1 + (padding?.length ?? 0);
+    final record = Uint8List(sealedRecordLength(innerLength));
+    _writeInnerPlaintext(
+        record, _recordHeaderLength, data, msg.contentType, padding);
+    sealRecordInto(
+        Uint8List.sublistView(
+            record, _recordHeaderLength, _recordHeaderLength + innerLength),
+        ContentType.application_data,
+        record);
+    return record;
+  }
+
+  /// Protect [msg] and append the record to the output buffer without
+  /// flushing; several records queued this way go out in one socket write
+  /// on [flushRecords].
+  void bufferRecord(Message msg) {
+    if (_wrapsInnerPlaintext(msg.contentType) &&
+        (_writeState.encContext.isAEAD ?? false)) {
+      _recordSocket.queueRecordBytes(_sealInnerPlaintext(msg));
+      return;
+    }
+    var (data, contentType) = recordPlaintext(msg);
 
     int padding = 0;
     if (version == const TlsProtocolVersion(0, 2) || version == const TlsProtocolVersion(2, 0)) {
@@ -502,7 +778,8 @@ class RecordLayer {
     } else if (version > const TlsProtocolVersion(3, 3) && contentType == ContentType.change_cipher_spec) {
       // TLS 1.3 does not encrypt CCS
     } else if (_writeState.encContext != null && (_writeState.encContext.isAEAD ?? false)) {
-      data = _encryptThenSeal(data, contentType);
+      _recordSocket.queueRecordBytes(_encryptThenSeal(data, contentType));
+      return;
     } else if (_writeState.encryptThenMAC) {
       data = _encryptThenMAC(data, contentType);
     } else {
@@ -510,29 +787,36 @@ class RecordLayer {
     }
 
     final encryptedMessage = Message(contentType, data);
-    await _recordSocket.send(encryptedMessage, padding);
+    _recordSocket.queue(encryptedMessage, padding);
+  }
+
+  /// Bytes of records queued by [bufferRecord] and not flushed yet.
+  int get pendingRecordBytes => _recordSocket.pendingBytes;
+
+  /// Append records sealed elsewhere (see [exportWriteState]) to the
+  /// output buffer.
+  void bufferSealedRecords(Uint8List records) {
+    _recordSocket.queueRecordBytes(records);
   }
+
+  /// Send all records queued by [bufferRecord].
+  Future<void> flushRecords() => _recordSocket.flush();
   
   Uint8List _decryptStreamThenMAC(int recordType, Uint8List data) {
     if (_readState.encContext != null) {
       data = _readState.encContext.decrypt(data);
     }
     
-    if (_readState.macContext != null) {
+    final mac = _readState.macContext;
+    if (mac != null) {
       bool macGood = true;
-      final macLength = _readState.macContext.digestSize as int;
+      final macLength = mac.digestSize;
       if (data.length < macLength) {
         macGood = false;
       } else {
-        final checkBytes = data.sublist(data.length - macLength);
-        final seqnumBytes = _readState.getSeqNumBytes();
-        final content = data.sublist(0, data.length - macLength);
-        final mac = _readState.macContext.copy();
-        final macBytes = calculateMAC(mac, seqnumBytes, recordType, content);
-        
-        if (!ctCompareDigest(macBytes, checkBytes)) {
-          macGood = false;
-        }
+        final checkBytes = Uint8List.sublistView(data, data.length - macLength);
+        final content = Uint8List.sublistView(data, 0, data.length - macLength);
+        macGood = _checkRecordMac(mac, recordType, content, checkBytes);
         data = content;
       }
       
@@ -567,7 +851,7 @@ class RecordLayer {
 
         final endLength = ciphertext[ciphertext.length - 1] +
             1 +
-            (_readState.macContext.digestSize as int);
+            _readState.macContext!.digestSize;
         return ciphertext.sublist(0, ciphertext.length - endLength);
       }
       data = _readState.encContext.decrypt(ciphertext);
@@ -576,20 +860,17 @@ class RecordLayer {
   }
   
   Uint8List _macThenDecrypt(int recordType, Uint8List buf) {
-    if (_readState.macContext != null) {
-      final macLength = _readState.macContext.digestSize as int;
+    final mac = _readState.macContext;
+    if (mac != null) {
+      final macLength = mac.digestSize;
       if (buf.length < macLength) {
         throw TLSBadRecordMAC("Truncated data");
       }
       
-      final checkBytes = buf.sublist(buf.length - macLength);
-      buf = buf.sublist(0, buf.length - macLength);
-      
-      final seqnumBytes = _readState.getSeqNumBytes();
-      final mac = _readState.macContext.copy();
-      final macBytes = calculateMAC(mac, seqnumBytes, recordType, buf);
+      final checkBytes = Uint8List.sublistView(buf, buf.length - macLength);
+      buf = Uint8List.sublistView(buf, 0, buf.length - macLength);
       
-      if (!ctCompareDigest(macBytes, checkBytes)) {
+      if (!_checkRecordMac(mac, recordType, buf, checkBytes)) {
         throw TLSBadRecordMAC("MAC mismatch");
       }
     }
@@ -633,36 +914,35 @@ class RecordLayer {
     return buf;
   }
   
+  /// Opens an AEAD record. Decryption happens in place: the returned
+  /// plaintext is a view over [buf], whose bytes are overwritten.
   Uint8List _decryptAndUnseal(dynamic header, Uint8List buf) {
-    final seqnumBytes = _readState.getSeqNumBytes();
+    final state = _readState;
+    final cipher = state.encContext;
+    final seq = state.seqnum++;
     Uint8List nonce;
 
-    if (_readState.encContext.name.contains("aes") && !_isTls13Plus()) {
-      final explicitNonceLength = 8;
+    if ((cipher.name as String).contains("aes") && !_isTls13Plus()) {
+      const explicitNonceLength = 8;
       if (explicitNonceLength > buf.length) {
         throw TLSBadRecordMAC("Truncated nonce");
       }
-      nonce = Uint8List.fromList([..._readState.fixedNonce!, ...buf.sublist(0, explicitNonceLength)]);
-      buf = buf.sublist(8);
+      nonce = state.aeadNonce(seq, false);
+      nonce.setRange(nonce.length - explicitNonceLength, nonce.length, buf);
+      buf = Uint8List.sublistView(buf, explicitNonceLength);
     } else {
-      nonce = _getNonce(_readState, seqnumBytes);
+      nonce = state.aeadNonce(seq, _xorsSeqIntoNonce(state));
     }
 
-    if ((_readState.encContext.tagLength as int) > buf.length) {
+    final tagLength = cipher.tagLength as int;
+    if (tagLength > buf.length) {
       throw TLSBadRecordMAC("Truncated tag");
     }
     
     Uint8List authData;
     if (!_isTls13Plus()) {
-      final plaintextLen = buf.length - (_readState.encContext.tagLength as int);
-      authData = Uint8List.fromList([
-        ...seqnumBytes,
-        header.type,
-        version.major,
-        version.minor,
-        plaintextLen >> 8,
-        plaintextLen & 0xff
-      ]);
+      final plaintextLen = buf.length - tagLength;
+      authData = state.tls12AdditionalData(seq, header.type as int, version, plaintextLen);
     } else {
       if (header.type != ContentType.application_data) {
         throw TLSUnexpectedMessage("Invalid ContentType for encrypted record");
@@ -673,10 +953,11 @@ class RecordLayer {
       if (header.length != buf.length) {
         throw TLSBadRecordMAC("Length mismatch");
       }
-      authData = header.write();
+      authData = state.tls13AdditionalData(
+          ContentType.application_data, const TlsProtocolVersion(3, 3), buf.length);
     }
     
-    final result = _readState.encContext.open(nonce, buf, authData);
+    final result = cipher.openInPlace(nonce, buf, authData) as Uint8List?;
     if (result == null) {
       throw TLSBadRecordMAC("Invalid tag, decryption failure");
     }
@@ -700,7 +981,7 @@ class RecordLayer {
       final macBytes = data.sublist(0, 16);
       data = data.sublist(16);
       
-      final mac = _readState.macContext.copy();
+      final mac = _readState.macContext!.copy();
       mac.update(data);
       mac.update(seqnumBytes.sublist(seqnumBytes.length - 4));
       final calcMac = mac.digest();
@@ -719,7 +1000,7 @@ class RecordLayer {
   static (Uint8List, int) _tls13DePad(Uint8List data) {
     for (var i = data.length - 1; i >= 0; i--) {
       if (data[i] != 0) {
-        return (data.sublist(0, i), data[i]);
+        return (Uint8List.sublistView(data, 0, i), data[i]);
       }
     }
     throw TLSUnexpectedMessage("Malformed record layer inner plaintext - content type missing");
@@ -824,6 +1105,7 @@ class RecordLayer {
       _pendingWriteState.seqnum = _writeState.seqnum;
     }
     _writeState = _pendingWriteState;
+    _writeEpoch++;
     _pendingWriteState = ConnectionState();
   }
 
@@ -835,6 +1117,14 @@ class RecordLayer {
     _pendingReadState = ConnectionState();
   }
 
+  /// Creates the AEAD cipher of [cipherSuite] for [key], as the pending
+  /// states do.
+  static dynamic createAeadCipher(
+      int cipherSuite, Uint8List key, List<String>? implementations) {
+    final (_, _, createCipherFunc) = _getCipherSettings(cipherSuite);
+    return createCipherFunc!(key, implementations: implementations);
+  }
+
   static (int, int, Function?) _getCipherSettings(int cipherSuite) {
     if (CipherSuite.aes256GcmSuites.contains(cipherSuite)) {
       return (32, 4, createAESGCM);
@@ -893,6 +1183,7 @@ class RecordLayer {
 
   void calcPendingStates(int cipherSuite, Uint8List masterSecret, Uint8List clientRandom,
       Uint8List serverRandom, List<String>? implementations) {
+    _cipherImplementations = implementations;
     final (keyLength, ivLength, createCipherFunc) = _getCipherSettings(cipherSuite);
     
     final (macLength, digestmod) = _getMacSettings(cipherSuite);
@@ -904,9 +1195,15 @@ class RecordLayer {
 
     final outputLength = (macLength * 2) + (keyLength * 2) + (ivLength * 2);
     
-    final keyBlock = calcKey([version.major, version.minor], masterSecret, cipherSuite,
-        Uint8List.fromList('key expansion'.codeUnits),
-        clientRandom: clientRandom, serverRandom: serverRandom, outputLength: outputLength);
+    final Uint8List keyBlock;
+    if (version >= const TlsProtocolVersion(3, 1) && version <= const TlsProtocolVersion(3, 3)) {
+      keyBlock = TlsPrf([version.major, version.minor], cipherSuite, masterSecret)
+          .keyBlock(clientRandom, serverRandom, outputLength);
+    } else {
+      keyBlock = calcKey([version.major, version.minor], masterSecret, cipherSuite,
+          Uint8List.fromList('key expansion'.codeUnits),
+          clientRandom: clientRandom, serverRandom: serverRandom, outputLength: outputLength);
+    }
 
     final clientPendingState = ConnectionState();
     final serverPendingState = ConnectionState();
@@ -931,6 +1228,12 @@ class RecordLayer {
       if (createCipherFunc != null) {
         clientPendingState.encContext = createCipherFunc(clientKeyBlock, implementations: implementations);
         serverPendingState.encContext = createCipherFunc(serverKeyBlock, implementations: implementations);
+        clientPendingState
+          ..cipherSuite = cipherSuite
+          ..aeadKey = clientKeyBlock;
+        serverPendingState
+          ..cipherSuite = cipherSuite
+          ..aeadKey = serverKeyBlock;
       }
       clientPendingState.fixedNonce = clientIVBlock;
       serverPendingState.fixedNonce = serverIVBlock;
@@ -951,26 +1254,10 @@ class RecordLayer {
   }
   
   void calcTLS1_3PendingState(int cipherSuite, Uint8List clTrafficSecret, Uint8List srTrafficSecret, List<String>? implementations) {
-    final prfName = CipherSuite.sha384PrfSuites.contains(cipherSuite) ? 'sha384' : 'sha256';
-    final (keyLength, ivLength, createCipherFunc) = _getCipherSettings(cipherSuite);
-    // ivLength is 12 for TLS 1.3
-    
-    final clientPendingState = ConnectionState();
-    final serverPendingState = ConnectionState();
-    
-    clientPendingState.macContext = null;
-    clientPendingState.encContext = createCipherFunc!(
-      HKDF_expand_label(clTrafficSecret, Uint8List.fromList('key'.codeUnits), Uint8List(0), keyLength, prfName),
-      implementations: implementations
-    );
-    clientPendingState.fixedNonce = HKDF_expand_label(clTrafficSecret, Uint8List.fromList('iv'.codeUnits), Uint8List(0), 12, prfName);
-    
-    serverPendingState.macContext = null;
-    serverPendingState.encContext = createCipherFunc(
-      HKDF_expand_label(srTrafficSecret, Uint8List.fromList('key'.codeUnits), Uint8List(0), keyLength, prfName),
-      implementations: implementations
-    );
-    serverPendingState.fixedNonce = HKDF_expand_label(srTrafficSecret, Uint8List.fromList('iv'.codeUnits), Uint8List(0), 12, prfName);
+    _cipherImplementations = implementations;
+    final hkdf = Tls13Hkdf.forCipherSuite(cipherSuite);
+    final clientPendingState = _tls13TrafficState(hkdf, cipherSuite, clTrafficSecret);
+    final serverPendingState = _tls13TrafficState(hkdf, cipherSuite, srTrafficSecret);
     
     if (client) {
       _pendingWriteState = clientPendingState;
@@ -980,31 +1267,42 @@ class RecordLayer {
       _pendingReadState = clientPendingState;
     }
   }
-  
-  (Uint8List, ConnectionState) _calcTLS1_3KeyUpdate(int cipherSuite, Uint8List appSecret) {
-    final (prfName, prfLength) = CipherSuite.sha384PrfSuites.contains(cipherSuite) ? ('sha384', 48) : ('sha256', 32);
+
+  /// Connection state keyed from a TLS 1.3 traffic secret.
+  ConnectionState _tls13TrafficState(Tls13Hkdf hkdf, int cipherSuite, Uint8List trafficSecret) {
     final (keyLength, ivLength, createCipherFunc) = _getCipherSettings(cipherSuite);
-    
-    final newAppSecret = HKDF_expand_label(appSecret, Uint8List.fromList('traffic upd'.codeUnits), Uint8List(0), prfLength, prfName);
-    final newState = ConnectionState();
-    newState.macContext = null;
-    newState.encContext = createCipherFunc!(
-      HKDF_expand_label(newAppSecret, Uint8List.fromList('key'.codeUnits), Uint8List(0), keyLength, prfName),
-      implementations: null
+    // ivLength is 12 for TLS 1.3
+    final key = hkdf.trafficKey(trafficSecret, keyLength);
+    final state = ConnectionState();
+    state.macContext = null;
+    state.encContext = createCipherFunc!(
+      key,
+      implementations: _cipherImplementations
     );
-    newState.fixedNonce = HKDF_expand_label(newAppSecret, Uint8List.fromList('iv'.codeUnits), Uint8List(0), 12, prfName);
-    
-    return (newAppSecret, newState);
+    state.fixedNonce = hkdf.trafficIv(trafficSecret);
+    state.cipherSuite = cipherSuite;
+    state.aeadKey = key;
+    return state;
+  }
+  
+  (Uint8List, ConnectionState) _calcTLS1_3KeyUpdate(int cipherSuite, Uint8List appSecret) {
+    final hkdf = Tls13Hkdf.forCipherSuite(cipherSuite);
+    // appSecret already keyed the current traffic keys, so this is a single
+    // HMAC on the cached state.
+    final newAppSecret = hkdf.nextTrafficSecret(appSecret);
+    return (newAppSecret, _tls13TrafficState(hkdf, cipherSuite, newAppSecret));
   }
   
   (Uint8List, Uint8List) calcTLS1_3KeyUpdateSender(int cipherSuite, Uint8List clAppSecret, Uint8List srAppSecret) {
     if (client) {
       final res = _calcTLS1_3KeyUpdate(cipherSuite, clAppSecret);
       _writeState = res.$2;
+      _writeEpoch++;
       return (res.$1, srAppSecret);
     } else {
       final res = _calcTLS1_3KeyUpdate(cipherSuite, srAppSecret);
       _writeState = res.$2;
+      _writeEpoch++;
       return (clAppSecret, res.$1);
     }
   }
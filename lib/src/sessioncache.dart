@@ -1,29 +1,81 @@
-import 'dart:collection';
-import 'dart:convert';
 import 'dart:typed_data';
 
 import 'session.dart';
 
 /// Cache for reusable TLS sessions, mirroring SessionCache.
+///
+/// Entries are keyed by the raw session ID bytes and spread over a
+/// power-of-two number of shards by a hash of the ID. Each shard keeps its
+/// entries on a timer wheel: insertion, lookup, replacement and expiry are
+/// O(1), and expired entries are reclaimed a wheel slot at a time instead of
+/// by scanning on every call.
+///
+/// [Session] objects live on the isolate heap, so a cache is owned by one
+/// isolate; sharding keeps each map and wheel small for caches with many
+/// entries.
 class SessionCache {
-  SessionCache({int maxEntries = 10000, int maxAgeSeconds = 14400})
-      : assert(maxEntries > 0, 'maxEntries must be positive'),
+  /// [shards] is rounded down to a power of two and capped so each shard
+  /// holds at least [minEntriesPerShard] entries. [clock] returns
+  /// milliseconds from a monotonic source and defaults to a [Stopwatch].
+  SessionCache({
+    int maxEntries = 10000,
+    int maxAgeSeconds = 14400,
+    int shards = 16,
+    int Function()? clock,
+  })  : assert(maxEntries > 0, 'maxEntries must be positive'),
         assert(maxAgeSeconds >= 0, 'maxAgeSeconds cannot be negative'),
-        _maxEntries = maxEntries,
-        _maxAgeMillis = maxAgeSeconds * 1000,
-        _order = Queue<_SessionEntry>();
+        assert(shards > 0, 'shards must be positive'),
+        _clock = clock ?? _monotonicMillis {
+    final count = _shardCount(shards, maxEntries);
+    // The first maxEntries % count shards take one entry more, so the
+    // shard limits add up to exactly maxEntries.
+    final perShard = maxEntries ~/ count;
+    final remainder = maxEntries % count;
+    _shardMask = count - 1;
+    _shards = List<_SessionShard>.generate(
+        count,
+        (i) => _SessionShard(
+            perShard + (i < remainder ? 1 : 0), maxAgeSeconds * 1000),
+        growable: false);
+  }
 
-  final int _maxEntries;
-  final int _maxAgeMillis;
-  final Map<String, Session> _entries = <String, Session>{};
-  final Queue<_SessionEntry> _order;
+  /// Smallest number of entries a shard is given; smaller caches use fewer
+  /// shards so that eviction order stays close to global insertion order.
+  static const int minEntriesPerShard = 256;
+
+  final int Function() _clock;
+  late final int _shardMask;
+  late final List<_SessionShard> _shards;
+
+  /// Number of shards actually in use.
+  int get shardCount => _shards.length;
+
+  /// Number of entries currently held, including ones that have expired but
+  /// whose wheel slot has not been reclaimed yet.
+  int get length {
+    var total = 0;
+    for (final shard in _shards) {
+      total += shard.length;
+    }
+    return total;
+  }
+
+  /// Snapshot of the hit, miss, eviction and expiry counters.
+  SessionCacheStats get stats {
+    var hits = 0, misses = 0, evictions = 0, expirations = 0;
+    for (final shard in _shards) {
+      hits += shard.hits;
+      misses += shard.misses;
+      evictions += shard.evictions;
+      expirations += shard.expirations;
+    }
+    return SessionCacheStats(hits, misses, evictions, expirations, length);
+  }
 
   /// Returns an existing, still valid session for [sessionId] or throws.
   Session operator [](List<int> sessionId) {
-    _purgeExpired();
-    final key = _keyFor(sessionId);
-    final session = _entries[key];
-    if (session == null || !session.valid()) {
+    final session = getOrNull(sessionId);
+    if (session == null) {
       throw StateError('Session not found or not resumable');
     }
     return session;
@@ -31,76 +83,261 @@ class SessionCache {
 
   /// Stores [session] under [sessionId], evicting old entries as needed.
   void operator []=(List<int> sessionId, Session session) {
-    final key = _keyFor(sessionId);
-    _purgeExpired();
-    _entries[key] = session;
-    _order.addLast(_SessionEntry(key, _nowMillis()));
-    _trimCapacity();
+    final key = _SessionKey(Uint8List.fromList(sessionId));
+    _shardFor(key).put(key, session, _clock());
   }
 
   /// Best-effort lookup that returns null instead of throwing.
   Session? getOrNull(List<int> sessionId) {
-    try {
-      return this[sessionId];
-    } catch (_) {
-      return null;
-    }
+    // Lookups only read the key, so a Uint8List is wrapped without copying.
+    final key = _SessionKey(
+        sessionId is Uint8List ? sessionId : Uint8List.fromList(sessionId));
+    return _shardFor(key).get(key, _clock());
   }
 
-  /// Removes all cached sessions.
+  /// Removes all cached sessions. Counters are kept.
   void clear() {
-    _entries.clear();
-    _order.clear();
+    for (final shard in _shards) {
+      shard.clear();
+    }
   }
 
-  void _trimCapacity() {
-    while (_entries.length > _maxEntries && _order.isNotEmpty) {
-      final oldest = _order.removeFirst();
-      _entries.remove(oldest.key);
+  _SessionShard _shardFor(_SessionKey key) =>
+      _shards[(key.hashCode >> 16) & _shardMask];
+
+  static int _shardCount(int requested, int maxEntries) {
+    var limit = maxEntries ~/ minEntriesPerShard;
+    if (limit > requested) {
+      limit = requested;
     }
+    var count = 1;
+    while (count * 2 <= limit) {
+      count *= 2;
+    }
+    return count;
   }
 
-  void _purgeExpired() {
-    if (_maxAgeMillis == 0) {
-      // Age zero means entries expire immediately after insertion.
-      while (_order.isNotEmpty) {
-        final entry = _order.removeFirst();
-        _entries.remove(entry.key);
+  static final Stopwatch _stopwatch = Stopwatch()..start();
+
+  static int _monotonicMillis() => _stopwatch.elapsedMilliseconds;
+}
+
+/// Counters reported by [SessionCache.stats].
+class SessionCacheStats {
+  const SessionCacheStats(
+      this.hits, this.misses, this.evictions, this.expirations, this.length);
+
+  /// Lookups that returned a resumable session.
+  final int hits;
+
+  /// Lookups that found nothing, an expired entry or a non-resumable session.
+  final int misses;
+
+  /// Entries dropped to stay within `maxEntries`.
+  final int evictions;
+
+  /// Entries dropped because they outlived `maxAgeSeconds`.
+  final int expirations;
+
+  /// Entries held when the snapshot was taken.
+  final int length;
+
+  @override
+  String toString() => 'SessionCacheStats(hits: $hits, misses: $misses, '
+      'evictions: $evictions, expirations: $expirations, length: $length)';
+}
+
+/// Session ID bytes with a precomputed FNV-1a hash.
+class _SessionKey {
+  _SessionKey(this.bytes) : hashCode = _fnv1a(bytes);
+
+  final Uint8List bytes;
+
+  @override
+  final int hashCode;
+
+  @override
+  bool operator ==(Object other) {
+    if (other is! _SessionKey || other.hashCode != hashCode) {
+      return false;
+    }
+    final a = bytes;
+    final b = other.bytes;
+    if (a.length != b.length) {
+      return false;
+    }
+    for (var i = 0; i < a.length; i++) {
+      if (a[i] != b[i]) {
+        return false;
       }
-      return;
     }
+    return true;
+  }
+
+  static int _fnv1a(Uint8List bytes) {
+    var hash = 0x811c9dc5;
+    for (var i = 0; i < bytes.length; i++) {
+      hash = ((hash ^ bytes[i]) * 0x01000193) & 0xffffffff;
+    }
+    return hash;
+  }
+}
 
-    final now = _nowMillis();
-    while (_order.isNotEmpty) {
-      final entry = _order.first;
-      final remaining = _entries.containsKey(entry.key);
-      if (!remaining) {
-        _order.removeFirst();
-        continue;
-      }
-      final expired = now - entry.timestampMillis > _maxAgeMillis;
-      if (expired) {
+class _SessionEntry {
+  _SessionEntry(this.key, this.session, this.expiresAtMillis);
+
+  final _SessionKey key;
+  final Session session;
+  final int expiresAtMillis;
+  int slot = 0;
+  _SessionEntry? previous;
+  _SessionEntry? next;
+}
+
+/// One shard: a map for lookups plus a timer wheel of intrusive lists.
+///
+/// An entry expiring during tick `t` (ticks are [_tickMillis] long) sits in
+/// slot `t % wheelSize`, appended at the tail. Every entry shares the same
+/// max age, so an entry is never more than `wheelSize - 1` ticks ahead of
+/// the cursor: when the cursor passes a slot, everything in it has expired
+/// and the whole list is dropped. Slots are in insertion order, so the
+/// oldest entry is the head of the first non-empty slot at or after the
+/// cursor.
+class _SessionShard {
+  _SessionShard(this._maxEntries, this._maxAgeMillis)
+      : _tickMillis = _maxAgeMillis ~/ (wheelSize - 2) + 1;
+
+  static const int wheelSize = 64;
+
+  final int _maxEntries;
+  final int _maxAgeMillis;
+  final int _tickMillis;
+  final Map<_SessionKey, _SessionEntry> _entries =
+      <_SessionKey, _SessionEntry>{};
+  final List<_SessionEntry?> _heads =
+      List<_SessionEntry?>.filled(wheelSize, null);
+  final List<_SessionEntry?> _tails =
+      List<_SessionEntry?>.filled(wheelSize, null);
+  int _cursorTick = -1;
+
+  int hits = 0;
+  int misses = 0;
+  int evictions = 0;
+  int expirations = 0;
+
+  int get length => _entries.length;
+
+  Session? get(_SessionKey key, int now) {
+    _advance(now);
+    final entry = _entries[key];
+    if (entry == null) {
+      misses++;
+      return null;
+    }
+    if (now >= entry.expiresAtMillis) {
+      _remove(entry);
+      expirations++;
+      misses++;
+      return null;
+    }
+    if (!entry.session.valid()) {
+      misses++;
+      return null;
+    }
+    hits++;
+    return entry.session;
+  }
+
+  void put(_SessionKey key, Session session, int now) {
+    _advance(now);
+    final previous = _entries.remove(key);
+    if (previous != null) {
+      _unlink(previous);
+    }
+    final entry = _SessionEntry(key, session, now + _maxAgeMillis);
+    _entries[key] = entry;
+    _link(entry, (entry.expiresAtMillis + _tickMillis - 1) ~/ _tickMillis);
+    while (_entries.length > _maxEntries) {
+      _remove(_oldest()!);
+      evictions++;
+    }
+  }
+
+  void clear() {
+    _entries.clear();
+    _heads.fillRange(0, wheelSize, null);
+    _tails.fillRange(0, wheelSize, null);
+  }
+
+  /// Moves the cursor up to the current tick, dropping every slot passed.
+  void _advance(int now) {
+    final nowTick = now ~/ _tickMillis;
+    if (_cursorTick < 0) {
+      _cursorTick = nowTick;
+      return;
+    }
+    if (nowTick - _cursorTick >= wheelSize) {
+      // Idle for a full turn: everything has expired.
+      expirations += _entries.length;
+      clear();
+      _cursorTick = nowTick;
+      return;
+    }
+    while (_cursorTick < nowTick) {
+      _cursorTick++;
+      final slot = _cursorTick % wheelSize;
+      for (var entry = _heads[slot]; entry != null; entry = entry.next) {
         _entries.remove(entry.key);
-        _order.removeFirst();
-        continue;
+        expirations++;
       }
-      break;
+      _heads[slot] = null;
+      _tails[slot] = null;
     }
   }
 
-  static String _keyFor(List<int> sessionId) {
-    final bytes = sessionId is Uint8List
-        ? sessionId
-        : Uint8List.fromList(List<int>.from(sessionId));
-    return base64Encode(bytes);
+  _SessionEntry? _oldest() {
+    for (var i = 0; i < wheelSize; i++) {
+      final head = _heads[(_cursorTick + i) % wheelSize];
+      if (head != null) {
+        return head;
+      }
+    }
+    return null;
   }
 
-  static int _nowMillis() => DateTime.now().millisecondsSinceEpoch;
-}
+  void _remove(_SessionEntry entry) {
+    _entries.remove(entry.key);
+    _unlink(entry);
+  }
 
-class _SessionEntry {
-  _SessionEntry(this.key, this.timestampMillis);
+  void _link(_SessionEntry entry, int expiryTick) {
+    final slot = expiryTick % wheelSize;
+    entry.slot = slot;
+    final tail = _tails[slot];
+    entry.previous = tail;
+    entry.next = null;
+    if (tail == null) {
+      _heads[slot] = entry;
+    } else {
+      tail.next = entry;
+    }
+    _tails[slot] = entry;
+  }
 
-  final String key;
-  final int timestampMillis;
+  void _unlink(_SessionEntry entry) {
+    final previous = entry.previous;
+    final next = entry.next;
+    if (previous == null) {
+      _heads[entry.slot] = next;
+    } else {
+      previous.next = next;
+    }
+    if (next == null) {
+      _tails[entry.slot] = previous;
+    } else {
+      next.previous = previous;
+    }
+    entry.previous = null;
+    entry.next = null;
+  }
 }
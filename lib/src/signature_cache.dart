@@ -0,0 +1,143 @@
+import 'dart:collection';
+import 'dart:typed_data';
+
+import 'crypto/streaming_digest.dart';
+import 'utils/compat.dart';
+import 'utils/cryptomath.dart';
+import 'utils/dart_ecdsakey.dart';
+import 'utils/dsakey.dart';
+import 'utils/eddsakey.dart';
+import 'utils/rsakey.dart';
+
+/// Memo of signatures that have already been verified.
+///
+/// The same intermediates and roots arrive on every handshake with a given
+/// server, and OCSP responses are reused until they expire, so their
+/// RSA/ECDSA checks are repeated with identical inputs. Entries are keyed by
+/// a SHA-256 over the public components of the verifying key, the
+/// signature algorithm, the signed bytes and the signature, so a hit
+/// requires all four to match exactly. Only successful verifications are
+/// recorded: a failure always reruns the check and is never served from
+/// the cache.
+///
+/// The cache is bounded; once [maxEntries] is reached the least recently
+/// used entry is dropped.
+class SignatureVerificationCache {
+  SignatureVerificationCache({this.maxEntries = 1024})
+      : assert(maxEntries > 0, 'maxEntries must be positive');
+
+  /// Cache used for certificate and OCSP signatures when no other cache is
+  /// given.
+  static final SignatureVerificationCache shared =
+      SignatureVerificationCache();
+
+  /// Upper bound on the number of remembered signatures.
+  final int maxEntries;
+
+  final LinkedHashSet<String> _entries = LinkedHashSet<String>();
+
+  /// Number of signatures currently remembered.
+  int get length => _entries.length;
+
+  /// Forgets every remembered signature.
+  void clear() => _entries.clear();
+
+  /// Returns true when [signature] was verified before with [publicKey],
+  /// otherwise runs [verifier] and remembers the result if it succeeded.
+  ///
+  /// [verifier] must check the signature with [publicKey] itself: the entry
+  /// is keyed on that key's own public components, never on a separately
+  /// supplied encoding, so a hit always names the key that verified it.
+  /// Keys of a type the cache cannot encode are verified every time.
+  /// Exceptions thrown by [verifier] propagate and nothing is recorded.
+  bool verify({
+    required Object publicKey,
+    required List<int> algorithm,
+    required List<int> signedData,
+    required List<int> signature,
+    required bool Function() verifier,
+  }) {
+    final keyFields = _publicKeyFields(publicKey);
+    if (keyFields == null) {
+      return verifier();
+    }
+    final key = _key([...keyFields, algorithm, signedData, signature]);
+    if (_entries.remove(key)) {
+      _entries.add(key);
+      return true;
+    }
+    if (!verifier()) {
+      return false;
+    }
+    _entries.add(key);
+    if (_entries.length > maxEntries) {
+      _entries.remove(_entries.first);
+    }
+    return true;
+  }
+
+  /// The public components of [publicKey], led by a type tag, or null when
+  /// the key type is unknown or the key is unusable.
+  static List<List<int>>? _publicKeyFields(Object publicKey) {
+    try {
+      if (publicKey is RSAKey) {
+        return [
+          'rsa'.codeUnits,
+          publicKey.keyType.codeUnits,
+          numberToByteArray(publicKey.n),
+          numberToByteArray(publicKey.e),
+        ];
+      }
+      if (publicKey is DSAKey) {
+        return [
+          'dsa'.codeUnits,
+          numberToByteArray(publicKey.p),
+          numberToByteArray(publicKey.q),
+          numberToByteArray(publicKey.g),
+          numberToByteArray(publicKey.y),
+        ];
+      }
+      if (publicKey is DartECDSAKey) {
+        return [
+          'ecdsa'.codeUnits,
+          publicKey.curveName.codeUnits,
+          numberToByteArray(publicKey.publicPointX),
+          numberToByteArray(publicKey.publicPointY),
+        ];
+      }
+      if (publicKey is DartEdDSAKey) {
+        return [
+          'eddsa'.codeUnits,
+          publicKey.curveName.codeUnits,
+          publicKey.publicKeyBytes,
+        ];
+      }
+      if (publicKey is Ed448PublicKey) {
+        return [
+          'eddsa'.codeUnits,
+          'Ed448'.codeUnits,
+          publicKey.publicKeyBytes,
+        ];
+      }
+    } on StateError {
+      // A point at infinity has no encoding; let the verifier reject it.
+    }
+    return null;
+  }
+
+  static String _key(List<List<int>> fields) {
+    final digest = StreamingDigest('sha256');
+    final lengthBytes = Uint8List(4);
+    for (final field in fields) {
+      final length = field.length;
+      lengthBytes
+        ..[0] = (length >> 24) & 0xff
+        ..[1] = (length >> 16) & 0xff
+        ..[2] = (length >> 8) & 0xff
+        ..[3] = length & 0xff;
+      digest.update(lengthBytes);
+      digest.update(field);
+    }
+    return hexEncode(digest.finish());
+  }
+}
@@ -1,5 +1,6 @@
 import 'dart:typed_data';
 
+import 'signature_cache.dart';
 import 'utils/cryptomath.dart';
 import 'utils/dsakey.dart';
 import 'utils/ecdsakey.dart';
@@ -141,9 +142,16 @@ class SignedObject {
   _oidKey([0x2b, 0x65, 0x71]): _SignatureAlgorithm.eddsa('ed448'),
   };
 
+  /// Verify [signature] over [tbsData] with [publicKey].
+  ///
+  /// When [cache] is given, a successful check is remembered there, keyed
+  /// on [publicKey] itself, and not repeated for the same key, payload and
+  /// signature. Key size and hash policy from [settings] is enforced on
+  /// every call.
   bool verifySignature(
   Object publicKey, {
   SignatureSettings? settings,
+  SignatureVerificationCache? cache,
   }) {
     final sig = signature;
     final alg = signatureAlgorithm;
@@ -165,6 +173,19 @@ class SignedObject {
       );
     }
 
+    bool memoized(bool Function() verifier) {
+      if (cache == null) {
+        return verifier();
+      }
+      return cache.verify(
+        publicKey: publicKey,
+        algorithm: alg,
+        signedData: data,
+        signature: sig,
+        verifier: verifier,
+      );
+    }
+
     switch (descriptor.keyType) {
       case _SignatureKeyType.rsa:
         if (publicKey is! RSAKey) {
@@ -184,12 +205,12 @@ class SignedObject {
           throw ArgumentError('RSA scheme $scheme not allowed');
         }
         final normalized = _normalizeRsaSignature(sig, publicKey);
-        final verified = publicKey.hashAndVerify(
-          normalized,
-          data,
-          rsaScheme: (scheme ?? 'pkcs1').toUpperCase(),
-          hAlg: hashName,
-        );
+        final verified = memoized(() => publicKey.hashAndVerify(
+              normalized,
+              data,
+              rsaScheme: (scheme ?? 'pkcs1').toUpperCase(),
+              hAlg: hashName,
+            ));
         if (!verified) {
           throw StateError('Signature could not be verified for $hashName');
         }
@@ -199,7 +220,8 @@ class SignedObject {
           throw ArgumentError('ECDSA signature requires an ECDSAKey');
         }
         final hashName = descriptor.hashName ?? 'sha256';
-        final verified = publicKey.hashAndVerify(sig, data, hAlg: hashName);
+        final verified =
+            memoized(() => publicKey.hashAndVerify(sig, data, hAlg: hashName));
         if (!verified) {
           throw StateError('Signature could not be verified for $hashName');
         }
@@ -209,7 +231,8 @@ class SignedObject {
           throw ArgumentError('DSA signature requires a DSAKey');
         }
         final hashName = descriptor.hashName ?? 'sha1';
-        final verified = publicKey.hashAndVerify(sig, data, hashName);
+        final verified =
+            memoized(() => publicKey.hashAndVerify(sig, data, hashName));
         if (!verified) {
           throw StateError('Signature could not be verified for $hashName');
         }
@@ -219,7 +242,7 @@ class SignedObject {
           throw ArgumentError('EdDSA signature requires an EdDSAKey');
         }
         final curve = descriptor.hashName ?? 'ed25519';
-        final verified = publicKey.hashAndVerify(sig, data);
+        final verified = memoized(() => publicKey.hashAndVerify(sig, data));
         if (!verified) {
           throw StateError('Signature could not be verified for $curve');
         }
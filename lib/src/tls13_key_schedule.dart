@@ -0,0 +1,208 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'constants.dart';
+import 'crypto/streaming_digest.dart';
+import 'utils/tlshmac.dart';
+
+/// HKDF (RFC 5869) and the TLS 1.3 label functions (RFC 8446, section 7.1)
+/// for one hash.
+///
+/// Instances are shared per hash ([of]). Keyed HMAC states are cached per
+/// secret object, so every label expanded from the same secret (key, iv,
+/// finished, traffic upd, ...) skips the pad setup. The `HkdfLabel`
+/// encodings of the fixed-length, context-free labels are built once and
+/// reused. Secrets handed to this class must not be mutated afterwards.
+class Tls13Hkdf {
+  Tls13Hkdf._(this.hashName)
+      : hashLength = StreamingDigest(hashName).digestSize,
+        emptyHash = StreamingDigest(hashName).finish();
+
+  static final Map<String, Tls13Hkdf> _instances = {};
+
+  /// Shared instance for [hashName] ('sha256' or 'sha384').
+  static Tls13Hkdf of(String hashName) =>
+      _instances[hashName] ??= Tls13Hkdf._(hashName);
+
+  /// Instance for the PRF hash of a TLS 1.3 [cipherSuite].
+  static Tls13Hkdf forCipherSuite(int cipherSuite) =>
+      of(CipherSuite.sha384PrfSuites.contains(cipherSuite)
+          ? 'sha384'
+          : 'sha256');
+
+  static final Uint8List _labelPrefix = ascii.encode('tls13 ');
+  static final Uint8List _keyLabel = ascii.encode('key');
+  static final Uint8List _ivLabel = ascii.encode('iv');
+  static final Uint8List _finishedLabel = ascii.encode('finished');
+  static final Uint8List _trafficUpdLabel = ascii.encode('traffic upd');
+  static final Uint8List _derivedLabel = ascii.encode('derived');
+
+  final String hashName;
+  final int hashLength;
+
+  /// `Hash("")`, the transcript of context-free Derive-Secret calls.
+  final Uint8List emptyHash;
+
+  final Expando<TlsHmac> _keyed = Expando<TlsHmac>('Tls13Hkdf');
+  final Map<int, Uint8List> _emptyContextInfo = {};
+  final Uint8List _counter = Uint8List(1);
+
+  TlsHmac _hmacFor(Uint8List secret) =>
+      _keyed[secret] ??= TlsHmac(secret, digestmod: hashName);
+
+  /// `HMAC-Hash(key, data)` on a cached keyed state for [key].
+  Uint8List hmac(Uint8List key, List<int> data) {
+    final mac = _hmacFor(key)..reset();
+    mac.update(data);
+    final out = Uint8List(hashLength);
+    mac.finishInto(out);
+    return out;
+  }
+
+  /// `HKDF-Extract(salt, ikm)`; a null [salt] is `hashLength` zero bytes.
+  Uint8List extract(Uint8List? salt, List<int> ikm) =>
+      hmac(salt ?? Uint8List(hashLength), ikm);
+
+  /// Encodes `HkdfLabel` for [label] (without the "tls13 " prefix).
+  Uint8List hkdfLabel(List<int> label, List<int> context, int length) {
+    final labelLength = _labelPrefix.length + label.length;
+    final info = Uint8List(4 + labelLength + context.length);
+    info[0] = length >> 8;
+    info[1] = length & 0xff;
+    info[2] = labelLength;
+    info.setRange(3, 3 + _labelPrefix.length, _labelPrefix);
+    info.setRange(3 + _labelPrefix.length, 3 + labelLength, label);
+    info[3 + labelLength] = context.length;
+    info.setRange(4 + labelLength, info.length, context);
+    return info;
+  }
+
+  /// `HKDF-Expand(secret, info, length)`.
+  Uint8List expand(Uint8List secret, List<int> info, int length) {
+    final mac = _hmacFor(secret);
+    final out = Uint8List(length);
+    final block = Uint8List(hashLength);
+    var pos = 0;
+    for (var i = 1; pos < length; i++) {
+      mac.reset();
+      if (i > 1) {
+        mac.update(block);
+      }
+      mac.update(info);
+      _counter[0] = i;
+      mac.update(_counter);
+      mac.finishInto(block);
+      final n = length - pos < hashLength ? length - pos : hashLength;
+      out.setRange(pos, pos + n, block);
+      pos += n;
+    }
+    return out;
+  }
+
+  /// `HKDF-Expand-Label(secret, label, context, length)`.
+  Uint8List expandLabel(
+          Uint8List secret, List<int> label, List<int> context, int length) =>
+      expand(secret, hkdfLabel(label, context, length), length);
+
+  /// `Derive-Secret(secret, label, messages)` given the transcript hash;
+  /// a null [transcriptHash] stands for an empty transcript.
+  Uint8List deriveSecret(
+          Uint8List secret, List<int> label, Uint8List? transcriptHash) =>
+      expandLabel(secret, label, transcriptHash ?? emptyHash, hashLength);
+
+  /// Cached `HkdfLabel` for a context-free label; [id] distinguishes the
+  /// labels below.
+  Uint8List _constantInfo(int id, Uint8List label, int length) =>
+      _emptyContextInfo[(id << 16) | length] ??=
+          hkdfLabel(label, const [], length);
+
+  /// Record protection key of [trafficSecret].
+  Uint8List trafficKey(Uint8List trafficSecret, int keyLength) => expand(
+      trafficSecret, _constantInfo(0, _keyLabel, keyLength), keyLength);
+
+  /// Record protection IV of [trafficSecret].
+  Uint8List trafficIv(Uint8List trafficSecret, [int ivLength = 12]) =>
+      expand(trafficSecret, _constantInfo(1, _ivLabel, ivLength), ivLength);
+
+  /// Finished key of a handshake traffic secret.
+  Uint8List finishedKey(Uint8List trafficSecret) => expand(trafficSecret,
+      _constantInfo(2, _finishedLabel, hashLength), hashLength);
+
+  /// Finished verify_data for [trafficSecret] over [transcriptHash].
+  Uint8List finishedVerifyData(
+          Uint8List trafficSecret, Uint8List transcriptHash) =>
+      hmac(finishedKey(trafficSecret), transcriptHash);
+
+  /// Next application traffic secret (KeyUpdate): a single HMAC over the
+  /// cached label when [trafficSecret] has already been used.
+  Uint8List nextTrafficSecret(Uint8List trafficSecret) => expand(
+      trafficSecret,
+      _constantInfo(3, _trafficUpdLabel, hashLength),
+      hashLength);
+
+  /// `Derive-Secret(secret, "derived", "")`, the salt of the next stage.
+  Uint8List derivedSalt(Uint8List secret) => expand(
+      secret, _constantInfo(4, _derivedLabel, hashLength), hashLength);
+}
+
+/// The TLS 1.3 key schedule (RFC 8446, section 7.1) of one connection.
+///
+/// Walks early -> handshake -> master secret and derives the traffic
+/// secrets of each stage from a transcript hash. All derivations go through
+/// the shared [Tls13Hkdf] of the negotiated hash, so keyed HMAC states are
+/// reused across stages and later by the record layer.
+class Tls13KeySchedule {
+  /// Starts the schedule with `Early Secret = HKDF-Extract(0, psk)`; without
+  /// a [psk] the IKM is `hashLength` zero bytes.
+  Tls13KeySchedule(String hashName, {Uint8List? psk})
+      : hkdf = Tls13Hkdf.of(hashName) {
+    earlySecret = hkdf.extract(null, psk ?? Uint8List(hkdf.hashLength));
+  }
+
+  final Tls13Hkdf hkdf;
+
+  late final Uint8List earlySecret;
+  Uint8List? _handshakeSecret;
+  Uint8List? _masterSecret;
+
+  /// Handshake Secret; available after [deriveHandshakeSecret].
+  Uint8List get handshakeSecret =>
+      _handshakeSecret ?? (throw StateError('Handshake secret not derived'));
+
+  /// Master Secret; available after [deriveMasterSecret].
+  Uint8List get masterSecret =>
+      _masterSecret ?? (throw StateError('Master secret not derived'));
+
+  /// Mixes the (EC)DHE [sharedSecret] in.
+  Uint8List deriveHandshakeSecret(Uint8List sharedSecret) =>
+      _handshakeSecret =
+          hkdf.extract(hkdf.derivedSalt(earlySecret), sharedSecret);
+
+  /// Derives the Master Secret from the Handshake Secret.
+  Uint8List deriveMasterSecret() => _masterSecret = hkdf.extract(
+      hkdf.derivedSalt(handshakeSecret), Uint8List(hkdf.hashLength));
+
+  static final Uint8List _cHsTraffic = ascii.encode('c hs traffic');
+  static final Uint8List _sHsTraffic = ascii.encode('s hs traffic');
+  static final Uint8List _cApTraffic = ascii.encode('c ap traffic');
+  static final Uint8List _sApTraffic = ascii.encode('s ap traffic');
+  static final Uint8List _resMaster = ascii.encode('res master');
+
+  /// Client and server handshake traffic secrets over ClientHello..ServerHello.
+  (Uint8List, Uint8List) handshakeTrafficSecrets(Uint8List helloHash) => (
+        hkdf.deriveSecret(handshakeSecret, _cHsTraffic, helloHash),
+        hkdf.deriveSecret(handshakeSecret, _sHsTraffic, helloHash),
+      );
+
+  /// Client and server application traffic secrets over
+  /// ClientHello..server Finished.
+  (Uint8List, Uint8List) applicationTrafficSecrets(Uint8List handshakeHash) =>
+      (
+        hkdf.deriveSecret(masterSecret, _cApTraffic, handshakeHash),
+        hkdf.deriveSecret(masterSecret, _sApTraffic, handshakeHash),
+      );
+
+  /// Resumption master secret over ClientHello..client Finished.
+  Uint8List resumptionMasterSecret(Uint8List fullHandshakeHash) =>
+      hkdf.deriveSecret(masterSecret, _resMaster, fullHandshakeHash);
+}
@@ -16,6 +16,7 @@ import 'tls_extensions.dart';
 import 'tls_handshake_state.dart';
 import 'recordlayer.dart';
 import 'session.dart';
+import 'tls13_key_schedule.dart';
 import 'sessioncache.dart';
 import 'tls_protocol.dart';
 import 'utils/codec.dart';
@@ -83,7 +84,7 @@ class TlsConnection extends MessageSocket {
   SessionCache? _sessionCache;
   final Queue<(dynamic, Parser)> _pendingMessages = Queue();
   final Queue<TlsHandshakeMessage> _handshakeQueue = Queue();
-  final HandshakeHashes handshakeHashes = HandshakeHashes();
+  final HandshakeHashes handshakeHashes = HandshakeHashes(deferred: true);
   final List<TlsNewSessionTicket> tls13Tickets = <TlsNewSessionTicket>[];
   PureDartTlsHandshakeStateMachine? _handshakeStateMachine;
   HandshakeSettings handshakeSettings = HandshakeSettings();
@@ -658,7 +659,7 @@ class TlsConnection extends MessageSocket {
 
       // Replace the transcript: clear and add message_hash + HelloRetryRequest
       // We need a new HandshakeHashes instance
-      final newHashes = HandshakeHashes();
+      final newHashes = HandshakeHashes(deferred: true);
       newHashes.update(messageHashMsg);
 
       // Copy internal state - we'll serialize the HRR and add it
@@ -710,6 +711,7 @@ class TlsConnection extends MessageSocket {
     }
 
     await _clientHandleServerHello(message);
+    _retainNegotiatedTranscriptHashes(certificateVerify: certParams != null);
 
     if (_isTls13Plus()) {
       await _clientHandshake13(certParams);
@@ -1151,7 +1153,7 @@ class TlsConnection extends MessageSocket {
       Uint8List.fromList(session.masterSecret),
       clientRandom,
       serverRandom,
-      null, // implementations
+      handshakeSettings.cipherImplementations,
     );
 
     // Switch to Application Keys (Write) - MUST be done BEFORE sending Finished
@@ -1255,6 +1257,38 @@ class TlsConnection extends MessageSocket {
     handshakeEstablished = true;
   }
 
+  /// The PSK behind the identity the server selected from our ClientHello,
+  /// or null when it names none we offered.
+  ///
+  /// Ticket identities use the same PSK as their binder:
+  /// HKDF-Expand-Label(resumption_master_secret, "resumption", ticket_nonce)
+  /// (RFC 8446, Section 4.6.1). External identities use the configured
+  /// secret.
+  Uint8List? _selectedClientPsk() {
+    final index = _negotiatedClientHelloPskIndex;
+    final pskExt =
+        _clientHelloMsg?.extensions?.byType(ExtensionType.pre_shared_key);
+    if (index == null ||
+        pskExt is! TlsPreSharedKeyExtension ||
+        index < 0 ||
+        index >= pskExt.identities.length) {
+      return null;
+    }
+    final identity = pskExt.identities[index];
+    final resSecret = session.resumptionMasterSecret;
+    final tickets = session.tls13Tickets;
+    if (resSecret.isNotEmpty &&
+        tickets.any((t) => _bytesEqual(t.ticket, identity.identity))) {
+      return HandshakeHelpers.calcResBinderPsk(identity, resSecret, tickets);
+    }
+    for (final config in handshakeSettings.pskConfigs) {
+      if (_bytesEqual(config.identity, identity.identity)) {
+        return config.secret;
+      }
+    }
+    return null;
+  }
+
   Future<void> _clientHandshake13(Keypair? certParams) async {
     if (_pendingSharedSecret == null) {
       throw TLSHandshakeFailure('Missing shared secret for TLS 1.3');
@@ -1264,40 +1298,26 @@ class TlsConnection extends MessageSocket {
 
     // Determine Hash Algorithm
     final hashName = _prfHashName();
-    final hashLen = hashName == 'sha384' ? 48 : 32;
 
-    // Calculate Early Secret
-    Uint8List psk = Uint8List(hashLen); // 0-filled
+    // Calculate Early Secret (a zero PSK unless the server accepted one)
+    Uint8List? psk;
     if (_negotiatedClientHelloPskIndex != null) {
-      if (session.resumptionMasterSecret.isNotEmpty) {
-        psk = session.resumptionMasterSecret;
+      psk = _selectedClientPsk();
+      if (psk == null) {
+        await _sendAlert(AlertLevel.fatal, AlertDescription.illegal_parameter);
+        throw TLSIllegalParameterException(
+            'Server selected an unknown PSK identity');
       }
     }
-    final earlySecret = secureHMAC(psk, Uint8List(hashLen), hashName);
+    final keySchedule = Tls13KeySchedule(hashName, psk: psk);
 
     // Derive Handshake Secret
-    final derivedSecret = derive_secret(
-        earlySecret, Uint8List.fromList('derived'.codeUnits), null, hashName);
-
-    final handshakeSecret = secureHMAC(derivedSecret, sharedSecret, hashName);
-    late Uint8List masterSecret;
+    keySchedule.deriveHandshakeSecret(sharedSecret);
 
     // Calculate Client/Server Handshake Traffic Secrets
     final helloHash = handshakeHashes.digest(hashName);
-
-    final clientHandshakeTrafficSecret = HKDF_expand_label(
-        handshakeSecret,
-        Uint8List.fromList('c hs traffic'.codeUnits),
-        helloHash,
-        hashLen,
-        hashName);
-
-    final serverHandshakeTrafficSecret = HKDF_expand_label(
-        handshakeSecret,
-        Uint8List.fromList('s hs traffic'.codeUnits),
-        helloHash,
-        hashLen,
-        hashName);
+    final (clientHandshakeTrafficSecret, serverHandshakeTrafficSecret) =
+        keySchedule.handshakeTrafficSecrets(helloHash);
 
     // Store secrets in session
     session.clHandshakeSecret = clientHandshakeTrafficSecret;
@@ -1305,7 +1325,8 @@ class TlsConnection extends MessageSocket {
 
     // Switch to Handshake Keys
     calcTLS1_3PendingState(session.cipherSuite, clientHandshakeTrafficSecret,
-        serverHandshakeTrafficSecret, null);
+        serverHandshakeTrafficSecret,
+        handshakeSettings.cipherImplementations);
     changeReadState();
     changeWriteState();
 
@@ -1497,31 +1518,17 @@ class TlsConnection extends MessageSocket {
     // Prepare application traffic secrets using the transcript up through the
     // server's Finished so we can immediately accept TLS 1.3 application data.
     final trafficHandshakeHash = handshakeHashes.digest(hashName);
-    final derivedSecret2 = derive_secret(handshakeSecret,
-        Uint8List.fromList('derived'.codeUnits), null, hashName);
-
-    masterSecret = secureHMAC(derivedSecret2, Uint8List(hashLen), hashName);
-    session.masterSecret = masterSecret;
-
-    final clientAppTrafficSecret = HKDF_expand_label(
-        masterSecret,
-        Uint8List.fromList('c ap traffic'.codeUnits),
-        trafficHandshakeHash,
-        hashLen,
-        hashName);
-
-    final serverAppTrafficSecret = HKDF_expand_label(
-        masterSecret,
-        Uint8List.fromList('s ap traffic'.codeUnits),
-        trafficHandshakeHash,
-        hashLen,
-        hashName);
+    session.masterSecret = keySchedule.deriveMasterSecret();
+
+    final (clientAppTrafficSecret, serverAppTrafficSecret) =
+        keySchedule.applicationTrafficSecrets(trafficHandshakeHash);
 
     session.clAppSecret = clientAppTrafficSecret;
     session.srAppSecret = serverAppTrafficSecret;
 
     calcTLS1_3PendingState(session.cipherSuite, clientAppTrafficSecret,
-        serverAppTrafficSecret, null);
+        serverAppTrafficSecret,
+        handshakeSettings.cipherImplementations);
     changeReadState();
 
     // Send Certificate and CertificateVerify if requested
@@ -1641,11 +1648,8 @@ class TlsConnection extends MessageSocket {
     // After sending our Finished, derive the resumption master secret using
     // the full transcript (which now includes the client's handshake)
     final fullHandshakeHash = handshakeHashes.digest(hashName);
-    final resumptionMasterSecret = derive_secret(
-        masterSecret,
-        Uint8List.fromList('res master'.codeUnits),
-        fullHandshakeHash,
-        hashName);
+    final resumptionMasterSecret =
+        keySchedule.resumptionMasterSecret(fullHandshakeHash);
     session.resumptionMasterSecret = resumptionMasterSecret;
 
     changeWriteState();
@@ -1751,6 +1755,7 @@ class TlsConnection extends MessageSocket {
       throw TLSHandshakeFailure('No shared cipher suites');
     }
     session.cipherSuite = selectedSuite;
+    _retainNegotiatedTranscriptHashes();
 
     // 2. Process Key Share
     final keyShareExt = clientHello.extensions?.byType(ExtensionType.key_share);
@@ -1841,39 +1846,21 @@ class TlsConnection extends MessageSocket {
 
     // 4. Key Derivation
     final hashName = _prfHashName();
-    final hashLen = hashName == 'sha384' ? 48 : 32;
-
-    final salt = Uint8List(hashLen); // 0-filled
-    final earlySecret = secureHMAC(salt, Uint8List(hashLen), hashName);
 
-    final derivedSecret = derive_secret(
-        earlySecret, Uint8List.fromList('derived'.codeUnits), null, hashName);
-
-    final handshakeSecret = secureHMAC(derivedSecret, sharedSecret!, hashName);
-    late Uint8List masterSecret;
+    final keySchedule = Tls13KeySchedule(hashName);
+    keySchedule.deriveHandshakeSecret(sharedSecret!);
 
     final helloHash = handshakeHashes.digest(hashName);
-
-    final clientHandshakeTrafficSecret = HKDF_expand_label(
-        handshakeSecret,
-        Uint8List.fromList('c hs traffic'.codeUnits),
-        helloHash,
-        hashLen,
-        hashName);
-
-    final serverHandshakeTrafficSecret = HKDF_expand_label(
-        handshakeSecret,
-        Uint8List.fromList('s hs traffic'.codeUnits),
-        helloHash,
-        hashLen,
-        hashName);
+    final (clientHandshakeTrafficSecret, serverHandshakeTrafficSecret) =
+        keySchedule.handshakeTrafficSecrets(helloHash);
 
     session.clHandshakeSecret = clientHandshakeTrafficSecret;
     session.srHandshakeSecret = serverHandshakeTrafficSecret;
 
     // Switch to Handshake Keys
     calcTLS1_3PendingState(session.cipherSuite, clientHandshakeTrafficSecret,
-        serverHandshakeTrafficSecret, null);
+        serverHandshakeTrafficSecret,
+        handshakeSettings.cipherImplementations);
     changeReadState();
     changeWriteState();
 
@@ -2051,31 +2038,17 @@ class TlsConnection extends MessageSocket {
     // After emitting the server's Finished we must be ready to encrypt
     // application data immediately (clients may allow "short packets").
     final trafficHandshakeHash = handshakeHashes.digest(hashName);
-    final derivedSecret2 = derive_secret(handshakeSecret,
-        Uint8List.fromList('derived'.codeUnits), null, hashName);
-
-    masterSecret = secureHMAC(derivedSecret2, Uint8List(hashLen), hashName);
-    session.masterSecret = masterSecret;
-
-    final clientAppTrafficSecret = HKDF_expand_label(
-        masterSecret,
-        Uint8List.fromList('c ap traffic'.codeUnits),
-        trafficHandshakeHash,
-        hashLen,
-        hashName);
-
-    final serverAppTrafficSecret = HKDF_expand_label(
-        masterSecret,
-        Uint8List.fromList('s ap traffic'.codeUnits),
-        trafficHandshakeHash,
-        hashLen,
-        hashName);
+    session.masterSecret = keySchedule.deriveMasterSecret();
+
+    final (clientAppTrafficSecret, serverAppTrafficSecret) =
+        keySchedule.applicationTrafficSecrets(trafficHandshakeHash);
 
     session.clAppSecret = clientAppTrafficSecret;
     session.srAppSecret = serverAppTrafficSecret;
 
     calcTLS1_3PendingState(session.cipherSuite, clientAppTrafficSecret,
-        serverAppTrafficSecret, null);
+        serverAppTrafficSecret,
+        handshakeSettings.cipherImplementations);
     changeWriteState();
 
     // 9. Receive Client Messages (Certificate, CertificateVerify, Finished)
@@ -2190,11 +2163,8 @@ class TlsConnection extends MessageSocket {
     // Calculate Resumption Master Secret using the complete transcript
     // (which now also includes the client's Finished).
     final fullHandshakeHash = handshakeHashes.digest(hashName);
-    final resumptionMasterSecret = derive_secret(
-        masterSecret,
-        Uint8List.fromList('res master'.codeUnits),
-        fullHandshakeHash,
-        hashName);
+    final resumptionMasterSecret =
+        keySchedule.resumptionMasterSecret(fullHandshakeHash);
     session.resumptionMasterSecret = resumptionMasterSecret;
 
     changeReadState();
@@ -2244,6 +2214,7 @@ class TlsConnection extends MessageSocket {
     }
 
     session.cipherSuite = selectedSuite;
+    _retainNegotiatedTranscriptHashes(certificateVerify: reqCert);
 
     // 2. Send ServerHello
     serverRandom = getRandomBytes(32);
@@ -2572,7 +2543,7 @@ class TlsConnection extends MessageSocket {
       Uint8List.fromList(session.masterSecret),
       clientHello.random,
       serverHello.random,
-      null,
+      handshakeSettings.cipherImplementations,
     );
 
     // 10. Receive ChangeCipherSpec
@@ -3111,16 +3082,8 @@ class TlsConnection extends MessageSocket {
       throw TLSInternalError('Handshake traffic secret missing for TLS 1.3');
     }
     final hashName = _prfHashName();
-    final digestLength = hashName == 'sha384' ? 48 : 32;
-    final finishedKey = HKDF_expand_label(
-      secret,
-      Uint8List.fromList('finished'.codeUnits),
-      Uint8List(0),
-      digestLength,
-      hashName,
-    );
     final transcript = (handshakeSnapshot ?? handshakeHashes).digest(hashName);
-    return secureHMAC(finishedKey, transcript, hashName);
+    return Tls13Hkdf.of(hashName).finishedVerifyData(secret, transcript);
   }
 
   String _prfHashName() {
@@ -3129,6 +3092,28 @@ class TlsConnection extends MessageSocket {
         : 'sha256';
   }
 
+  /// Stop hashing the transcript with digests the negotiated version and
+  /// cipher suite can never ask for. Call once ServerHello is settled.
+  ///
+  /// [certificateVerify] - whether a TLS 1.2 CertificateVerify may still be
+  /// signed or verified over this transcript.
+  void _retainNegotiatedTranscriptHashes({bool certificateVerify = false}) {
+    if (version >= const TlsProtocolVersion(3, 4)) {
+      // Finished, key schedule and CertificateVerify (including EdDSA) all
+      // use Transcript-Hash with the PRF hash.
+      handshakeHashes.retainOnly([_prfHashName()]);
+    } else if (version < const TlsProtocolVersion(3, 3)) {
+      handshakeHashes.retainOnly(const ['md5', 'sha1']);
+    } else if (!certificateVerify) {
+      handshakeHashes.retainOnly([_prfHashName()]);
+    } else {
+      // TLS 1.2 CertificateVerify may use any hash from signature_algorithms
+      // or, for Ed25519/Ed448, sign the raw messages.
+      handshakeHashes.retainOnly(HandshakeHashes.allDigests,
+          keepIntrinsic: true);
+    }
+  }
+
   /// Build the byte sequence that must be signed inside CertificateVerify.
   Uint8List buildCertificateVerifyBytes({
     required int signatureScheme,
@@ -8,6 +8,8 @@ import 'defragmenter.dart';
 import 'errors.dart';
 import 'handshake_hashes.dart';
 import 'messages.dart' as tlsmsg;
+import 'parallel_record_sealer.dart';
+import 'plaintext_queue.dart';
 import 'recordlayer.dart';
 import 'session.dart';
 import 'tls_protocol.dart';
@@ -68,11 +70,36 @@ class TLSRecordLayer {
   /// Upper bound for plaintext bytes placed inside a single TLS record.
   int _userRecordLimit = 1 << 14;
 
-  /// Buffered application data awaiting consumption by callers.
-  Uint8List _readBuffer = Uint8List(0);
+  /// Encrypted bytes collected before the output is flushed mid-write.
+  ///
+  /// A write is cut into records which are encrypted back to back into one
+  /// output buffer and sent with a single socket write; larger writes are
+  /// flushed every [writeBatchSize] bytes so the buffer stays bounded.
+  int writeBatchSize = 1 << 18;
 
-  /// Peek at the currently queued plaintext (primarily for debugging/tests).
-  Uint8List get bufferedPlaintext => _readBuffer;
+  /// Whether writes are being held back, see [cork].
+  bool _corked = false;
+
+  /// Bulk mode, see [enableParallelSealing].
+  bool _parallelSealing = false;
+  int? _parallelWorkers;
+  ParallelRecordSealer? _parallelSealer;
+  int _parallelSealerEpoch = -1;
+
+  /// Serialises writes while bulk mode is on, so records sealed on the
+  /// workers reach the socket in sequence number order.
+  Future<void> _writeTail = Future<void>.value();
+
+  /// Smallest write, in records, that is sealed on the worker isolates in
+  /// bulk mode; smaller writes are not worth the round trip.
+  int parallelSealingMinRecords = 8;
+
+  /// Buffered application data awaiting consumption by callers, kept as
+  /// the decrypted record payloads.
+  final PlaintextQueue _readQueue = PlaintextQueue();
+
+  /// Copy of the currently queued plaintext (primarily for debugging/tests).
+  Uint8List get bufferedPlaintext => _readQueue.toBytes();
 
   /// Session tickets received from the peer.
   final List<tlsmsg.TlsNewSessionTicket> tickets =
@@ -108,12 +135,63 @@ class TLSRecordLayer {
 
   /// Reset buffered plaintext waiting for consumers.
   void clearReadBuffer() {
-    _readBuffer = Uint8List(0);
+    _readQueue.clear();
   }
 
-  /// Reset any queued plaintext waiting to be encrypted.
-  void clearWriteBuffer() {
-    // Record coalescing is not implemented yet.
+  /// Kept for API parity; there is never unsealed plaintext to reset.
+  ///
+  /// [write] seals records as it goes, and anything held back by [cork] or
+  /// coalescing is already encrypted and has consumed write sequence
+  /// numbers. Dropping it would leave a gap the peer detects as a bad
+  /// record MAC, so pending records are only ever sent, by [uncork] or the
+  /// next flushing write.
+  void clearWriteBuffer() {}
+
+  /// Whether writes are currently held back by [cork].
+  bool get corked => _corked;
+
+  /// Holds back the socket writes of subsequent [write] calls so that, for
+  /// example, headers and body leave in one flight on [uncork].
+  ///
+  /// Alerts are still sent immediately, and reading flushes anything held
+  /// back first, since the peer may be waiting for it.
+  void cork() {
+    _corked = true;
+  }
+
+  /// Sends everything held back since [cork] and resumes flushing on every
+  /// write.
+  Future<void> uncork() async {
+    _corked = false;
+    await _flushRecords();
+  }
+
+  /// Opt-in bulk mode: application data writes of at least
+  /// [parallelSealingMinRecords] records are sealed on a pool of [workers]
+  /// isolates (one per spare processor by default) instead of on this one.
+  ///
+  /// Only AEAD suites can be sealed out of line; other suites, and every
+  /// other record type, keep using the sequential path. The workers are
+  /// started on first use and restarted after each key change.
+  void enableParallelSealing({int? workers}) {
+    if (workers != null && workers < 1) {
+      throw ArgumentError.value(workers, 'workers', 'must be positive');
+    }
+    _parallelSealing = true;
+    _parallelWorkers = workers;
+  }
+
+  /// Leaves bulk mode and stops the worker isolates.
+  Future<void> disableParallelSealing() async {
+    _parallelSealing = false;
+    await _writeTail;
+    await _closeParallelSealer();
+  }
+
+  Future<void> _closeParallelSealer() async {
+    final sealer = _parallelSealer;
+    _parallelSealer = null;
+    await sealer?.close();
   }
 
   /// Maximum plaintext payload per record.
@@ -183,14 +261,15 @@ class TLSRecordLayer {
   /// ``recv`` compatibility wrapper.
   Future<Uint8List> recv(int bufsize) => read(max: bufsize);
 
-  /// Equivalent of ``recv_into`` helper.
+  /// Equivalent of ``recv_into`` helper: copies the queued plaintext
+  /// straight into [buffer], once.
   Future<int?> recvInto(Uint8List buffer) async {
-    final chunk = await read(max: buffer.length, min: 0);
-    if (chunk.isEmpty) {
+    await _fillReadQueue(0);
+    final copied = _readQueue.copyInto(buffer);
+    if (copied == 0) {
       return null;
     }
-    buffer.setRange(0, chunk.length, chunk);
-    return chunk.length;
+    return copied;
   }
 
   /// Gracefully shut down the TLS connection.
@@ -242,6 +321,7 @@ class TLSRecordLayer {
   /// Core shutdown logic shared by ``close`` and alert-induced teardown.
   Future<void> _shutdown({required bool resumable}) async {
     _recordLayer.shutdown();
+    await _closeParallelSealer();
     closed = true;
     if (closeSocket) {
       await sock.close();
@@ -254,6 +334,10 @@ class TLSRecordLayer {
   /// -----------------------------------------------------------------------
   /// Placeholders for the remaining porting work
 
+  /// Returns up to [max] bytes of plaintext, waiting for at least [min].
+  ///
+  /// When the bytes come from a single record the result is a view of it
+  /// rather than a copy; it must not be modified.
   Future<Uint8List> read({int? max, int min = 1}) async {
     if (min < 0) {
       throw ArgumentError.value(min, 'min', 'must be >= 0');
@@ -267,6 +351,28 @@ class TLSRecordLayer {
       );
     }
 
+    await _fillReadQueue(min);
+    return _readQueue.take(max ?? _readQueue.length);
+  }
+
+  /// Yields the plaintext as it arrives, one unmodifiable view per record,
+  /// until the connection is closed.
+  Stream<Uint8List> readChunks() async* {
+    while (true) {
+      await _fillReadQueue(1);
+      if (_readQueue.isEmpty) {
+        return;
+      }
+      while (_readQueue.isNotEmpty) {
+        yield _readQueue.takeChunk().asUnmodifiableView();
+      }
+    }
+  }
+
+  /// Processes incoming records until at least [min] bytes of plaintext are
+  /// queued (at least one attempt when the queue is empty) or the
+  /// connection closes.
+  Future<void> _fillReadQueue(int min) async {
     final allowedTypes = <int>{
       ContentType.application_data,
       ContentType.heartbeat,
@@ -282,7 +388,7 @@ class TLSRecordLayer {
 
     var tryOnce = true;
     try {
-      while ((_readBuffer.length < min || (_readBuffer.isEmpty && tryOnce)) &&
+      while ((_readQueue.length < min || (_readQueue.isEmpty && tryOnce)) &&
           !closed) {
         tryOnce = false;
         final shouldRetry = await _pumpApplicationData(
@@ -303,12 +409,6 @@ class TLSRecordLayer {
       }
       await _shutdown(resumable: true);
     }
-
-    final effectiveMax = max ?? _readBuffer.length;
-    final takeLength = math.min(effectiveMax, _readBuffer.length);
-    final result = Uint8List.fromList(_readBuffer.sublist(0, takeLength));
-    _readBuffer = Uint8List.fromList(_readBuffer.sublist(takeLength));
-    return result;
   }
 
   Stream<Uint8List> readAsync({int? max, int min = 1}) async* {
@@ -446,7 +546,17 @@ class TLSRecordLayer {
     );
 
     if (message is tlsmsg.TlsApplicationData) {
-      _appendPlaintext(Uint8List.fromList(message.data));
+      final data = message.data;
+      // Decrypted records are views into the receive chunk they arrived in
+      // (RecordSocket.recv), and a queued view keeps that whole chunk
+      // alive. Records much smaller than their chunk are copied, so the
+      // memory pinned by the queue stays within 4x of what it holds.
+      if (data is Uint8List &&
+          data.lengthInBytes * 4 >= data.buffer.lengthInBytes) {
+        _readQueue.add(data);
+      } else {
+        _readQueue.add(Uint8List.fromList(data));
+      }
       return false;
     }
 
@@ -476,22 +586,6 @@ class TLSRecordLayer {
     );
   }
 
-  void _appendPlaintext(Uint8List chunk) {
-    if (chunk.isEmpty) {
-      return;
-    }
-
-    if (_readBuffer.isEmpty) {
-      _readBuffer = Uint8List.fromList(chunk);
-      return;
-    }
-
-    final combined = Uint8List(_readBuffer.length + chunk.length);
-    combined.setRange(0, _readBuffer.length, _readBuffer);
-    combined.setRange(_readBuffer.length, combined.length, chunk);
-    _readBuffer = combined;
-  }
-
   Future<void> _handleHeartbeatMessage(tlsmsg.TlsHeartbeat heartbeat) async {
     if (!heartbeatSupported) {
       await _sendError(
@@ -553,11 +647,36 @@ class TLSRecordLayer {
     );
   }
 
+  /// Fragments [payload] into records, encrypts them into the output
+  /// buffer and flushes once at the end (or every [writeBatchSize] bytes),
+  /// unless the connection is [corked] and [flush] is false.
   Future<void> _sendRawMessage(
     int contentType,
     Uint8List payload, {
     bool randomizeFirstBlock = true,
     bool updateHandshakeHash = false,
+    bool flush = false,
+  }) {
+    if (!_parallelSealing) {
+      return _sendRecords(contentType, payload,
+          randomizeFirstBlock: randomizeFirstBlock,
+          updateHandshakeHash: updateHandshakeHash,
+          flush: flush);
+    }
+    final done = _writeTail.then((_) => _sendRecords(contentType, payload,
+        randomizeFirstBlock: randomizeFirstBlock,
+        updateHandshakeHash: updateHandshakeHash,
+        flush: flush));
+    _writeTail = done.then((_) {}, onError: (Object _) {});
+    return done;
+  }
+
+  Future<void> _sendRecords(
+    int contentType,
+    Uint8List payload, {
+    required bool randomizeFirstBlock,
+    required bool updateHandshakeHash,
+    required bool flush,
   }) async {
     if (payload.isEmpty) {
       return;
@@ -571,30 +690,112 @@ class TLSRecordLayer {
 
     if (needsFirstByteMasking) {
       final firstByte = Uint8List.fromList(<int>[remaining.first]);
-      await _sendMsgThroughSocket(Message(contentType, firstByte));
-      if (remaining.length == 1) {
-        return;
-      }
-      remaining = Uint8List.fromList(remaining.sublist(1));
+      _recordLayer.bufferRecord(Message(contentType, firstByte));
+      remaining = Uint8List.sublistView(remaining, 1);
     }
 
     if (updateHandshakeHash) {
       _handshakeHash.update(remaining);
     }
 
+    final minParallel = parallelSealingMinRecords * recordSize;
+    if (_parallelSealing &&
+        contentType == ContentType.application_data &&
+        remaining.length >= minParallel) {
+      final sealer = await _currentParallelSealer();
+      if (sealer != null) {
+        await _sendSealedInParallel(sealer, remaining);
+        if (flush || !_corked) {
+          await _flushRecords();
+        }
+        return;
+      }
+    }
+
     var offset = 0;
     while (offset < remaining.length) {
       final chunkLength = math.min(recordSize, remaining.length - offset);
-      final chunk = Uint8List.fromList(
-        remaining.sublist(offset, offset + chunkLength),
-      );
-      await _sendMsgThroughSocket(Message(contentType, chunk));
+      // Records are encrypted into the output buffer right away, so a view
+      // of the caller's data is enough.
+      _recordLayer.bufferRecord(Message(
+        contentType,
+        Uint8List.sublistView(remaining, offset, offset + chunkLength),
+      ));
       offset += chunkLength;
+      if (_recordLayer.pendingRecordBytes >= writeBatchSize) {
+        await _flushRecords();
+      }
+    }
+
+    if (flush || !_corked) {
+      await _flushRecords();
     }
   }
 
-  Future<void> _sendMsgThroughSocket(Message message) =>
-      _recordLayer.sendRecord(message);
+  /// The sealer for the current write state, (re)started when the keys
+  /// changed; null when the write state cannot be sealed out of line.
+  Future<ParallelRecordSealer?> _currentParallelSealer() async {
+    final epoch = _recordLayer.writeEpoch;
+    if (_parallelSealer != null && _parallelSealerEpoch == epoch) {
+      return _parallelSealer;
+    }
+    await _closeParallelSealer();
+    final params = _recordLayer.exportWriteState();
+    if (params == null) {
+      return null;
+    }
+    final sealer =
+        await ParallelRecordSealer.start(params, workers: _parallelWorkers);
+    if (epoch != _recordLayer.writeEpoch) {
+      // Keys changed while the workers were starting.
+      await sealer.close();
+      return null;
+    }
+    _parallelSealer = sealer;
+    _parallelSealerEpoch = epoch;
+    return sealer;
+  }
+
+  /// Fragments [data] into application data records and seals them on
+  /// [sealer], a window of records per worker round trip, queueing each
+  /// window in order and flushing every [writeBatchSize] bytes.
+  Future<void> _sendSealedInParallel(
+      ParallelRecordSealer sealer, Uint8List data) async {
+    final window = sealer.workers * parallelSealingMinRecords;
+    var offset = 0;
+    while (offset < data.length) {
+      final records = <Uint8List>[];
+      var wireType = ContentType.application_data;
+      while (records.length < window && offset < data.length) {
+        final chunkLength = math.min(recordSize, data.length - offset);
+        final (plaintext, type) = _recordLayer.recordPlaintext(Message(
+          ContentType.application_data,
+          Uint8List.sublistView(data, offset, offset + chunkLength),
+        ));
+        records.add(plaintext);
+        wireType = type;
+        offset += chunkLength;
+      }
+      final epoch = _recordLayer.writeEpoch;
+      final firstSeq = _recordLayer.reserveWriteSequence(records.length);
+      final sealed = await sealer.seal(firstSeq, wireType, records);
+      if (epoch != _recordLayer.writeEpoch) {
+        throw TLSInternalError('Write keys changed while sealing records');
+      }
+      for (final chunk in sealed) {
+        _recordLayer.bufferSealedRecords(chunk);
+      }
+      if (_recordLayer.pendingRecordBytes >= writeBatchSize) {
+        await _flushRecords();
+      }
+    }
+  }
+
+  Future<void> _flushRecords() async {
+    if (_recordLayer.pendingRecordBytes > 0) {
+      await _recordLayer.flushRecords();
+    }
+  }
 
   Future<void> _sendAlert({
     required int level,
@@ -606,6 +807,7 @@ class TLSRecordLayer {
       payload,
       randomizeFirstBlock: false,
       updateHandshakeHash: false,
+      flush: true,
     );
   }
 
@@ -623,6 +825,8 @@ class TLSRecordLayer {
     Set<int> expectedTypes, {
     Set<int>? allowedHandshakeTypes,
   }) async {
+    // The peer may be waiting for whatever a corked writer queued.
+    await _flushRecords();
     try {
       while (true) {
         final (header, parser) = await _getNextRecord();
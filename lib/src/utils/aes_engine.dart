@@ -0,0 +1,416 @@
+import 'dart:typed_data';
+
+/// Portable AES block engine (FIPS-197) on 32-bit T-tables.
+///
+/// Round keys live in fixed [Uint32List]s and the state in four local ints,
+/// so a block costs table lookups, shifts and XORs with no allocation and
+/// no native memory. The multi-block entry points ([encryptBlocks],
+/// [decryptBlocks], [ctrXor]) keep the whole loop inside one call, which is
+/// what the Dart CBC, CTR, GCM and CCM modes build on.
+///
+/// This is the fallback for hosts where the AES-NI kernels in
+/// `lib/src/experimental` are unavailable, including those that refuse to
+/// map executable memory. Like every table-based AES, lookups are indexed
+/// by secret data and are not constant time with respect to cache timing.
+class AesEngine {
+  /// Expands [key] (16, 24 or 32 bytes). Decryption round keys are derived
+  /// on first use, so counter-mode users never pay for them.
+  AesEngine(Uint8List key)
+      : rounds = _roundsFor(key.length),
+        _encKey = Uint32List(4 * (_roundsFor(key.length) + 1)) {
+    if (!_tablesReady) {
+      _buildTables();
+      _tablesReady = true;
+    }
+    _expandKey(key);
+  }
+
+  static int _roundsFor(int keyLength) {
+    switch (keyLength) {
+      case 16:
+        return 10;
+      case 24:
+        return 12;
+      case 32:
+        return 14;
+    }
+    throw ArgumentError('AES key must be 16, 24 or 32 bytes long');
+  }
+
+  /// Block size in bytes.
+  static const int blockSize = 16;
+
+  /// Number of rounds: 10, 12 or 14.
+  final int rounds;
+
+  final Uint32List _encKey;
+  late final Uint32List _decKey = _invertKeySchedule();
+
+  static final Uint8List _sbox = Uint8List(256);
+  static final Uint8List _invSbox = Uint8List(256);
+  static final Uint32List _te0 = Uint32List(256);
+  static final Uint32List _te1 = Uint32List(256);
+  static final Uint32List _te2 = Uint32List(256);
+  static final Uint32List _te3 = Uint32List(256);
+  static final Uint32List _td0 = Uint32List(256);
+  static final Uint32List _td1 = Uint32List(256);
+  static final Uint32List _td2 = Uint32List(256);
+  static final Uint32List _td3 = Uint32List(256);
+  static bool _tablesReady = false;
+
+  static int _xtime(int b) => ((b << 1) ^ ((b & 0x80) != 0 ? 0x1b : 0)) & 0xff;
+
+  static int _gmul(int a, int b) {
+    var result = 0;
+    while (b != 0) {
+      if ((b & 1) != 0) {
+        result ^= a;
+      }
+      a = _xtime(a);
+      b >>= 1;
+    }
+    return result;
+  }
+
+  static int _ror8(int w) => ((w >>> 8) | (w << 24)) & 0xffffffff;
+
+  /// Generates the S-boxes and the four encryption and decryption tables.
+  static void _buildTables() {
+    // p walks the multiplicative group by powers of 3 and q by powers of
+    // 3^-1, so q is always the inverse of p.
+    var p = 1;
+    var q = 1;
+    do {
+      p = p ^ _xtime(p);
+      q ^= q << 1;
+      q ^= q << 2;
+      q ^= q << 4;
+      q &= 0xff;
+      if ((q & 0x80) != 0) {
+        q ^= 0x09;
+      }
+      final x = q ^
+          ((q << 1) | (q >> 7)) ^
+          ((q << 2) | (q >> 6)) ^
+          ((q << 3) | (q >> 5)) ^
+          ((q << 4) | (q >> 4));
+      _sbox[p] = (x ^ 0x63) & 0xff;
+    } while (p != 1);
+    _sbox[0] = 0x63;
+    for (var i = 0; i < 256; i++) {
+      _invSbox[_sbox[i]] = i;
+    }
+    for (var i = 0; i < 256; i++) {
+      final s = _sbox[i];
+      final te = (_gmul(s, 2) << 24) | (s << 16) | (s << 8) | _gmul(s, 3);
+      _te0[i] = te;
+      _te1[i] = _ror8(te);
+      _te2[i] = _ror8(_te1[i]);
+      _te3[i] = _ror8(_te2[i]);
+      final t = _invSbox[i];
+      final td = (_gmul(t, 14) << 24) |
+          (_gmul(t, 9) << 16) |
+          (_gmul(t, 13) << 8) |
+          _gmul(t, 11);
+      _td0[i] = td;
+      _td1[i] = _ror8(td);
+      _td2[i] = _ror8(_td1[i]);
+      _td3[i] = _ror8(_td2[i]);
+    }
+  }
+
+  void _expandKey(Uint8List key) {
+    final sbox = _sbox;
+    final w = _encKey;
+    final nk = key.length ~/ 4;
+    for (var i = 0; i < nk; i++) {
+      w[i] = _load(key, 4 * i);
+    }
+    var rcon = 1;
+    for (var i = nk; i < w.length; i++) {
+      var t = w[i - 1];
+      if (i % nk == 0) {
+        t = ((sbox[(t >> 16) & 0xff] << 24) |
+                (sbox[(t >> 8) & 0xff] << 16) |
+                (sbox[t & 0xff] << 8) |
+                sbox[t >>> 24]) ^
+            (rcon << 24);
+        rcon = _xtime(rcon);
+      } else if (nk > 6 && i % nk == 4) {
+        t = (sbox[t >>> 24] << 24) |
+            (sbox[(t >> 16) & 0xff] << 16) |
+            (sbox[(t >> 8) & 0xff] << 8) |
+            sbox[t & 0xff];
+      }
+      w[i] = w[i - nk] ^ t;
+    }
+  }
+
+  /// Round keys for the equivalent inverse cipher: reversed order, with
+  /// InvMixColumns applied to every round but the first and last.
+  Uint32List _invertKeySchedule() {
+    final enc = _encKey;
+    final dec = Uint32List(enc.length);
+    final sbox = _sbox;
+    for (var r = 0; r <= rounds; r++) {
+      for (var j = 0; j < 4; j++) {
+        var x = enc[4 * (rounds - r) + j];
+        if (r != 0 && r != rounds) {
+          x = _td0[sbox[x >>> 24]] ^
+              _td1[sbox[(x >> 16) & 0xff]] ^
+              _td2[sbox[(x >> 8) & 0xff]] ^
+              _td3[sbox[x & 0xff]];
+        }
+        dec[4 * r + j] = x;
+      }
+    }
+    return dec;
+  }
+
+  static int _load(Uint8List b, int offset) =>
+      (b[offset] << 24) |
+      (b[offset + 1] << 16) |
+      (b[offset + 2] << 8) |
+      b[offset + 3];
+
+  static void _store(Uint8List b, int offset, int w) {
+    b[offset] = w >>> 24;
+    b[offset + 1] = (w >> 16) & 0xff;
+    b[offset + 2] = (w >> 8) & 0xff;
+    b[offset + 3] = w & 0xff;
+  }
+
+  /// Encrypts one 16-byte [block] into a new list; usable as a
+  /// `RawAesEncrypt`.
+  Uint8List encrypt(Uint8List block) {
+    final out = Uint8List(blockSize);
+    encryptBlocks(block, 0, out, 0, 1);
+    return out;
+  }
+
+  /// Decrypts one 16-byte [block] into a new list.
+  Uint8List decrypt(Uint8List block) {
+    final out = Uint8List(blockSize);
+    decryptBlocks(block, 0, out, 0, 1);
+    return out;
+  }
+
+  /// Encrypts [blocks] consecutive blocks of [input] starting at [inOffset]
+  /// into [out] at [outOffset]. The ranges may overlap exactly (in place).
+  void encryptBlocks(Uint8List input, int inOffset, Uint8List out,
+      int outOffset, int blocks) {
+    for (var b = 0; b < blocks; b++) {
+      final i = inOffset + 16 * b;
+      final o = outOffset + 16 * b;
+      _encryptWords(_load(input, i), _load(input, i + 4), _load(input, i + 8),
+          _load(input, i + 12), out, o);
+    }
+  }
+
+  /// Decrypts [blocks] consecutive blocks of [input] starting at [inOffset]
+  /// into [out] at [outOffset]. The ranges may overlap exactly (in place).
+  void decryptBlocks(Uint8List input, int inOffset, Uint8List out,
+      int outOffset, int blocks) {
+    final rk = _decKey;
+    final inv = _invSbox;
+    final t0 = _td0, t1 = _td1, t2 = _td2, t3 = _td3;
+    for (var b = 0; b < blocks; b++) {
+      final i = inOffset + 16 * b;
+      var s0 = _load(input, i) ^ rk[0];
+      var s1 = _load(input, i + 4) ^ rk[1];
+      var s2 = _load(input, i + 8) ^ rk[2];
+      var s3 = _load(input, i + 12) ^ rk[3];
+      var k = 4;
+      for (var r = 1; r < rounds; r++) {
+        final n0 = t0[s0 >>> 24] ^
+            t1[(s3 >> 16) & 0xff] ^
+            t2[(s2 >> 8) & 0xff] ^
+            t3[s1 & 0xff] ^
+            rk[k];
+        final n1 = t0[s1 >>> 24] ^
+            t1[(s0 >> 16) & 0xff] ^
+            t2[(s3 >> 8) & 0xff] ^
+            t3[s2 & 0xff] ^
+            rk[k + 1];
+        final n2 = t0[s2 >>> 24] ^
+            t1[(s1 >> 16) & 0xff] ^
+            t2[(s0 >> 8) & 0xff] ^
+            t3[s3 & 0xff] ^
+            rk[k + 2];
+        final n3 = t0[s3 >>> 24] ^
+            t1[(s2 >> 16) & 0xff] ^
+            t2[(s1 >> 8) & 0xff] ^
+            t3[s0 & 0xff] ^
+            rk[k + 3];
+        s0 = n0;
+        s1 = n1;
+        s2 = n2;
+        s3 = n3;
+        k += 4;
+      }
+      final o = outOffset + 16 * b;
+      _store(
+          out,
+          o,
+          ((inv[s0 >>> 24] << 24) |
+                  (inv[(s3 >> 16) & 0xff] << 16) |
+                  (inv[(s2 >> 8) & 0xff] << 8) |
+                  inv[s1 & 0xff]) ^
+              rk[k]);
+      _store(
+          out,
+          o + 4,
+          ((inv[s1 >>> 24] << 24) |
+                  (inv[(s0 >> 16) & 0xff] << 16) |
+                  (inv[(s3 >> 8) & 0xff] << 8) |
+                  inv[s2 & 0xff]) ^
+              rk[k + 1]);
+      _store(
+          out,
+          o + 8,
+          ((inv[s2 >>> 24] << 24) |
+                  (inv[(s1 >> 16) & 0xff] << 16) |
+                  (inv[(s0 >> 8) & 0xff] << 8) |
+                  inv[s3 & 0xff]) ^
+              rk[k + 2]);
+      _store(
+          out,
+          o + 12,
+          ((inv[s3 >>> 24] << 24) |
+                  (inv[(s2 >> 16) & 0xff] << 16) |
+                  (inv[(s1 >> 8) & 0xff] << 8) |
+                  inv[s0 & 0xff]) ^
+              rk[k + 3]);
+    }
+  }
+
+  /// Counter mode: XORs the keystream for [counterBlock] over [input] and
+  /// writes the result to [out] at [outOffset]. [input] may be a view of
+  /// [out] at the same offset.
+  ///
+  /// Only the last [counterLength] bytes of [counterBlock] are incremented,
+  /// big-endian and wrapping, as GCM's inc32 (4) and CCM's q-byte counter
+  /// do. On return [counterBlock] holds the first unused counter, so a
+  /// stream can be continued with another call; a trailing partial block
+  /// still consumes a whole counter.
+  void ctrXor(Uint8List counterBlock, int counterLength, Uint8List input,
+      Uint8List out, int outOffset) {
+    if (counterBlock.length != 16) {
+      throw ArgumentError('Counter block must be 16 bytes long');
+    }
+    if (counterLength < 0 || counterLength > 16) {
+      throw ArgumentError('Counter length must be between 0 and 16 bytes');
+    }
+    final length = input.length;
+    if (outOffset < 0 || out.length - outOffset < length) {
+      throw ArgumentError('Output buffer too small');
+    }
+    final c = Uint32List(4);
+    for (var j = 0; j < 4; j++) {
+      c[j] = _load(counterBlock, 4 * j);
+    }
+    final keystream = Uint8List(16);
+    for (var offset = 0; offset < length; offset += 16) {
+      _encryptWords(c[0], c[1], c[2], c[3], keystream, 0);
+      _increment(c, counterLength);
+      final n = length - offset < 16 ? length - offset : 16;
+      for (var j = 0; j < n; j++) {
+        out[outOffset + offset + j] = input[offset + j] ^ keystream[j];
+      }
+    }
+    for (var j = 0; j < 4; j++) {
+      _store(counterBlock, 4 * j, c[j]);
+    }
+  }
+
+  /// Adds one to the low [counterLength] bytes of the counter words [c].
+  static void _increment(Uint32List c, int counterLength) {
+    var word = 3;
+    var bytes = counterLength;
+    while (bytes >= 4) {
+      final v = (c[word] + 1) & 0xffffffff;
+      c[word] = v;
+      if (v != 0) {
+        return;
+      }
+      bytes -= 4;
+      word--;
+    }
+    if (bytes > 0) {
+      final mask = (1 << (8 * bytes)) - 1;
+      final v = c[word];
+      c[word] = (v & ~mask & 0xffffffff) | ((v + 1) & mask);
+    }
+  }
+
+  void _encryptWords(
+      int s0, int s1, int s2, int s3, Uint8List out, int outOffset) {
+    final rk = _encKey;
+    final sbox = _sbox;
+    final t0 = _te0, t1 = _te1, t2 = _te2, t3 = _te3;
+    s0 ^= rk[0];
+    s1 ^= rk[1];
+    s2 ^= rk[2];
+    s3 ^= rk[3];
+    var k = 4;
+    for (var r = 1; r < rounds; r++) {
+      final n0 = t0[s0 >>> 24] ^
+          t1[(s1 >> 16) & 0xff] ^
+          t2[(s2 >> 8) & 0xff] ^
+          t3[s3 & 0xff] ^
+          rk[k];
+      final n1 = t0[s1 >>> 24] ^
+          t1[(s2 >> 16) & 0xff] ^
+          t2[(s3 >> 8) & 0xff] ^
+          t3[s0 & 0xff] ^
+          rk[k + 1];
+      final n2 = t0[s2 >>> 24] ^
+          t1[(s3 >> 16) & 0xff] ^
+          t2[(s0 >> 8) & 0xff] ^
+          t3[s1 & 0xff] ^
+          rk[k + 2];
+      final n3 = t0[s3 >>> 24] ^
+          t1[(s0 >> 16) & 0xff] ^
+          t2[(s1 >> 8) & 0xff] ^
+          t3[s2 & 0xff] ^
+          rk[k + 3];
+      s0 = n0;
+      s1 = n1;
+      s2 = n2;
+      s3 = n3;
+      k += 4;
+    }
+    _store(
+        out,
+        outOffset,
+        ((sbox[s0 >>> 24] << 24) |
+                (sbox[(s1 >> 16) & 0xff] << 16) |
+                (sbox[(s2 >> 8) & 0xff] << 8) |
+                sbox[s3 & 0xff]) ^
+            rk[k]);
+    _store(
+        out,
+        outOffset + 4,
+        ((sbox[s1 >>> 24] << 24) |
+                (sbox[(s2 >> 16) & 0xff] << 16) |
+                (sbox[(s3 >> 8) & 0xff] << 8) |
+                sbox[s0 & 0xff]) ^
+            rk[k + 1]);
+    _store(
+        out,
+        outOffset + 8,
+        ((sbox[s2 >>> 24] << 24) |
+                (sbox[(s3 >> 16) & 0xff] << 16) |
+                (sbox[(s0 >> 8) & 0xff] << 8) |
+                sbox[s1 & 0xff]) ^
+            rk[k + 2]);
+    _store(
+        out,
+        outOffset + 12,
+        ((sbox[s3 >>> 24] << 24) |
+                (sbox[(s0 >> 16) & 0xff] << 16) |
+                (sbox[(s1 >> 8) & 0xff] << 8) |
+                sbox[s2 & 0xff]) ^
+            rk[k + 3]);
+  }
+}
@@ -1,8 +1,8 @@
 import 'dart:typed_data';
 
 import 'aes.dart';
+import 'aes_engine.dart';
 import 'cryptomath.dart';
-import 'dart_aes.dart' as dart_aes;
 
 class AESCCM {
   AESCCM(
@@ -29,16 +29,7 @@ class AESCCM {
       name = 'aes256ccm';
     }
 
-    _ctr = dart_aes.Dart_AES_CTR.Dart_AES_CTR(
-      Uint8List.fromList(this.key),
-      aesModeCTR_OR_GCM,
-      Uint8List(16),
-    );
-    _cbc = dart_aes.Dart_AES(
-      Uint8List.fromList(this.key),
-      aesModeCBC,
-      Uint8List(16),
-    );
+    _engine = AesEngine(this.key);
   }
 
   final bool isBlockCipher = false;
@@ -51,54 +42,74 @@ class AESCCM {
   // ignore: unused_field
   final RawAesEncrypt _rawAesEncrypt;
 
-  late final dart_aes.Dart_AES_CTR _ctr;
-  late final dart_aes.Dart_AES _cbc;
+  /// Runs both the CBC-MAC and the counter mode.
+  late final AesEngine _engine;
 
   Uint8List seal(Uint8List nonce, Uint8List msg, Uint8List aad) {
+    final out = Uint8List(msg.length + tagLength);
+    sealInto(nonce, msg, aad, out, 0);
+    return out;
+  }
+
+  /// Encrypts [msg] and writes `ciphertext || tag` into [out] starting at
+  /// [outOffset], returning the number of bytes written.
+  ///
+  /// [msg] may be a view of [out] at the same offset; the CBC-MAC is taken
+  /// before anything is written.
+  int sealInto(Uint8List nonce, Uint8List msg, Uint8List aad, Uint8List out,
+      int outOffset) {
     _checkNonce(nonce);
+    final length = msg.length;
+    if (outOffset < 0 || out.length - outOffset < length + tagLength) {
+      throw ArgumentError('Output buffer too small');
+    }
     final l = 15 - nonce.length;
-    final counter = _buildCounter(nonce, BigInt.zero, l);
 
     final mac = _cbcmacCalc(nonce, aad, msg);
-    _ctr.counter = counter;
-    late Uint8List authValue;
-    if (tagLength == 16) {
-      authValue = _ctr.encrypt(mac);
-    } else {
-      final paddedMac = _padWithZeroes(mac, 16);
-      authValue = _ctr.encrypt(paddedMac).sublist(0, tagLength);
+    // A_0 masks the tag; the message is encrypted from A_1 onwards.
+    final tagMask = _engine.encrypt(_buildCounter(nonce, BigInt.zero, l));
+    _engine.ctrXor(
+        _buildCounter(nonce, BigInt.one, l), l, msg, out, outOffset);
+    for (var i = 0; i < tagLength; i++) {
+      out[outOffset + length + i] = mac[i] ^ tagMask[i];
     }
-    final encMsg = _ctr.encrypt(msg);
-    return Uint8List.fromList([...encMsg, ...authValue]);
+    return length + tagLength;
   }
 
   Uint8List? open(Uint8List nonce, Uint8List ciphertext, Uint8List aad) {
+    return openInPlace(nonce, Uint8List.fromList(ciphertext), aad);
+  }
+
+  /// Authenticates and decrypts [ciphertext] (with trailing tag) in place.
+  ///
+  /// Returns a view over the plaintext (the leading bytes of [ciphertext])
+  /// or `null` when the tag does not match, in which case the buffer is
+  /// left untouched.
+  Uint8List? openInPlace(Uint8List nonce, Uint8List ciphertext, Uint8List aad) {
     _checkNonce(nonce);
     if (ciphertext.length < tagLength) {
       return null;
     }
 
     final l = 15 - nonce.length;
-    final counter = _buildCounter(nonce, BigInt.zero, l);
-    final authValue = ciphertext.sublist(ciphertext.length - tagLength);
+    final length = ciphertext.length - tagLength;
 
-    _ctr.counter = counter;
-    late Uint8List receivedMac;
-    if (tagLength == 16) {
-      receivedMac = _ctr.decrypt(authValue);
-    } else {
-      final paddedAuth = _padWithZeroes(authValue, 16);
-      receivedMac = _ctr.decrypt(paddedAuth).sublist(0, tagLength);
+    final tagMask = _engine.encrypt(_buildCounter(nonce, BigInt.zero, l));
+    final receivedMac = Uint8List(tagLength);
+    for (var i = 0; i < tagLength; i++) {
+      receivedMac[i] = ciphertext[length + i] ^ tagMask[i];
     }
 
-    final decrypted = _ctr.decrypt(ciphertext);
-    final msg = decrypted.sublist(0, decrypted.length - tagLength);
+    final body = Uint8List.sublistView(ciphertext, 0, length);
+    final msg = Uint8List(length);
+    _engine.ctrXor(_buildCounter(nonce, BigInt.one, l), l, body, msg, 0);
     final computedMac = _cbcmacCalc(nonce, aad, msg);
 
     if (!_constantTimeEquals(receivedMac, computedMac)) {
       return null;
     }
-    return msg;
+    body.setAll(0, msg);
+    return body;
   }
 
   void _checkNonce(Uint8List nonce) {
@@ -139,10 +150,14 @@ class AESCCM {
       macInput = _padWithZeroes(msgBuilder.toBytes(), 16);
     }
 
-    _cbc.iv = Uint8List(16);
-    final cbcmac = _cbc.encrypt(macInput);
-    final start = cbcmac.length - 16;
-    return cbcmac.sublist(start, start + tagLength);
+    final state = Uint8List(16);
+    for (var offset = 0; offset < macInput.length; offset += 16) {
+      for (var j = 0; j < 16; j++) {
+        state[j] ^= macInput[offset + j];
+      }
+      _engine.encryptBlocks(state, 0, state, 0, 1);
+    }
+    return state.sublist(0, tagLength);
   }
 
   Uint8List _encodeAadLength(int length) {
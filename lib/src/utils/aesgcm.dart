@@ -1,36 +1,68 @@
 import 'dart:typed_data';
 
 import 'aes.dart';
+import 'aes_engine.dart';
 import 'constanttime.dart';
-import 'cryptomath.dart';
-import 'dart_aes.dart' as dart_aes;
+import 'ghash.dart';
+
+/// XORs the GCM keystream for the 96-bit [nonce], starting at block counter
+/// [initialCounter], over [input] and writes the result to [out] at
+/// [outOffset]. [input] may alias [out] at the same offset.
+void gcmCtrXor(RawAesEncrypt encrypt, Uint8List nonce, int initialCounter,
+    Uint8List input, Uint8List out, int outOffset) {
+  final counter = Uint8List(16)..setRange(0, 12, nonce);
+  final length = input.length;
+  var ctr = initialCounter;
+  for (var offset = 0; offset < length; offset += 16) {
+    counter[12] = (ctr >> 24) & 0xff;
+    counter[13] = (ctr >> 16) & 0xff;
+    counter[14] = (ctr >> 8) & 0xff;
+    counter[15] = ctr & 0xff;
+    final keystream = encrypt(counter);
+    final n = length - offset < 16 ? length - offset : 16;
+    for (var j = 0; j < n; j++) {
+      out[outOffset + offset + j] = input[offset + j] ^ keystream[j];
+    }
+    ctr = (ctr + 1) & 0xffffffff;
+  }
+}
 
-/// Pure Dart AES-GCM implementation (slow, but dependency-free).
+/// Pure Dart AES-GCM implementation (dependency-free); GHASH runs on the
+/// 64-bit tables of [Ghash].
 class AESGCM {
   AESGCM(Uint8List key, this.implementation, RawAesEncrypt rawAesEncrypt)
       : key = Uint8List.fromList(key),
-        _rawAesEncrypt = rawAesEncrypt {
-    if (key.length == 16) {
-      name = 'aes128gcm';
-    } else if (key.length == 32) {
-      name = 'aes256gcm';
-    } else {
-      throw ArgumentError('AES-GCM key must be 16 or 32 bytes long');
-    }
-    _ctr = dart_aes.Dart_AES_CTR.Dart_AES_CTR(
-      Uint8List.fromList(this.key),
-      aesModeCTR_OR_GCM,
-      Uint8List(16),
-    );
-    _productTable = List<BigInt>.filled(16, BigInt.zero);
-    final h = bytesToNumber(_rawAesEncrypt(Uint8List(16)));
-    _productTable[_reverseBits(1)] = h;
-    for (var i = 2; i < 16; i += 2) {
-      _productTable[_reverseBits(i)] =
-          _gcmShift(_productTable[_reverseBits(i ~/ 2)]);
-      _productTable[_reverseBits(i + 1)] =
-          _gcmAdd(_productTable[_reverseBits(i)], h);
+        _rawAesEncrypt = rawAesEncrypt,
+        name = _nameFor(key.length),
+        _engine = null {
+    _ghash = Ghash(_rawAesEncrypt(Uint8List(16)));
+  }
+
+  /// AES-GCM on the portable [engine]: the keystream for a whole record is
+  /// produced by one [AesEngine.ctrXor] call instead of a callback per
+  /// block.
+  AESGCM.withEngine(Uint8List key, this.implementation, AesEngine engine)
+      : key = Uint8List.fromList(key),
+        name = _nameFor(key.length),
+        _engine = engine {
+    _rawAesEncrypt = engine.encrypt;
+    _ghash = Ghash(engine.encrypt(Uint8List(16)));
+  }
+
+  /// Constructor for subclasses that override [sealInto] and [openInPlace]
+  /// with a native backend; [implementation] names that backend.
+  AESGCM.withBackend(Uint8List key, this.implementation)
+      : key = Uint8List.fromList(key),
+        name = _nameFor(key.length),
+        _engine = null;
+
+  static String _nameFor(int keyLength) {
+    if (keyLength == 16) {
+      return 'aes128gcm';
+    } else if (keyLength == 32) {
+      return 'aes256gcm';
     }
+    throw ArgumentError('AES-GCM key must be 16 or 32 bytes long');
   }
 
   final bool isBlockCipher = false;
@@ -38,44 +70,78 @@ class AESGCM {
   final int nonceLength = 12;
   final int tagLength = 16;
   final String implementation;
-  late final String name;
+  final String name;
   final Uint8List key;
 
-  final RawAesEncrypt _rawAesEncrypt;
-  late final dart_aes.Dart_AES_CTR _ctr;
-  late final List<BigInt> _productTable;
+  late final RawAesEncrypt _rawAesEncrypt;
+  final AesEngine? _engine;
+  late final Ghash _ghash;
 
   Uint8List seal(Uint8List nonce, Uint8List plaintext, Uint8List data) {
+    final out = Uint8List(plaintext.length + tagLength);
+    sealInto(nonce, plaintext, data, out, 0);
+    return out;
+  }
+
+  /// Encrypts [plaintext] and writes `ciphertext || tag` into [out] starting
+  /// at [outOffset], returning the number of bytes written.
+  ///
+  /// [plaintext] may be a view of [out] at the same offset, in which case the
+  /// data is encrypted in place.
+  int sealInto(Uint8List nonce, Uint8List plaintext, Uint8List data,
+      Uint8List out, int outOffset) {
     _checkNonce(nonce);
-    final tagCounter = _buildCounter(nonce, 1);
-    final tagMask = _rawAesEncrypt(tagCounter);
-    final encCounter = _buildCounter(nonce, 2);
-    _ctr.counter = encCounter;
-    final ciphertext = _ctr.encrypt(plaintext);
+    final length = plaintext.length;
+    if (outOffset < 0 || out.length - outOffset < length + tagLength) {
+      throw ArgumentError('Output buffer too small');
+    }
+    final tagMask = _rawAesEncrypt(_buildCounter(nonce, 1));
+    _keystreamXor(nonce, plaintext, out, outOffset);
+    final ciphertext =
+        Uint8List.sublistView(out, outOffset, outOffset + length);
     final tag = _auth(ciphertext, data, tagMask);
-    return Uint8List.fromList([...ciphertext, ...tag]);
+    out.setRange(outOffset + length, outOffset + length + tagLength, tag);
+    return length + tagLength;
   }
 
   Uint8List? open(
       Uint8List nonce, Uint8List ciphertextWithTag, Uint8List data) {
+    return openInPlace(nonce, Uint8List.fromList(ciphertextWithTag), data);
+  }
+
+  /// Authenticates and decrypts [ciphertextWithTag] in place.
+  ///
+  /// Returns a view over the plaintext (the leading bytes of
+  /// [ciphertextWithTag]) or `null` when the tag does not match, in which
+  /// case the buffer is left untouched.
+  Uint8List? openInPlace(
+      Uint8List nonce, Uint8List ciphertextWithTag, Uint8List data) {
     _checkNonce(nonce);
     if (ciphertextWithTag.length < tagLength) {
       return null;
     }
-    final tag = ciphertextWithTag.sublist(ciphertextWithTag.length - tagLength);
-    final ciphertext =
-        ciphertextWithTag.sublist(0, ciphertextWithTag.length - tagLength);
+    final length = ciphertextWithTag.length - tagLength;
+    final ciphertext = Uint8List.sublistView(ciphertextWithTag, 0, length);
+    final tag = Uint8List.sublistView(ciphertextWithTag, length);
 
-    final tagCounter = _buildCounter(nonce, 1);
-    final tagMask = _rawAesEncrypt(tagCounter);
+    final tagMask = _rawAesEncrypt(_buildCounter(nonce, 1));
     final calculated = _auth(ciphertext, data, tagMask);
     if (!ctCompareDigest(calculated, tag)) {
       return null;
     }
 
-    final encCounter = _buildCounter(nonce, 2);
-    _ctr.counter = encCounter;
-    return _ctr.decrypt(ciphertext);
+    _keystreamXor(nonce, ciphertext, ciphertext, 0);
+    return ciphertext;
+  }
+
+  void _keystreamXor(
+      Uint8List nonce, Uint8List input, Uint8List out, int outOffset) {
+    final engine = _engine;
+    if (engine != null) {
+      engine.ctrXor(_buildCounter(nonce, 2), 4, input, out, outOffset);
+    } else {
+      gcmCtrXor(_rawAesEncrypt, nonce, 2, input, out, outOffset);
+    }
   }
 
   void _checkNonce(Uint8List nonce) {
@@ -95,82 +161,13 @@ class AESGCM {
   }
 
   Uint8List _auth(Uint8List ciphertext, Uint8List ad, Uint8List tagMask) {
-    var y = BigInt.zero;
-    y = _update(y, ad);
-    y = _update(y, ciphertext);
-    y ^= (BigInt.from(ad.length) << 67) | (BigInt.from(ciphertext.length) << 3);
-    y = _mul(y);
-    y ^= bytesToNumber(tagMask);
-    return numberToByteArray(y, howManyBytes: 16);
-  }
-
-  BigInt _update(BigInt y, Uint8List data) {
-    var result = y;
-    final fullBlocks = data.length ~/ 16;
-    for (var i = 0; i < fullBlocks; i++) {
-      final block = data.sublist(i * 16, i * 16 + 16);
-      result ^= bytesToNumber(block);
-      result = _mul(result);
-    }
-    final extra = data.length % 16;
-    if (extra != 0) {
-      final block = Uint8List(16);
-      block.setRange(0, extra, data.sublist(data.length - extra));
-      result ^= bytesToNumber(block);
-      result = _mul(result);
-    }
-    return result;
-  }
-
-  BigInt _mul(BigInt y) {
-    var ret = BigInt.zero;
-    var val = y;
-    for (var i = 0; i < 128; i += 4) {
-      final retHigh = (ret & BigInt.from(0xf)).toInt();
-      ret >>= 4;
-      ret ^= (BigInt.from(_gcmReductionTable[retHigh]) << (128 - 16));
-      final idx = (val & BigInt.from(0xf)).toInt();
-      ret ^= _productTable[idx];
-      val >>= 4;
+    final ghash = _ghash..reset();
+    ghash.update(ad);
+    ghash.update(ciphertext);
+    final tag = ghash.finalize(ad.length, ciphertext.length);
+    for (var i = 0; i < 16; i++) {
+      tag[i] ^= tagMask[i];
     }
-    return ret;
+    return tag;
   }
-
-  static int _reverseBits(int value) {
-    assert(value < 16);
-    var i = value & 0xf;
-    i = ((i << 2) & 0xc) | ((i >> 2) & 0x3);
-    i = ((i << 1) & 0xa) | ((i >> 1) & 0x5);
-    return i;
-  }
-
-  static BigInt _gcmAdd(BigInt x, BigInt y) => x ^ y;
-
-  static BigInt _gcmShift(BigInt x) {
-    final highTermSet = (x & BigInt.one) == BigInt.one;
-    var result = x >> 1;
-    if (highTermSet) {
-      result ^= BigInt.from(0xe1) << (128 - 8);
-    }
-    return result;
-  }
-
-  static const List<int> _gcmReductionTable = <int>[
-    0x0000,
-    0x1c20,
-    0x3840,
-    0x2460,
-    0x7080,
-    0x6ca0,
-    0x48c0,
-    0x54e0,
-    0xe100,
-    0xfd20,
-    0xd940,
-    0xc560,
-    0x9180,
-    0x8da0,
-    0xa9c0,
-    0xb5e0,
-  ];
 }
@@ -18,11 +18,19 @@ abstract class BinaryInput {
   int readInt32();
 
   /// Lê [length] bytes brutos.
+  ///
+  /// O retorno pode ser uma view do buffer interno da implementação; nesse
+  /// caso a implementação garante que a região devolvida nunca será
+  /// sobrescrita, de modo que o chamador pode retê-la sem copiar.
   List<int> readBytes(int length);
 }
 
 /// Implementação de [BinaryInput] que lê de um [Socket] com buffer interno
 /// sem copiar todo o conteúdo a cada leitura.
+///
+/// [readBytes] devolve views do buffer interno. Depois que uma view é
+/// emprestada, o buffer não é mais rebobinado: quando o espaço livre acaba,
+/// um buffer novo é alocado e o antigo fica com quem segura as views.
 class SocketBinaryInput implements BinaryInput {
   SocketBinaryInput(
     Stream<List<int>> stream, {
@@ -40,6 +48,10 @@ class SocketBinaryInput implements BinaryInput {
   int _readOffset = 0;
   int _writeLength = 0;
 
+  /// Verdadeiro quando alguma view de [_buffer] foi entregue por [readBytes];
+  /// a região já lida não pode mais ser reaproveitada.
+  bool _bufferLent = false;
+
   bool _done = false;
   Object? _error;
   StackTrace? _errorStackTrace;
@@ -85,23 +97,33 @@ class SocketBinaryInput implements BinaryInput {
       return;
     }
 
-    // Realoca crescendo a capacidade para evitar realocações frequentes.
     final unread = _writeLength - _readOffset;
     final needed = unread + data.length;
-    var newCapacity = _buffer.length * 2;
-    if (newCapacity < needed) {
-      newCapacity = needed;
-    }
-    final newBuffer = Uint8List(newCapacity);
 
-    if (unread > 0) {
-      newBuffer.setRange(0, unread, _buffer.sublist(_readOffset, _writeLength));
+    if (needed <= _buffer.length && !_bufferLent) {
+      // Cabe após compactar: move os bytes não lidos para o início.
+      if (unread > 0) {
+        _buffer.setRange(0, unread, _buffer, _readOffset);
+      }
+    } else {
+      // Realoca; só cresce quando a capacidade atual não comporta os dados.
+      var newCapacity = _buffer.length;
+      if (newCapacity < needed) {
+        newCapacity *= 2;
+        if (newCapacity < needed) {
+          newCapacity = needed;
+        }
+      }
+      final newBuffer = Uint8List(newCapacity);
+      if (unread > 0) {
+        newBuffer.setRange(0, unread, _buffer, _readOffset);
+      }
+      _buffer = newBuffer;
+      _bufferLent = false;
     }
-    newBuffer.setRange(unread, unread + data.length, data);
-
-    _buffer = newBuffer;
+    _buffer.setRange(unread, needed, data);
     _readOffset = 0;
-    _writeLength = unread + data.length;
+    _writeLength = needed;
   }
 
   Uint8List _consume(int length) {
@@ -117,8 +139,9 @@ class SocketBinaryInput implements BinaryInput {
         Uint8List.sublistView(_buffer, _readOffset, _readOffset + length);
     _readOffset += length;
 
-    // Se consumiu tudo, reseta os ponteiros para liberar espaço.
-    if (_readOffset == _writeLength) {
+    // Se consumiu tudo, reseta os ponteiros para liberar espaço (a menos que
+    // views do buffer estejam emprestadas).
+    if (_readOffset == _writeLength && !_bufferLent) {
       _readOffset = 0;
       _writeLength = 0;
     }
@@ -168,8 +191,12 @@ class SocketBinaryInput implements BinaryInput {
   }
 
   @override
-  List<int> readBytes(int length) {
-    return _consume(length);
+  Uint8List readBytes(int length) {
+    final view = _consume(length);
+    if (length > 0) {
+      _bufferLent = true;
+    }
+    return view;
   }
 }
 
@@ -216,7 +243,7 @@ class MemoryBinaryInput implements BinaryInput {
   }
 
   @override
-  List<int> readBytes(int length) {
+  Uint8List readBytes(int length) {
     _ensureSync(length);
     final slice = Uint8List.sublistView(_buffer, _offset, _offset + length);
     _offset += length;
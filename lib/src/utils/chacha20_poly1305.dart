@@ -15,6 +15,15 @@ class Chacha20Poly1305 {
     }
   }
 
+  /// Constructor for subclasses that override [sealInto] and [openInPlace]
+  /// with a native backend; [implementation] names that backend.
+  Chacha20Poly1305.withBackend(Uint8List key, this.implementation)
+      : key = Uint8List.fromList(key) {
+    if (key.length != 32) {
+      throw ArgumentError('ChaCha20-Poly1305 key must be 32 bytes long');
+    }
+  }
+
   final bool isBlockCipher = false;
   final bool isAEAD = true;
   final int nonceLength = 12;
@@ -38,34 +47,66 @@ class Chacha20Poly1305 {
 
   Uint8List seal(
       Uint8List nonce, Uint8List plaintext, Uint8List associatedData) {
+    final out = Uint8List(plaintext.length + tagLength);
+    sealInto(nonce, plaintext, associatedData, out, 0);
+    return out;
+  }
+
+  /// Encrypts [plaintext] and writes `ciphertext || tag` into [out] starting
+  /// at [outOffset], returning the number of bytes written.
+  ///
+  /// [plaintext] may be a view of [out] at the same offset.
+  int sealInto(Uint8List nonce, Uint8List plaintext, Uint8List associatedData,
+      Uint8List out, int outOffset) {
     if (nonce.length != nonceLength) {
       throw ArgumentError('Nonce must be $nonceLength bytes long');
     }
+    final length = plaintext.length;
+    if (outOffset < 0 || out.length - outOffset < length + tagLength) {
+      throw ArgumentError('Output buffer too small');
+    }
     final otk = poly1305KeyGen(key, nonce);
-    final ciphertext = ChaCha(key, nonce, initialCounter: 1).encrypt(plaintext);
+    out.setRange(outOffset, outOffset + length,
+        ChaCha(key, nonce, initialCounter: 1).encrypt(plaintext));
+    final ciphertext =
+        Uint8List.sublistView(out, outOffset, outOffset + length);
     final macData = _buildMacData(associatedData, ciphertext);
     final tag = Poly1305(otk).createTag(macData);
-    return Uint8List.fromList([...ciphertext, ...tag]);
+    out.setRange(outOffset + length, outOffset + length + tagLength, tag);
+    return length + tagLength;
   }
 
   Uint8List? open(
       Uint8List nonce, Uint8List ciphertextWithTag, Uint8List associatedData) {
+    return openInPlace(
+        nonce, Uint8List.fromList(ciphertextWithTag), associatedData);
+  }
+
+  /// Authenticates and decrypts [ciphertextWithTag] in place.
+  ///
+  /// Returns a view over the plaintext (the leading bytes of
+  /// [ciphertextWithTag]) or `null` when the tag does not match, in which
+  /// case the buffer is left untouched.
+  Uint8List? openInPlace(
+      Uint8List nonce, Uint8List ciphertextWithTag, Uint8List associatedData) {
     if (nonce.length != nonceLength) {
       throw ArgumentError('Nonce must be $nonceLength bytes long');
     }
     if (ciphertextWithTag.length < tagLength) {
       return null;
     }
-    final tag = ciphertextWithTag.sublist(ciphertextWithTag.length - tagLength);
-    final ciphertext =
-        ciphertextWithTag.sublist(0, ciphertextWithTag.length - tagLength);
+    final length = ciphertextWithTag.length - tagLength;
+    final tag = Uint8List.sublistView(ciphertextWithTag, length);
+    final ciphertext = Uint8List.sublistView(ciphertextWithTag, 0, length);
     final otk = poly1305KeyGen(key, nonce);
     final macData = _buildMacData(associatedData, ciphertext);
     final expectedTag = Poly1305(otk).createTag(macData);
     if (!ctCompareDigest(expectedTag, tag)) {
       return null;
     }
-    return ChaCha(key, nonce, initialCounter: 1).decrypt(ciphertext);
+    ciphertext.setAll(
+        0, ChaCha(key, nonce, initialCounter: 1).decrypt(ciphertext));
+    return ciphertext;
   }
 
   Uint8List _buildMacData(Uint8List aad, Uint8List ciphertext) {
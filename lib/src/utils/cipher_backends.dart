@@ -0,0 +1,118 @@
+import 'dart:ffi' show Abi;
+
+import '../experimental/aesgcm_asm_x86_64.dart' show PclmulqdqSupport;
+import '../experimental/chacha20_poly1305_asm_x86_64.dart'
+    show ChaCha20Poly1305AsmSupport;
+import '../experimental/chacha_asm_x86_64.dart' show ChaChaAsmSupport;
+import '../experimental/rijndael_fast_asm_x86_64.dart' show AesNiSupport;
+import '../experimental/sha256_asm_x86_64.dart' show ShaNiSupport;
+
+/// CPU features the native cipher backends depend on.
+///
+/// [current] is probed once per isolate, on first use, through the CPUID
+/// checks of the `*Support` classes in `lib/src/experimental`. Those checks
+/// run x86 machine code, so on any other ABI nothing is probed and every
+/// feature reads as absent.
+class CpuFeatures {
+  const CpuFeatures({
+    this.aesNi = false,
+    this.pclmulqdq = false,
+    this.sse2 = false,
+    this.ssse3 = false,
+    this.avx2 = false,
+    this.shaNi = false,
+  });
+
+  factory CpuFeatures._probe() {
+    final abi = Abi.current();
+    if (abi != Abi.linuxX64 && abi != Abi.windowsX64) {
+      return const CpuFeatures();
+    }
+    return CpuFeatures(
+      aesNi: AesNiSupport.isSupported,
+      pclmulqdq: PclmulqdqSupport.isSupported,
+      sse2: ChaChaAsmSupport.isSSE2Supported,
+      ssse3: ChaCha20Poly1305AsmSupport.isSupported,
+      avx2: ChaCha20Poly1305AsmSupport.isAvx2Supported,
+      shaNi: ShaNiSupport.isSupported,
+    );
+  }
+
+  /// Features of the CPU this isolate runs on.
+  static final CpuFeatures current = CpuFeatures._probe();
+
+  final bool aesNi;
+  final bool pclmulqdq;
+  final bool sse2;
+  final bool ssse3;
+  final bool avx2;
+  final bool shaNi;
+
+  @override
+  String toString() => 'CpuFeatures(aesNi: $aesNi, pclmulqdq: $pclmulqdq, '
+      'sse2: $sse2, ssse3: $ssse3, avx2: $avx2, shaNi: $shaNi)';
+}
+
+/// Symmetric primitives with more than one backend in the cipher factory.
+enum CipherPrimitive { aesCbc, aesGcm, chacha20Poly1305 }
+
+/// Registry of the backends the cipher factory can build, by name.
+///
+/// Implementation lists (`HandshakeSettings.cipherImplementations`, the
+/// `implementations` argument of the `create*` functions) are in preference
+/// order; each primitive gets the first entry that is usable on this CPU.
+/// [dart] is always usable, so a list ending in it never fails.
+class CipherBackends {
+  CipherBackends._();
+
+  /// Native x86_64 kernels from `lib/src/experimental`.
+  static const String asmX8664 = 'asm-x86_64';
+
+  /// Portable Dart code.
+  static const String dart = 'dart';
+
+  /// Every implementation name the cipher factory understands, fastest
+  /// first.
+  static const List<String> all = [asmX8664, dart];
+
+  /// Whether [implementation] can build [primitive] on [cpu] (the current
+  /// CPU by default).
+  static bool isAvailable(String implementation, CipherPrimitive primitive,
+      [CpuFeatures? cpu]) {
+    if (implementation == dart) {
+      return true;
+    }
+    if (implementation != asmX8664) {
+      return false;
+    }
+    final features = cpu ?? CpuFeatures.current;
+    switch (primitive) {
+      case CipherPrimitive.aesCbc:
+        return features.aesNi;
+      case CipherPrimitive.aesGcm:
+        // Only the fused AES-NI + PCLMULQDQ kernel beats the Dart code by
+        // enough to be worth a native call per block.
+        return features.aesNi && features.pclmulqdq;
+      case CipherPrimitive.chacha20Poly1305:
+        return features.ssse3;
+    }
+  }
+
+  /// First entry of [implementations] usable for [primitive], or null.
+  static String? select(CipherPrimitive primitive, List<String> implementations,
+      [CpuFeatures? cpu]) {
+    for (final impl in implementations) {
+      if (isAvailable(impl, primitive, cpu)) {
+        return impl;
+      }
+    }
+    return null;
+  }
+
+  /// Backend each primitive resolves to when every implementation is
+  /// allowed, for logging and diagnostics.
+  static Map<CipherPrimitive, String> get selected => {
+        for (final primitive in CipherPrimitive.values)
+          primitive: select(primitive, all)!,
+      };
+}
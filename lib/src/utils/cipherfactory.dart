@@ -1,9 +1,13 @@
 import 'dart:typed_data';
 
+import '../experimental/aesgcm_asm_x86_64.dart';
+import '../experimental/chacha20_poly1305_asm_x86_64.dart';
+import '../experimental/rijndael_fast_asm_x86_64.dart' show AesCbcAsm;
 import 'aes.dart';
 import 'aesccm.dart';
 import 'aesgcm.dart';
 import 'chacha20_poly1305.dart';
+import 'cipher_backends.dart';
 import 'dart_aes.dart' as dart_aes;
 import 'dart_aesgcm.dart' as dart_aesgcm;
 import 'dart_aesccm.dart' as dart_aesccm;
@@ -13,19 +17,22 @@ import 'dart_tripledes.dart' as dart_tripledes;
 import 'rc4.dart';
 import 'tripledes.dart';
 
+/// Implementation names are tried in order and ones the CPU cannot run are
+/// skipped (see [CipherBackends]); `'asm-x86_64'` needs AES-NI.
 AES createAES(Uint8List key, Uint8List iv, {List<String>? implementations}) {
   final implList = implementations ?? const ['dart'];
-  for (final impl in implList) {
-    if (impl == 'dart') {
-      if (iv.length != 16) {
-        throw ArgumentError('AES CBC IV must be exactly 16 bytes long');
-      }
+  if (iv.length != 16) {
+    throw ArgumentError('AES CBC IV must be exactly 16 bytes long');
+  }
+  switch (CipherBackends.select(CipherPrimitive.aesCbc, implList)) {
+    case CipherBackends.asmX8664:
+      return AesCbcAsm(key, iv);
+    case CipherBackends.dart:
       return dart_aes.newAES(
         Uint8List.fromList(key),
         aesModeCBC,
         Uint8List.fromList(iv),
       );
-    }
   }
   throw UnsupportedError('No supported AES implementation found for $implList');
 }
@@ -48,12 +55,15 @@ AES createAESCTR(Uint8List key, Uint8List iv, {List<String>? implementations}) {
       'No supported AES-CTR implementation found for $implList');
 }
 
+/// Besides `'dart'`, accepts `'asm-x86_64'`: the fused AES-NI + PCLMULQDQ
+/// kernel, skipped when the CPU lacks either instruction set.
 AESGCM createAESGCM(Uint8List key, {List<String>? implementations}) {
   final implList = implementations ?? const ['dart'];
-  for (final impl in implList) {
-    if (impl == 'dart') {
+  switch (CipherBackends.select(CipherPrimitive.aesGcm, implList)) {
+    case CipherBackends.asmX8664:
+      return AESGCMAsm.fused(Uint8List.fromList(key));
+    case CipherBackends.dart:
       return dart_aesgcm.newAESGCM(Uint8List.fromList(key));
-    }
   }
   throw UnsupportedError(
       'No supported AES-GCM implementation found for $implList');
@@ -81,13 +91,16 @@ AESCCM createAESCCM8(Uint8List key, {List<String>? implementations}) {
       'No supported AES-CCM-8 implementation found for $implList');
 }
 
+/// Besides `'dart'`, accepts `'asm-x86_64'`: the native SSSE3/AVX2 kernel,
+/// skipped when the CPU cannot run it.
 Chacha20Poly1305 createCHACHA20(Uint8List key,
     {List<String>? implementations}) {
   final implList = implementations ?? const ['dart'];
-  for (final impl in implList) {
-    if (impl == 'dart') {
+  switch (CipherBackends.select(CipherPrimitive.chacha20Poly1305, implList)) {
+    case CipherBackends.asmX8664:
+      return Chacha20Poly1305Asm(Uint8List.fromList(key));
+    case CipherBackends.dart:
       return dart_chacha20_poly1305.newChaCha20Poly1305(Uint8List.fromList(key));
-    }
   }
   throw UnsupportedError(
       'No supported ChaCha20-Poly1305 implementation found for $implList');
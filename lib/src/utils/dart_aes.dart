@@ -1,8 +1,6 @@
 import 'dart:typed_data';
-import 'dart:math';
 import 'aes.dart'; // Contém a classe base AES
-import 'rijndael_slow.dart'; // Contém a implementação do bloco Rijndael/AES
-import 'cryptomath.dart'; // Contém bytesToNumber e numberToByteArray
+import 'aes_engine.dart'; // Contém o motor AES de tabelas T
 
 /// Factory function to create a new dart AES cipher instance.
 ///
@@ -28,20 +26,13 @@ AES newAES(Uint8List key, int mode, Uint8List iv) {
 
 /// Pure Dart implementation of AES in CBC mode.
 class Dart_AES extends AES {
-  late final Rijndael _rijndael;
-  // Assumindo que a classe base AES tem 'Uint8List iv'
+  late final AesEngine _engine;
   // O IV aqui representa o estado *atual* do vetor de encadeamento.
 
   Dart_AES(Uint8List key, int mode, Uint8List iv)
       // mode é sempre CBC (2) para esta classe
       : super(key, aesModeCBC, iv, "dart") {
-    // Cria uma cópia da chave para garantir imutabilidade da entrada
-    final internalKey = Uint8List.fromList(key);
-    _rijndael =
-        Rijndael(internalKey, blockSize: 16); // AES block size is 16 bytes
-    // A classe base já deve ter armazenado o IV inicial.
-    // Não precisamos de uma cópia separada aqui se a base já o fez.
-    // this.iv = Uint8List.fromList(iv); // Desnecessário se a base armazena
+    _engine = AesEngine(key);
   }
 
   @override
@@ -51,44 +42,30 @@ class Dart_AES extends AES {
           "Plaintext length must be a multiple of 16 bytes for CBC");
     }
 
-    // Cria uma cópia mutável do plaintext para guardar o ciphertext
-    final ciphertextBytes = Uint8List.fromList(plaintext);
-    // Cria uma cópia mutável do IV atual para o encadeamento
-    // Acessa o 'iv' da classe base (ou desta classe se a base não tiver)
-    var chainBytes = Uint8List.fromList(iv);
-
-    // CBC Mode: Para cada bloco...
-    for (int i = 0; i < ciphertextBytes.lengthInBytes; i += 16) {
-      final currentBlockOffset = i;
-
-      // Pega o bloco atual de plaintext (direto do buffer que será modificado)
-      // Uint8List plaintextBlock = ciphertextBytes.buffer.asUint8List(ciphertextBytes.offsetInBytes + currentBlockOffset, 16);
-
-      // XOR com o bloco de encadeamento anterior
-      for (int j = 0; j < 16; j++) {
-        ciphertextBytes[currentBlockOffset + j] ^= chainBytes[j];
+    // O ciphertext é gerado no lugar, sobre uma cópia do plaintext
+    final out = Uint8List.fromList(plaintext);
+    final chain = iv;
+    var prev = -16; // offset do bloco de encadeamento anterior em out
+
+    for (int i = 0; i < out.lengthInBytes; i += 16) {
+      if (prev < 0) {
+        for (int j = 0; j < 16; j++) {
+          out[i + j] ^= chain[j];
+        }
+      } else {
+        for (int j = 0; j < 16; j++) {
+          out[i + j] ^= out[prev + j];
+        }
       }
-
-      // Criptografa o bloco XORado (direto do buffer modificado)
-      // Precisamos passar uma cópia ou view para rijndael.encrypt
-      final blockToEncrypt = Uint8List.view(ciphertextBytes.buffer,
-          ciphertextBytes.offsetInBytes + currentBlockOffset, 16);
-      final encryptedBlock = _rijndael.encrypt(blockToEncrypt);
-
-      // Sobrescreve o bloco original com o bloco criptografado
-      ciphertextBytes.setRange(
-          currentBlockOffset, currentBlockOffset + 16, encryptedBlock);
-
-      // Define o próximo bloco de encadeamento (o ciphertext recém-gerado)
-      // Cria uma cópia para evitar problemas se encryptedBlock for uma view
-      chainBytes = Uint8List.fromList(encryptedBlock);
+      _engine.encryptBlocks(out, i, out, i, 1);
+      prev = i;
     }
 
-    // Atualiza o IV da instância com o último bloco de ciphertext para o próximo uso
-    // (Comportamento padrão do modo CBC)
-    iv = chainBytes; // Atualiza o iv na classe base ou nesta classe
-
-    return ciphertextBytes;
+    // Atualiza o IV com o último bloco de ciphertext para o próximo uso
+    if (prev >= 0) {
+      iv = out.sublist(prev, prev + 16);
+    }
+    return out;
   }
 
   @override
@@ -98,45 +75,30 @@ class Dart_AES extends AES {
           "Ciphertext length must be a multiple of 16 bytes for CBC");
     }
 
-    // Cria uma cópia mutável do ciphertext para guardar o plaintext
-    final plaintextBytes = Uint8List.fromList(ciphertext);
-    // Cria uma cópia mutável do IV atual para o encadeamento
-    var chainBytes = Uint8List.fromList(iv);
-
-    // CBC Mode: Para cada bloco...
-    for (int i = 0; i < plaintextBytes.lengthInBytes; i += 16) {
-      final currentBlockOffset = i;
-
-      // Guarda o bloco de ciphertext *original* para o próximo encadeamento
-      final originalCipherBlock = Uint8List.fromList(
-          plaintextBytes.sublist(currentBlockOffset, currentBlockOffset + 16));
-
-      // Decripta o bloco atual
-      final decryptedBlock = _rijndael.decrypt(originalCipherBlock);
-
-      // XOR com o bloco de encadeamento anterior
-      for (int j = 0; j < 16; j++) {
-        decryptedBlock[j] ^= chainBytes[j];
-      }
-
-      // Sobrescreve o bloco original (agora plaintextBytes) com o bloco decriptado XORado
-      plaintextBytes.setRange(
-          currentBlockOffset, currentBlockOffset + 16, decryptedBlock);
-
-      // Define o próximo bloco de encadeamento (o bloco de ciphertext original)
-      chainBytes = originalCipherBlock;
+    final length = ciphertext.lengthInBytes;
+    final out = Uint8List(length);
+    // Em CBC a decriptação não tem dependência entre blocos: decripta
+    // tudo de uma vez e depois aplica o XOR com o ciphertext anterior.
+    _engine.decryptBlocks(ciphertext, 0, out, 0, length ~/ 16);
+    if (length == 0) {
+      return out;
+    }
+    for (int j = 0; j < 16; j++) {
+      out[j] ^= iv[j];
+    }
+    for (int i = 16; i < length; i++) {
+      out[i] ^= ciphertext[i - 16];
     }
 
-    // Atualiza o IV da instância com o último bloco de *ciphertext* original
-    iv = chainBytes;
-
-    return plaintextBytes;
+    // Atualiza o IV com o último bloco de *ciphertext* original
+    iv = ciphertext.sublist(length - 16, length);
+    return out;
   }
 }
 
 /// Pure Dart implementation of AES in CTR mode.
 class Dart_AES_CTR extends AES {
-  late final Rijndael _rijndael;
+  late final AesEngine _engine;
   // O 'iv' da classe base armazena o nonce inicial
   late Uint8List _counter; // O bloco de contador completo (nonce + counter)
   late final int
@@ -149,8 +111,7 @@ class Dart_AES_CTR extends AES {
       throw ArgumentError(
           "Nonce (IV) length must be at most 16 bytes for CTR mode");
     }
-    final internalKey = Uint8List.fromList(key);
-    _rijndael = Rijndael(internalKey, blockSize: 16);
+    _engine = AesEngine(key);
     _counterBytesLength = 16 - nonce.length;
 
     // Inicializa o bloco de contador
@@ -170,88 +131,38 @@ class Dart_AES_CTR extends AES {
     _counter = Uint8List.fromList(newCounter); // Cria cópia
   }
 
-  /// Increments the counter part of the counter block.
-  /// Throws StateError on overflow.
-  void _counterUpdate() {
-    // Converte o bloco inteiro para BigInt
-    BigInt counterInt = bytesToNumber(_counter);
-
-    // Incrementa
-    counterInt += BigInt.one;
-
-    // Converte de volta para Uint8List de 16 bytes
-    Uint8List newCounterBytes;
-    try {
-      newCounterBytes = numberToByteArray(counterInt, howManyBytes: 16);
-    } catch (e) {
-      // numberToByteArray pode falhar se o número for grande demais para 16 bytes
-      throw StateError("CTR counter overflowed during conversion: $e");
+  /// Throws StateError if [blocks] more keystream blocks would wrap the
+  /// counter part back to zero (and so reuse keystream).
+  void _checkCounterRoom(int blocks) {
+    // Com 7 bytes ou mais de contador o estouro exige 2^56 blocos
+    if (_counterBytesLength == 0 || _counterBytesLength >= 7 || blocks == 0) {
+      return;
     }
-
-    // Verifica o overflow específico da parte do *contador*
-    // (Se a parte do contador atingiu FF..FF e estourou para 00..00,
-    // o que significa que invadiria a parte do nonce no próximo incremento)
-    // O overflow real já aconteceu na conversão BigInt->Bytes se foi > 2^128-1.
-    // O check aqui é mais sobre a *lógica* do CTR: a parte do *contador* não deve estourar
-    // e voltar a zero, pois reutilizaria keystreams.
-    // A maneira mais simples é verificar se os *últimos* _counterBytesLength
-    // bytes do *novo* contador são todos 0, o que indica que houve um carry
-    // que passou pelo último byte do contador.
-
-    bool counterPartIsZero = true;
+    var value = 0;
     for (int i = 16 - _counterBytesLength; i < 16; i++) {
-      if (newCounterBytes[i] != 0) {
-        counterPartIsZero = false;
-        break;
-      }
+      value = (value << 8) | _counter[i];
     }
-
-    // Se a parte do contador virou zero E _counterBytesLength > 0, houve overflow LÓGICO.
-    // (Se _counterBytesLength == 0, o contador nunca muda, então não há overflow).
-    if (_counterBytesLength > 0 && counterPartIsZero) {
-      // Uma verificação mais rigorosa (como a dart) seria ver se os bytes ANTES
-      // da conversão estavam todos 0xFF na parte do contador. Mas checar se
-      // viraram 0 após o incremento cobre o caso de estouro lógico.
-      throw StateError("CTR counter part overflowed (would reuse keystream)");
+    final remaining = (1 << (8 * _counterBytesLength)) - value;
+    // Assim como antes, o contador avança após cada bloco, inclusive o
+    // último, e não pode voltar a zero.
+    if (blocks >= remaining) {
+      throw StateError(
+          "CTR counter overflow during operation: counter part overflowed "
+          "(would reuse keystream)");
     }
-
-    _counter = newCounterBytes; // Atualiza o contador da instância
   }
 
   @override
   Uint8List encrypt(Uint8List plaintext) {
-    final resultBytes = Uint8List(
-        plaintext.lengthInBytes); // Eficiente para construir o keystream
-    //final maskBuilder = BytesBuilder(copy: false);
-
-    int bytesToProcess = plaintext.lengthInBytes;
-    int processedBytes = 0;
-
-    while (processedBytes < bytesToProcess) {
-      // Criptografa o contador atual para obter o próximo bloco de keystream
-      final keystreamBlock = _rijndael.encrypt(_counter);
-
-      // Calcula quantos bytes deste bloco de keystream precisamos
-      final needed = bytesToProcess - processedBytes;
-      final bytesToUse = min(16, needed); // Usa no máximo 16 bytes
-
-      // XOR os bytes do plaintext com os bytes do keystream
-      for (int i = 0; i < bytesToUse; i++) {
-        resultBytes[processedBytes + i] =
-            plaintext[processedBytes + i] ^ keystreamBlock[i];
-      }
-
-      processedBytes += bytesToUse;
-      // Incrementa o contador para o próximo bloco, mesmo que este tenha sido o último.
-      // A implementação dart avança o contador após gerar cada bloco de keystream,
-      // garantindo que chamadas subsequentes continuem do ponto correto.
-      try {
-        _counterUpdate();
-      } on StateError catch (e) {
-        throw StateError("CTR counter overflow during operation: $e");
-      }
-    }
-
+    final resultBytes = Uint8List(plaintext.lengthInBytes);
+    _checkCounterRoom((plaintext.lengthInBytes + 15) ~/ 16);
+    // O contador avança um bloco por bloco de keystream gerado, inclusive
+    // para um bloco final parcial, garantindo que chamadas subsequentes
+    // continuem do ponto correto.
+    // Com nonce de 16 bytes o bloco inteiro é incrementado, como antes.
+    final incrementLength =
+        _counterBytesLength == 0 ? 16 : _counterBytesLength;
+    _engine.ctrXor(_counter, incrementLength, plaintext, resultBytes, 0);
     return resultBytes;
   }
 
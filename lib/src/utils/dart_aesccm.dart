@@ -1,9 +1,12 @@
 import 'dart:typed_data';
+import 'aes_engine.dart';
 import 'aesccm.dart';
-import 'rijndael_slow.dart';
 
 AESCCM newAESCCM(Uint8List key, {int tagLength = 16}) {
   final internalKey = Uint8List.fromList(key);
-  final rijndael = Rijndael(internalKey, blockSize: 16);
-  return AESCCM(internalKey, 'dart', rijndael.encrypt, tagLength: tagLength);
+  if (internalKey.length != 16 && internalKey.length != 32) {
+    throw ArgumentError('AES-CCM key must be 16 or 32 bytes long');
+  }
+  final engine = AesEngine(internalKey);
+  return AESCCM(internalKey, 'dart', engine.encrypt, tagLength: tagLength);
 }
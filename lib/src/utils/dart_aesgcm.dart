@@ -1,8 +1,8 @@
 import 'dart:typed_data';
+import 'aes_engine.dart';
 import 'aesgcm.dart';
-import 'rijndael_slow.dart';
 
 AESGCM newAESGCM(Uint8List key) {
-  final rijndael = Rijndael(Uint8List.fromList(key), blockSize: 16);
-  return AESGCM(Uint8List.fromList(key), 'dart', rijndael.encrypt);
+  return AESGCM.withEngine(
+      Uint8List.fromList(key), 'dart', AesEngine(Uint8List.fromList(key)));
 }
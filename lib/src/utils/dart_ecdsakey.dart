@@ -17,6 +17,7 @@ import 'curve_oids.dart';
 import 'der.dart';
 import 'ecdsakey.dart';
 import 'ecc.dart';
+import 'nist_curves.dart';
 import 'pem.dart';
 import 'pkcs8.dart';
 
@@ -34,9 +35,18 @@ class DartECDSAKey extends ECDSAKey {
       throw ArgumentError(
           'Provide either a private multiplier or public point');
     }
+    var nist = NistCurve.byName(curveName);
     if (secretMultiplier != null) {
       _privateKey = ecc.ECPrivateKey(secretMultiplier, domain);
-      publicPoint = (domain.G * secretMultiplier)!;
+      if (nist != null &&
+          secretMultiplier > BigInt.zero &&
+          secretMultiplier < nist.n) {
+        final (x, y) = nist.mulBase(secretMultiplier);
+        publicPoint = domain.curve.createPoint(x, y);
+      } else {
+        nist = null;
+        publicPoint = (domain.G * secretMultiplier)!;
+      }
     }
     if (pointX != null && pointY != null) {
       publicPoint = domain.curve.createPoint(pointX, pointY);
@@ -46,6 +56,7 @@ class DartECDSAKey extends ECDSAKey {
     }
     _publicPoint = publicPoint;
     _publicKey = ecc.ECPublicKey(_publicPoint, domain);
+    _nist = nist;
   }
 
   final String curveName;
@@ -54,6 +65,10 @@ class DartECDSAKey extends ECDSAKey {
   late final ecc.ECPublicKey _publicKey;
   ecc.ECPrivateKey? _privateKey;
 
+  /// Dedicated P-256/P-384 engine; null for other curves, which go
+  /// through pointycastle.
+  late final NistCurve? _nist;
+
   @override
   int get bitLength => _domain.n.bitLength;
 
@@ -66,6 +81,11 @@ class DartECDSAKey extends ECDSAKey {
     if (privateKey == null) {
       throw StateError('Private key required for signing');
     }
+    final nist = _nist;
+    if (nist != null) {
+      final (r, s) = nist.sign(privateKey.d!, hash, hashAlg);
+      return derEncodeSequence([derEncodeInteger(r), derEncodeInteger(s)]);
+    }
     final digest = _digestFor(hashAlg);
     final signer = ECDSASigner(null, HMac(digest, _blockLength(hashAlg)));
     signer.init(true, pc.PrivateKeyParameter(privateKey));
@@ -79,6 +99,10 @@ class DartECDSAKey extends ECDSAKey {
   @override
   bool verifyDigest(Uint8List signature, Uint8List hashBytes) {
     final (r: r, s: s) = derDecodeSignature(signature);
+    final nist = _nist;
+    if (nist != null) {
+      return nist.verify(publicPointX, publicPointY, hashBytes, r, s);
+    }
     final signer = ECDSASigner();
     signer.init(false, pc.PublicKeyParameter(_publicKey));
     return signer.verifySignature(hashBytes, ecc.ECSignature(r, s));
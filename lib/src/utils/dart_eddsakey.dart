@@ -91,6 +91,38 @@ class DartEdDSAKey extends EdDSAKey {
     }
   }
 
+  /// Verify many (key, message, signature) triples at once.
+  ///
+  /// Runs one multi-scalar multiplication for the whole batch instead of one
+  /// double-scalar multiplication per signature; see [ed.verifyBatch] for
+  /// the exact equation checked.
+  ///
+  /// The result is not identical to calling [hashAndVerify] on each entry.
+  /// The batch equation is the cofactored one, so it may accept signatures
+  /// with small-order components that [hashAndVerify] rejects, and an
+  /// invalid signature slips through with probability about 2^-128. Callers
+  /// whose decision must match [hashAndVerify] exactly, such as certificate
+  /// chain policy, must not use batch mode. A false result does not say
+  /// which entry failed; re-check them one by one when that matters.
+  static bool verifyBatch(
+      List<(DartEdDSAKey key, Uint8List message, Uint8List signature)> items) {
+    for (final (key, _, signature) in items) {
+      key._ensureSupportedCurve();
+      if (signature.length != ed.SignatureSize) {
+        return false;
+      }
+    }
+    try {
+      return ed.verifyBatch(
+        [for (final (key, _, _) in items) key._publicKey],
+        [for (final (_, message, _) in items) message],
+        [for (final (_, _, signature) in items) signature],
+      );
+    } on ArgumentError {
+      return false;
+    }
+  }
+
   void _ensureSupportedCurve() {
     if (_curveName != 'Ed25519') {
       throw UnsupportedError('$_curveName is not supported yet');
@@ -40,6 +40,9 @@ class DartRSAKey extends RSAKey {
     if (_q != BigInt.zero && _qInv == BigInt.zero) {
       _qInv = invMod(_q, _p);
     }
+    if (_p.isOdd && _q.isOdd && _p > BigInt.one && _q > BigInt.one) {
+      _crt = _RsaCrtEngine(this.n, this.e, _p, _q, _dP, _dQ, _qInv);
+    }
   }
 
   BigInt _d;
@@ -50,6 +53,7 @@ class DartRSAKey extends RSAKey {
   BigInt _qInv;
   BigInt _blinder;
   BigInt _unblinder;
+  _RsaCrtEngine? _crt;
 
   @override
   BigInt? get privateExponent => hasPrivateKey() ? _d : null;
@@ -62,6 +66,10 @@ class DartRSAKey extends RSAKey {
     if (!hasPrivateKey()) {
       throw ArgumentError('Private key not available');
     }
+    final crt = _crt;
+    if (crt != null) {
+      return crt.privateKeyOp(message);
+    }
     BigInt result;
     // The math is quick enough that we can skip actual locking; Dart code
     // runs on a single isolate unless explicitly parallelised.
@@ -184,3 +192,99 @@ class DartRSAKey extends RSAKey {
 }
 
 const List<int> _rsaEncryptionOid = [1, 2, 840, 113549, 1, 1, 1];
+
+/// CRT private-key operation of a [DartRSAKey] on Montgomery limbs.
+///
+/// The Montgomery contexts for p, q and n are built once, when the key is
+/// loaded. When the CPU has MULX/ADX and the primes fit the kernel, both
+/// half-size exponentiations run on a [MontgomeryAsmContext] per prime;
+/// otherwise they use the constant-time fixed window of
+/// [MontgomeryContext.powMontgomery]. The blinding pair lives in Montgomery
+/// form modulo n, so applying it and squaring it for the next call are
+/// single Montgomery products.
+class _RsaCrtEngine {
+  _RsaCrtEngine(this._modulus, this._e, this._p, this._q, this._dP, this._dQ,
+      this._qInv)
+      : _nCtx = MontgomeryContext(_modulus),
+        _pNative = _nativeContext(_p),
+        _qNative = _nativeContext(_q) {
+    for (final native in [_pNative, _qNative]) {
+      if (native != null) {
+        _nativeFinalizer.attach(this, native);
+      }
+    }
+  }
+
+  static final Finalizer<MontgomeryAsmContext> _nativeFinalizer =
+      Finalizer((context) => context.dispose());
+
+  final BigInt _modulus;
+  final BigInt _e;
+  final BigInt _p;
+  final BigInt _q;
+  final BigInt _dP;
+  final BigInt _dQ;
+  final BigInt _qInv;
+  final MontgomeryContext _nCtx;
+  final MontgomeryAsmContext? _pNative;
+  final MontgomeryAsmContext? _qNative;
+  late final MontgomeryContext _pCtx = MontgomeryContext(_p);
+  late final MontgomeryContext _qCtx = MontgomeryContext(_q);
+
+  /// r⁻ᵉ·R and r·R modulo n for the current random r.
+  Uint32List? _blinder;
+  Uint32List? _unblinder;
+
+  BigInt privateKeyOp(BigInt message) {
+    final n = _nCtx;
+    var blinder = _blinder;
+    var unblinder = _unblinder;
+    if (blinder == null || unblinder == null) {
+      final r = getRandomNumber(BigInt.two, _modulus);
+      blinder = n.toMontgomery(powMod(invMod(r, _modulus), _e, _modulus));
+      unblinder = n.toMontgomery(r);
+      _blinder = blinder;
+      _unblinder = unblinder;
+    }
+
+    final x = n.fromBigInt(message);
+    n.mul(x, x, blinder);
+    n.mul(blinder, blinder, blinder);
+    final blinded = n.toBigInt(x);
+
+    final s1 = _pNative != null
+        ? _nativeModPow(_pNative, blinded, _dP, _p)
+        : _pCtx.modPow(blinded, _dP, exponentBits: _p.bitLength);
+    final s2 = _qNative != null
+        ? _nativeModPow(_qNative, blinded, _dQ, _q)
+        : _qCtx.modPow(blinded, _dQ, exponentBits: _q.bitLength);
+    final h = ((s1 - s2) * _qInv) % _p;
+
+    final s = n.fromBigInt(s2 + _q * h);
+    n.mul(s, s, unblinder);
+    n.mul(unblinder, unblinder, unblinder);
+    return n.toBigInt(s);
+  }
+
+  /// [base]^[exponent] mod [prime] on the kernel. The exponent is padded to
+  /// the prime's length so the kernel's window schedule does not depend on
+  /// its leading zero bits.
+  static BigInt _nativeModPow(MontgomeryAsmContext native, BigInt base,
+          BigInt exponent, BigInt prime) =>
+      bytesToNumber(native.modPow(numberToByteArray(base),
+          numberToByteArray(exponent, howManyBytes: numBytes(prime))));
+
+  static MontgomeryAsmContext? _nativeContext(BigInt prime) {
+    if (prime.bitLength > 64 * MontgomeryAsmContext.mulxMaxLimbs ||
+        !MontgomeryAsmSupport.isX64Supported ||
+        !MontgomeryAsmSupport.isModernSupported) {
+      return null;
+    }
+    final context = MontgomeryAsmContext.fromModulus(numberToByteArray(prime));
+    if (!context.usesMulxKernel) {
+      context.dispose();
+      return null;
+    }
+    return context;
+  }
+}
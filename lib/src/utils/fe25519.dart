@@ -0,0 +1,539 @@
+/// Field arithmetic in GF(2^255 - 19) on unboxed limbs.
+///
+/// An element is ten signed limbs in radix 2^25.5 (alternately 26 and 25
+/// bits, the ref10 layout) stored in an [Int32List]. Every partial product
+/// fits in a 64-bit `int`, so multiplication runs on plain integers with no
+/// BigInt or `%` in the loop. [feAdd] and [feSub] do not carry; their
+/// output may be fed to [feMul]/[feSquare] but not chained further.
+library;
+
+import 'dart:typed_data';
+
+/// Returns a new element set to zero.
+Int32List feNew() => Int32List(10);
+
+void feZero(Int32List h) {
+  for (var i = 0; i < 10; i++) {
+    h[i] = 0;
+  }
+}
+
+void feOne(Int32List h) {
+  feZero(h);
+  h[0] = 1;
+}
+
+void feCopy(Int32List h, Int32List f) {
+  for (var i = 0; i < 10; i++) {
+    h[i] = f[i];
+  }
+}
+
+void feAdd(Int32List h, Int32List f, Int32List g) {
+  for (var i = 0; i < 10; i++) {
+    h[i] = f[i] + g[i];
+  }
+}
+
+void feSub(Int32List h, Int32List f, Int32List g) {
+  for (var i = 0; i < 10; i++) {
+    h[i] = f[i] - g[i];
+  }
+}
+
+/// Swaps [f] and [g] when [b] is 1, leaves them when [b] is 0, without
+/// branching on [b].
+void feCSwap(Int32List f, Int32List g, int b) {
+  final mask = -b;
+  for (var i = 0; i < 10; i++) {
+    final x = mask & (f[i] ^ g[i]);
+    f[i] ^= x;
+    g[i] ^= x;
+  }
+}
+
+/// Replaces [f] with [g] when [b] is 1, without branching on [b].
+void feCMove(Int32List f, Int32List g, int b) {
+  final mask = -b;
+  for (var i = 0; i < 10; i++) {
+    f[i] ^= mask & (f[i] ^ g[i]);
+  }
+}
+
+/// Loads 32 little-endian bytes, ignoring the top bit.
+void feFromBytes(Int32List h, List<int> s) {
+  var bit = 0;
+  for (var i = 0; i < 10; i++) {
+    final width = (i & 1) == 0 ? 26 : 25;
+    final byte = bit >> 3;
+    var window = 0;
+    for (var j = 4; j >= 0; j--) {
+      window = (window << 8) | (byte + j < 32 ? s[byte + j] : 0);
+    }
+    h[i] = (window >> (bit & 7)) & ((1 << width) - 1);
+    bit += width;
+  }
+}
+
+/// Stores the canonical (fully reduced) value of [f] as 32 little-endian
+/// bytes.
+void feToBytes(Uint8List s, Int32List f) {
+  var h0 = f[0], h1 = f[1], h2 = f[2], h3 = f[3], h4 = f[4];
+  var h5 = f[5], h6 = f[6], h7 = f[7], h8 = f[8], h9 = f[9];
+  // q = floor(h / p), computed from the top limb down
+  var q = (19 * h9 + (1 << 24)) >> 25;
+  q = (h0 + q) >> 26;
+  q = (h1 + q) >> 25;
+  q = (h2 + q) >> 26;
+  q = (h3 + q) >> 25;
+  q = (h4 + q) >> 26;
+  q = (h5 + q) >> 25;
+  q = (h6 + q) >> 26;
+  q = (h7 + q) >> 25;
+  q = (h8 + q) >> 26;
+  q = (h9 + q) >> 25;
+  h0 += 19 * q;
+  var c = h0 >> 26;
+  h1 += c;
+  h0 -= c << 26;
+  c = h1 >> 25;
+  h2 += c;
+  h1 -= c << 25;
+  c = h2 >> 26;
+  h3 += c;
+  h2 -= c << 26;
+  c = h3 >> 25;
+  h4 += c;
+  h3 -= c << 25;
+  c = h4 >> 26;
+  h5 += c;
+  h4 -= c << 26;
+  c = h5 >> 25;
+  h6 += c;
+  h5 -= c << 25;
+  c = h6 >> 26;
+  h7 += c;
+  h6 -= c << 26;
+  c = h7 >> 25;
+  h8 += c;
+  h7 -= c << 25;
+  c = h8 >> 26;
+  h9 += c;
+  h8 -= c << 26;
+  c = h9 >> 25;
+  h9 -= c << 25;
+
+  s[0] = h0;
+  s[1] = h0 >> 8;
+  s[2] = h0 >> 16;
+  s[3] = (h0 >> 24) | (h1 << 2);
+  s[4] = h1 >> 6;
+  s[5] = h1 >> 14;
+  s[6] = (h1 >> 22) | (h2 << 3);
+  s[7] = h2 >> 5;
+  s[8] = h2 >> 13;
+  s[9] = (h2 >> 21) | (h3 << 5);
+  s[10] = h3 >> 3;
+  s[11] = h3 >> 11;
+  s[12] = (h3 >> 19) | (h4 << 6);
+  s[13] = h4 >> 2;
+  s[14] = h4 >> 10;
+  s[15] = h4 >> 18;
+  s[16] = h5;
+  s[17] = h5 >> 8;
+  s[18] = h5 >> 16;
+  s[19] = (h5 >> 24) | (h6 << 1);
+  s[20] = h6 >> 7;
+  s[21] = h6 >> 15;
+  s[22] = (h6 >> 23) | (h7 << 3);
+  s[23] = h7 >> 5;
+  s[24] = h7 >> 13;
+  s[25] = (h7 >> 21) | (h8 << 4);
+  s[26] = h8 >> 4;
+  s[27] = h8 >> 12;
+  s[28] = (h8 >> 20) | (h9 << 6);
+  s[29] = h9 >> 2;
+  s[30] = h9 >> 10;
+  s[31] = h9 >> 18;
+}
+
+/// Returns 1 if [f] is negative (its canonical value is odd), else 0.
+int feIsNegative(Int32List f) {
+  final s = Uint8List(32);
+  feToBytes(s, f);
+  return s[0] & 1;
+}
+
+/// Returns 1 if [f] is zero modulo p, else 0, in constant time.
+int feIsZero(Int32List f) {
+  final s = Uint8List(32);
+  feToBytes(s, f);
+  var acc = 0;
+  for (var i = 0; i < 32; i++) {
+    acc |= s[i];
+  }
+  return ((acc - 1) >> 8) & 1;
+}
+
+void feNeg(Int32List h, Int32List f) {
+  for (var i = 0; i < 10; i++) {
+    h[i] = -f[i];
+  }
+}
+
+void feMul(Int32List h, Int32List f, Int32List g) {
+  final f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+  final f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+  final g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+  final g5 = g[5], g6 = g[6], g7 = g[7], g8 = g[8], g9 = g[9];
+  final g1x19 = 19 * g1, g2x19 = 19 * g2, g3x19 = 19 * g3;
+  final g4x19 = 19 * g4, g5x19 = 19 * g5, g6x19 = 19 * g6;
+  final g7x19 = 19 * g7, g8x19 = 19 * g8, g9x19 = 19 * g9;
+  final f1x2 = 2 * f1, f3x2 = 2 * f3, f5x2 = 2 * f5;
+  final f7x2 = 2 * f7, f9x2 = 2 * f9;
+  var h0 = f0 * g0 + f1x2 * g9x19 + f2 * g8x19 + f3x2 * g7x19 + f4 * g6x19 +
+      f5x2 * g5x19 + f6 * g4x19 + f7x2 * g3x19 + f8 * g2x19 + f9x2 * g1x19;
+  var h1 = f0 * g1 + f1 * g0 + f2 * g9x19 + f3 * g8x19 + f4 * g7x19 +
+      f5 * g6x19 + f6 * g5x19 + f7 * g4x19 + f8 * g3x19 + f9 * g2x19;
+  var h2 = f0 * g2 + f1x2 * g1 + f2 * g0 + f3x2 * g9x19 + f4 * g8x19 +
+      f5x2 * g7x19 + f6 * g6x19 + f7x2 * g5x19 + f8 * g4x19 + f9x2 * g3x19;
+  var h3 = f0 * g3 + f1 * g2 + f2 * g1 + f3 * g0 + f4 * g9x19 + f5 * g8x19 +
+      f6 * g7x19 + f7 * g6x19 + f8 * g5x19 + f9 * g4x19;
+  var h4 = f0 * g4 + f1x2 * g3 + f2 * g2 + f3x2 * g1 + f4 * g0 + f5x2 * g9x19 +
+      f6 * g8x19 + f7x2 * g7x19 + f8 * g6x19 + f9x2 * g5x19;
+  var h5 = f0 * g5 + f1 * g4 + f2 * g3 + f3 * g2 + f4 * g1 + f5 * g0 +
+      f6 * g9x19 + f7 * g8x19 + f8 * g7x19 + f9 * g6x19;
+  var h6 = f0 * g6 + f1x2 * g5 + f2 * g4 + f3x2 * g3 + f4 * g2 + f5x2 * g1 +
+      f6 * g0 + f7x2 * g9x19 + f8 * g8x19 + f9x2 * g7x19;
+  var h7 = f0 * g7 + f1 * g6 + f2 * g5 + f3 * g4 + f4 * g3 + f5 * g2 + f6 * g1 +
+      f7 * g0 + f8 * g9x19 + f9 * g8x19;
+  var h8 = f0 * g8 + f1x2 * g7 + f2 * g6 + f3x2 * g5 + f4 * g4 + f5x2 * g3 +
+      f6 * g2 + f7x2 * g1 + f8 * g0 + f9x2 * g9x19;
+  var h9 = f0 * g9 + f1 * g8 + f2 * g7 + f3 * g6 + f4 * g5 + f5 * g4 + f6 * g3 +
+      f7 * g2 + f8 * g1 + f9 * g0;
+  var c = (h0 + (1 << 25)) >> 26;
+  h1 += c;
+  h0 -= c << 26;
+  c = (h4 + (1 << 25)) >> 26;
+  h5 += c;
+  h4 -= c << 26;
+  c = (h1 + (1 << 24)) >> 25;
+  h2 += c;
+  h1 -= c << 25;
+  c = (h5 + (1 << 24)) >> 25;
+  h6 += c;
+  h5 -= c << 25;
+  c = (h2 + (1 << 25)) >> 26;
+  h3 += c;
+  h2 -= c << 26;
+  c = (h6 + (1 << 25)) >> 26;
+  h7 += c;
+  h6 -= c << 26;
+  c = (h3 + (1 << 24)) >> 25;
+  h4 += c;
+  h3 -= c << 25;
+  c = (h7 + (1 << 24)) >> 25;
+  h8 += c;
+  h7 -= c << 25;
+  c = (h4 + (1 << 25)) >> 26;
+  h5 += c;
+  h4 -= c << 26;
+  c = (h8 + (1 << 25)) >> 26;
+  h9 += c;
+  h8 -= c << 26;
+  c = (h9 + (1 << 24)) >> 25;
+  h0 += c * 19;
+  h9 -= c << 25;
+  c = (h0 + (1 << 25)) >> 26;
+  h1 += c;
+  h0 -= c << 26;
+  h[0] = h0;
+  h[1] = h1;
+  h[2] = h2;
+  h[3] = h3;
+  h[4] = h4;
+  h[5] = h5;
+  h[6] = h6;
+  h[7] = h7;
+  h[8] = h8;
+  h[9] = h9;
+}
+
+void feSquare(Int32List h, Int32List f) {
+  final f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+  final f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+  final f0x2 = 2 * f0, f1x2 = 2 * f1, f2x2 = 2 * f2, f3x2 = 2 * f3;
+  final f4x2 = 2 * f4, f5x2 = 2 * f5, f6x2 = 2 * f6, f7x2 = 2 * f7;
+  final f5x38 = 38 * f5, f6x19 = 19 * f6, f7x38 = 38 * f7;
+  final f8x19 = 19 * f8, f9x38 = 38 * f9;
+  var h0 = f0 * f0 + f1x2 * f9x38 + f2x2 * f8x19 + f3x2 * f7x38 + f4x2 * f6x19 +
+      f5 * f5x38;
+  var h1 = f0x2 * f1 + f2 * f9x38 + f3x2 * f8x19 + f4 * f7x38 + f5x2 * f6x19;
+  var h2 = f0x2 * f2 + f1x2 * f1 + f3x2 * f9x38 + f4x2 * f8x19 + f5x2 * f7x38 +
+      f6 * f6x19;
+  var h3 = f0x2 * f3 + f1x2 * f2 + f4 * f9x38 + f5x2 * f8x19 + f6 * f7x38;
+  var h4 = f0x2 * f4 + f1x2 * f3x2 + f2 * f2 + f5x2 * f9x38 + f6x2 * f8x19 +
+      f7 * f7x38;
+  var h5 = f0x2 * f5 + f1x2 * f4 + f2x2 * f3 + f6 * f9x38 + f7x2 * f8x19;
+  var h6 = f0x2 * f6 + f1x2 * f5x2 + f2x2 * f4 + f3x2 * f3 + f7x2 * f9x38 +
+      f8 * f8x19;
+  var h7 = f0x2 * f7 + f1x2 * f6 + f2x2 * f5 + f3x2 * f4 + f8 * f9x38;
+  var h8 = f0x2 * f8 + f1x2 * f7x2 + f2x2 * f6 + f3x2 * f5x2 + f4 * f4 +
+      f9 * f9x38;
+  var h9 = f0x2 * f9 + f1x2 * f8 + f2x2 * f7 + f3x2 * f6 + f4x2 * f5;
+  var c = (h0 + (1 << 25)) >> 26;
+  h1 += c;
+  h0 -= c << 26;
+  c = (h4 + (1 << 25)) >> 26;
+  h5 += c;
+  h4 -= c << 26;
+  c = (h1 + (1 << 24)) >> 25;
+  h2 += c;
+  h1 -= c << 25;
+  c = (h5 + (1 << 24)) >> 25;
+  h6 += c;
+  h5 -= c << 25;
+  c = (h2 + (1 << 25)) >> 26;
+  h3 += c;
+  h2 -= c << 26;
+  c = (h6 + (1 << 25)) >> 26;
+  h7 += c;
+  h6 -= c << 26;
+  c = (h3 + (1 << 24)) >> 25;
+  h4 += c;
+  h3 -= c << 25;
+  c = (h7 + (1 << 24)) >> 25;
+  h8 += c;
+  h7 -= c << 25;
+  c = (h4 + (1 << 25)) >> 26;
+  h5 += c;
+  h4 -= c << 26;
+  c = (h8 + (1 << 25)) >> 26;
+  h9 += c;
+  h8 -= c << 26;
+  c = (h9 + (1 << 24)) >> 25;
+  h0 += c * 19;
+  h9 -= c << 25;
+  c = (h0 + (1 << 25)) >> 26;
+  h1 += c;
+  h0 -= c << 26;
+  h[0] = h0;
+  h[1] = h1;
+  h[2] = h2;
+  h[3] = h3;
+  h[4] = h4;
+  h[5] = h5;
+  h[6] = h6;
+  h[7] = h7;
+  h[8] = h8;
+  h[9] = h9;
+}
+
+/// h = 2 * [f]^2, doubling before the carry chain as ref10 does.
+void feSquare2(Int32List h, Int32List f) {
+  final f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+  final f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+  final f0x2 = 2 * f0, f1x2 = 2 * f1, f2x2 = 2 * f2, f3x2 = 2 * f3;
+  final f4x2 = 2 * f4, f5x2 = 2 * f5, f6x2 = 2 * f6, f7x2 = 2 * f7;
+  final f5x38 = 38 * f5, f6x19 = 19 * f6, f7x38 = 38 * f7;
+  final f8x19 = 19 * f8, f9x38 = 38 * f9;
+  var h0 = f0 * f0 + f1x2 * f9x38 + f2x2 * f8x19 + f3x2 * f7x38 + f4x2 * f6x19 +
+      f5 * f5x38;
+  var h1 = f0x2 * f1 + f2 * f9x38 + f3x2 * f8x19 + f4 * f7x38 + f5x2 * f6x19;
+  var h2 = f0x2 * f2 + f1x2 * f1 + f3x2 * f9x38 + f4x2 * f8x19 + f5x2 * f7x38 +
+      f6 * f6x19;
+  var h3 = f0x2 * f3 + f1x2 * f2 + f4 * f9x38 + f5x2 * f8x19 + f6 * f7x38;
+  var h4 = f0x2 * f4 + f1x2 * f3x2 + f2 * f2 + f5x2 * f9x38 + f6x2 * f8x19 +
+      f7 * f7x38;
+  var h5 = f0x2 * f5 + f1x2 * f4 + f2x2 * f3 + f6 * f9x38 + f7x2 * f8x19;
+  var h6 = f0x2 * f6 + f1x2 * f5x2 + f2x2 * f4 + f3x2 * f3 + f7x2 * f9x38 +
+      f8 * f8x19;
+  var h7 = f0x2 * f7 + f1x2 * f6 + f2x2 * f5 + f3x2 * f4 + f8 * f9x38;
+  var h8 = f0x2 * f8 + f1x2 * f7x2 + f2x2 * f6 + f3x2 * f5x2 + f4 * f4 +
+      f9 * f9x38;
+  var h9 = f0x2 * f9 + f1x2 * f8 + f2x2 * f7 + f3x2 * f6 + f4x2 * f5;
+  h0 += h0;
+  h1 += h1;
+  h2 += h2;
+  h3 += h3;
+  h4 += h4;
+  h5 += h5;
+  h6 += h6;
+  h7 += h7;
+  h8 += h8;
+  h9 += h9;
+  var c = (h0 + (1 << 25)) >> 26;
+  h1 += c;
+  h0 -= c << 26;
+  c = (h4 + (1 << 25)) >> 26;
+  h5 += c;
+  h4 -= c << 26;
+  c = (h1 + (1 << 24)) >> 25;
+  h2 += c;
+  h1 -= c << 25;
+  c = (h5 + (1 << 24)) >> 25;
+  h6 += c;
+  h5 -= c << 25;
+  c = (h2 + (1 << 25)) >> 26;
+  h3 += c;
+  h2 -= c << 26;
+  c = (h6 + (1 << 25)) >> 26;
+  h7 += c;
+  h6 -= c << 26;
+  c = (h3 + (1 << 24)) >> 25;
+  h4 += c;
+  h3 -= c << 25;
+  c = (h7 + (1 << 24)) >> 25;
+  h8 += c;
+  h7 -= c << 25;
+  c = (h4 + (1 << 25)) >> 26;
+  h5 += c;
+  h4 -= c << 26;
+  c = (h8 + (1 << 25)) >> 26;
+  h9 += c;
+  h8 -= c << 26;
+  c = (h9 + (1 << 24)) >> 25;
+  h0 += c * 19;
+  h9 -= c << 25;
+  c = (h0 + (1 << 25)) >> 26;
+  h1 += c;
+  h0 -= c << 26;
+  h[0] = h0;
+  h[1] = h1;
+  h[2] = h2;
+  h[3] = h3;
+  h[4] = h4;
+  h[5] = h5;
+  h[6] = h6;
+  h[7] = h7;
+  h[8] = h8;
+  h[9] = h9;
+}
+
+/// h = f * [n] for a small constant (below 2^17), such as 121666.
+void feMulSmall(Int32List h, Int32List f, int n) {
+  var h0 = f[0] * n;
+  var h1 = f[1] * n;
+  var h2 = f[2] * n;
+  var h3 = f[3] * n;
+  var h4 = f[4] * n;
+  var h5 = f[5] * n;
+  var h6 = f[6] * n;
+  var h7 = f[7] * n;
+  var h8 = f[8] * n;
+  var h9 = f[9] * n;
+  var c = (h0 + (1 << 25)) >> 26;
+  h1 += c;
+  h0 -= c << 26;
+  c = (h4 + (1 << 25)) >> 26;
+  h5 += c;
+  h4 -= c << 26;
+  c = (h1 + (1 << 24)) >> 25;
+  h2 += c;
+  h1 -= c << 25;
+  c = (h5 + (1 << 24)) >> 25;
+  h6 += c;
+  h5 -= c << 25;
+  c = (h2 + (1 << 25)) >> 26;
+  h3 += c;
+  h2 -= c << 26;
+  c = (h6 + (1 << 25)) >> 26;
+  h7 += c;
+  h6 -= c << 26;
+  c = (h3 + (1 << 24)) >> 25;
+  h4 += c;
+  h3 -= c << 25;
+  c = (h7 + (1 << 24)) >> 25;
+  h8 += c;
+  h7 -= c << 25;
+  c = (h4 + (1 << 25)) >> 26;
+  h5 += c;
+  h4 -= c << 26;
+  c = (h8 + (1 << 25)) >> 26;
+  h9 += c;
+  h8 -= c << 26;
+  c = (h9 + (1 << 24)) >> 25;
+  h0 += c * 19;
+  h9 -= c << 25;
+  c = (h0 + (1 << 25)) >> 26;
+  h1 += c;
+  h0 -= c << 26;
+  h[0] = h0;
+  h[1] = h1;
+  h[2] = h2;
+  h[3] = h3;
+  h[4] = h4;
+  h[5] = h5;
+  h[6] = h6;
+  h[7] = h7;
+  h[8] = h8;
+  h[9] = h9;
+}
+
+/// Squares [f] [n] times into [h].
+void feSquareTimes(Int32List h, Int32List f, int n) {
+  feSquare(h, f);
+  for (var i = 1; i < n; i++) {
+    feSquare(h, h);
+  }
+}
+
+/// [out] = [z]^(2^255 - 21) = 1/[z], via the ref10 addition chain.
+void feInvert(Int32List out, Int32List z) {
+  final t0 = Int32List(10);
+  final t1 = Int32List(10);
+  final t2 = Int32List(10);
+  final t3 = Int32List(10);
+  feSquare(t0, z); // 2
+  feSquareTimes(t1, t0, 2); // 8
+  feMul(t1, z, t1); // 9
+  feMul(t0, t0, t1); // 11
+  feSquare(t2, t0); // 22
+  feMul(t1, t1, t2); // 2^5 - 1
+  feSquareTimes(t2, t1, 5);
+  feMul(t1, t2, t1); // 2^10 - 1
+  feSquareTimes(t2, t1, 10);
+  feMul(t2, t2, t1); // 2^20 - 1
+  feSquareTimes(t3, t2, 20);
+  feMul(t2, t3, t2); // 2^40 - 1
+  feSquareTimes(t2, t2, 10);
+  feMul(t1, t2, t1); // 2^50 - 1
+  feSquareTimes(t2, t1, 50);
+  feMul(t2, t2, t1); // 2^100 - 1
+  feSquareTimes(t3, t2, 100);
+  feMul(t2, t3, t2); // 2^200 - 1
+  feSquareTimes(t2, t2, 50);
+  feMul(t1, t2, t1); // 2^250 - 1
+  feSquareTimes(t1, t1, 5); // 2^255 - 2^5
+  feMul(out, t1, t0); // 2^255 - 21
+}
+
+/// [out] = [z]^((p - 5) / 8) = [z]^(2^252 - 3), used for square roots when
+/// decoding points.
+void fePow22523(Int32List out, Int32List z) {
+  final t0 = Int32List(10);
+  final t1 = Int32List(10);
+  final t2 = Int32List(10);
+  feSquare(t0, z); // 2
+  feSquareTimes(t1, t0, 2); // 8
+  feMul(t1, z, t1); // 9
+  feMul(t0, t0, t1); // 11
+  feSquare(t0, t0); // 22
+  feMul(t0, t1, t0); // 2^5 - 1
+  feSquareTimes(t1, t0, 5);
+  feMul(t0, t1, t0); // 2^10 - 1
+  feSquareTimes(t1, t0, 10);
+  feMul(t1, t1, t0); // 2^20 - 1
+  feSquareTimes(t2, t1, 20);
+  feMul(t1, t2, t1); // 2^40 - 1
+  feSquareTimes(t1, t1, 10);
+  feMul(t0, t1, t0); // 2^50 - 1
+  feSquareTimes(t1, t0, 50);
+  feMul(t1, t1, t0); // 2^100 - 1
+  feSquareTimes(t2, t1, 100);
+  feMul(t1, t2, t1); // 2^200 - 1
+  feSquareTimes(t1, t1, 50);
+  feMul(t0, t1, t0); // 2^250 - 1
+  feSquareTimes(t0, t0, 2); // 2^252 - 4
+  feMul(out, t0, z); // 2^252 - 3
+}
@@ -0,0 +1,125 @@
+import 'dart:typed_data';
+
+/// GHASH, the GCM authenticator, on native 64-bit integers.
+///
+/// Uses Shoup's 4-bit tables: sixteen multiples of the hash key H are
+/// precomputed per key, and each 16-byte block then costs 32 table lookups,
+/// shifts and XORs on two 64-bit halves, with no BigInt and no allocation.
+/// Field elements are kept in GCM's bit-reflected order as two big-endian
+/// words; the high word holds bytes 0..7 of the block.
+///
+/// This is the portable path; hosts with PCLMULQDQ use the native kernel in
+/// `lib/src/experimental/aesgcm_asm_x86_64.dart` instead.
+class Ghash {
+  /// Precomputes the multiples of [h] (`AES_K(0^128)`, 16 bytes).
+  Ghash(Uint8List h) {
+    if (h.length != 16) {
+      throw ArgumentError('GHASH key must be 16 bytes long');
+    }
+    final hView = ByteData.sublistView(h);
+    var vh = hView.getUint64(0);
+    var vl = hView.getUint64(8);
+    _tableHigh[8] = vh;
+    _tableLow[8] = vl;
+    // H·x, H·x^2, H·x^3 land in the entries for nibbles 4, 2 and 1.
+    for (var i = 4; i > 0; i >>= 1) {
+      final reduce = -(vl & 1) & _reductionMask;
+      vl = (vh << 63) | (vl >>> 1);
+      vh = (vh >>> 1) ^ reduce;
+      _tableHigh[i] = vh;
+      _tableLow[i] = vl;
+    }
+    for (var i = 2; i <= 8; i <<= 1) {
+      for (var j = 1; j < i; j++) {
+        _tableHigh[i + j] = _tableHigh[i] ^ _tableHigh[j];
+        _tableLow[i + j] = _tableLow[i] ^ _tableLow[j];
+      }
+    }
+  }
+
+  /// `0xe1 << 56`: the reduction polynomial in bit-reflected order.
+  static final int _reductionMask = 0xe1 << 56;
+
+  /// Reduction of the four bits shifted out of the low word, pre-shifted
+  /// into the top of the high word.
+  static final Int64List _remainders = Int64List.fromList(const [
+    0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0, 0x48c0, 0x54e0, //
+    0xe100, 0xfd20, 0xd940, 0xc560, 0x9180, 0x8da0, 0xa9c0, 0xb5e0,
+  ].map((r) => r << 48).toList());
+
+  final Int64List _tableHigh = Int64List(16);
+  final Int64List _tableLow = Int64List(16);
+  final Uint8List _partial = Uint8List(16);
+  int _xh = 0;
+  int _xl = 0;
+
+  /// Clears the accumulator; the key tables are kept.
+  void reset() {
+    _xh = 0;
+    _xl = 0;
+  }
+
+  /// Absorbs [data], zero-padded to a multiple of 16 bytes as GCM does for
+  /// the additional data and the ciphertext.
+  void update(Uint8List data) {
+    final view = ByteData.sublistView(data);
+    final fullLength = data.length & ~15;
+    for (var offset = 0; offset < fullLength; offset += 16) {
+      _xh ^= view.getUint64(offset);
+      _xl ^= view.getUint64(offset + 8);
+      _multiplyH();
+    }
+    final extra = data.length - fullLength;
+    if (extra != 0) {
+      final block = _partial;
+      block.fillRange(0, 16, 0);
+      block.setRange(0, extra, data, fullLength);
+      final blockView = ByteData.sublistView(block);
+      _xh ^= blockView.getUint64(0);
+      _xl ^= blockView.getUint64(8);
+      _multiplyH();
+    }
+  }
+
+  /// Absorbs the length block and returns the 16-byte GHASH value.
+  Uint8List finalize(int aadLength, int ciphertextLength) {
+    _xh ^= aadLength * 8;
+    _xl ^= ciphertextLength * 8;
+    _multiplyH();
+    final out = Uint8List(16);
+    ByteData.sublistView(out)
+      ..setUint64(0, _xh)
+      ..setUint64(8, _xl);
+    return out;
+  }
+
+  /// Accumulator = accumulator · H, one nibble at a time from the least
+  /// significant end.
+  void _multiplyH() {
+    final high = _tableHigh;
+    final low = _tableLow;
+    final remainders = _remainders;
+    var zh = 0;
+    var zl = 0;
+    var word = _xl;
+    for (var shift = 0; shift < 64; shift += 4) {
+      final rem = zl & 0xf;
+      zl = (zh << 60) | (zl >>> 4);
+      zh = (zh >>> 4) ^ remainders[rem];
+      final nibble = (word >>> shift) & 0xf;
+      zh ^= high[nibble];
+      zl ^= low[nibble];
+    }
+    word = _xh;
+    for (var shift = 0; shift < 64; shift += 4) {
+      final rem = zl & 0xf;
+      zl = (zh << 60) | (zl >>> 4);
+      zh = (zh >>> 4) ^ remainders[rem];
+      final nibble = (word >>> shift) & 0xf;
+      zh ^= high[nibble];
+      zl ^= low[nibble];
+    }
+    _xh = zh;
+    _xl = zl;
+  }
+}
@@ -0,0 +1,353 @@
+import 'dart:typed_data';
+
+/// Montgomery arithmetic modulo a fixed odd modulus, on machine-word limbs.
+///
+/// Numbers are little-endian arrays of 30-bit digits. With 30-bit digits a
+/// digit product is below 2^60 and the multiply-accumulate of one CIOS
+/// step stays below 2^62, so the whole reduction runs on plain Dart ints
+/// without BigInt allocations or 64-bit overflow.
+///
+/// The context precomputes R² mod n and -n⁻¹ mod 2^30 (R = 2^(30·limbs)),
+/// so it is meant to be built once per modulus and reused; it owns scratch
+/// space and is therefore not safe to share between concurrent callers.
+class MontgomeryContext {
+  MontgomeryContext._(this.modulus, this.limbCount, this._n, this._n0inv)
+      : _t = Uint32List(limbCount + 1),
+        _rr = Uint32List(limbCount),
+        _one = Uint32List(limbCount),
+        _unit = Uint32List(limbCount)..[0] = 1;
+
+  /// Creates the context for the odd [modulus] (greater than one).
+  factory MontgomeryContext(BigInt modulus) {
+    if (modulus <= BigInt.one || !modulus.isOdd) {
+      throw ArgumentError.value(
+          modulus, 'modulus', 'must be an odd number greater than one');
+    }
+    final limbCount = (modulus.bitLength + limbBits - 1) ~/ limbBits;
+    final n = _toLimbs(modulus, limbCount);
+    // Newton iteration for n0⁻¹ mod 2^30; n0 is its own inverse mod 8 and
+    // each step doubles the number of correct low bits.
+    final n0 = n[0];
+    var inverse = n0;
+    for (var i = 0; i < 4; i++) {
+      inverse = (inverse * (2 - ((n0 * inverse) & _mask))) & _mask;
+    }
+    final ctx =
+        MontgomeryContext._(modulus, limbCount, n, (-inverse) & _mask);
+    ctx._rr.setAll(
+        0,
+        _toLimbs((BigInt.one << (2 * limbBits * limbCount)) % modulus,
+            limbCount));
+    ctx.mul(ctx._one, ctx._unit, ctx._rr);
+    return ctx;
+  }
+
+  /// Bits per limb.
+  static const int limbBits = 30;
+  static const int _mask = (1 << limbBits) - 1;
+
+  final BigInt modulus;
+
+  /// Number of limbs in every element of this context.
+  final int limbCount;
+
+  final Uint32List _n;
+  final int _n0inv;
+  final Uint32List _t;
+  final Uint32List _rr;
+
+  /// R mod n, i.e. one in Montgomery form.
+  final Uint32List _one;
+
+  /// The plain integer one.
+  final Uint32List _unit;
+
+  /// Converts [x] to limbs, reducing it modulo [modulus] first if needed.
+  Uint32List fromBigInt(BigInt x) {
+    if (x.isNegative || x >= modulus) {
+      x %= modulus;
+    }
+    return _toLimbs(x, limbCount);
+  }
+
+  /// Converts limbs back to a BigInt.
+  BigInt toBigInt(Uint32List a) {
+    var result = BigInt.zero;
+    for (var i = a.length - 1; i >= 0; i--) {
+      result = (result << limbBits) | BigInt.from(a[i]);
+    }
+    return result;
+  }
+
+  /// Returns x·R mod n.
+  Uint32List toMontgomery(BigInt x) {
+    final a = fromBigInt(x);
+    mul(a, a, _rr);
+    return a;
+  }
+
+  /// Returns a·R⁻¹ mod n as a BigInt.
+  BigInt fromMontgomery(Uint32List a) {
+    final out = Uint32List(limbCount);
+    mul(out, a, _unit);
+    return toBigInt(out);
+  }
+
+  /// Montgomery product: [out] = a·b·R⁻¹ mod n, fully reduced.
+  ///
+  /// [a] and [b] must be reduced; [out] may alias either of them. The
+  /// instruction sequence does not depend on the values.
+  void mul(Uint32List out, Uint32List a, Uint32List b) {
+    final n = _n;
+    final t = _t;
+    final len = limbCount;
+    final n0inv = _n0inv;
+    for (var j = 0; j <= len; j++) {
+      t[j] = 0;
+    }
+    for (var i = 0; i < len; i++) {
+      final ai = a[i];
+      var c = t[0] + ai * b[0];
+      final m = ((c & _mask) * n0inv) & _mask;
+      c = (c + m * n[0]) >> limbBits;
+      for (var j = 1; j < len; j++) {
+        c += t[j] + ai * b[j] + m * n[j];
+        t[j - 1] = c & _mask;
+        c >>= limbBits;
+      }
+      c += t[len];
+      t[len - 1] = c & _mask;
+      t[len] = c >> limbBits;
+    }
+    _reduceOnce(out);
+  }
+
+  /// [out] = a + b mod n for reduced [a] and [b]; [out] may alias either.
+  void add(Uint32List out, Uint32List a, Uint32List b) {
+    final t = _t;
+    final len = limbCount;
+    var c = 0;
+    for (var j = 0; j < len; j++) {
+      c += a[j] + b[j];
+      t[j] = c & _mask;
+      c >>= limbBits;
+    }
+    t[len] = c;
+    _reduceOnce(out);
+  }
+
+  /// [out] = a - b mod n for reduced [a] and [b]; [out] may alias either.
+  void sub(Uint32List out, Uint32List a, Uint32List b) {
+    final n = _n;
+    final len = limbCount;
+    var borrow = 0;
+    for (var j = 0; j < len; j++) {
+      final d = a[j] - b[j] - borrow;
+      out[j] = d & _mask;
+      borrow = (d >> 63) & 1;
+    }
+    // Add n back when the difference went negative.
+    final mask = -borrow;
+    var c = 0;
+    for (var j = 0; j < len; j++) {
+      c += out[j] + (n[j] & mask);
+      out[j] = c & _mask;
+      c >>= limbBits;
+    }
+  }
+
+  /// One in Montgomery form, as a fresh array.
+  Uint32List one() => Uint32List.fromList(_one);
+
+  /// Montgomery-form inverse of the Montgomery-form [a], by Fermat's little
+  /// theorem; only meaningful for a prime modulus. Zero maps to zero.
+  Uint32List inverse(Uint32List a) => powMontgomery(a, modulus - BigInt.two,
+      exponentBits: modulus.bitLength);
+
+  /// Writes t mod n to [out], given t < 2n in [_t] (limbCount + 1 limbs).
+  void _reduceOnce(Uint32List out) {
+    final n = _n;
+    final t = _t;
+    final len = limbCount;
+    // t < 2n: subtract n once and keep whichever result is in range.
+    var borrow = 0;
+    for (var j = 0; j < len; j++) {
+      final d = t[j] - n[j] - borrow;
+      out[j] = d & _mask;
+      borrow = (d >> 63) & 1;
+    }
+    final keep = (t[len] - borrow) >> 63;
+    for (var j = 0; j < len; j++) {
+      out[j] = (out[j] & ~keep) | (t[j] & keep);
+    }
+  }
+
+  /// Raises the Montgomery-form [base] to [exponent] and returns the
+  /// result in Montgomery form.
+  ///
+  /// Uses a fixed window: every window costs the same squarings and one
+  /// multiplication, and the table entry is read by scanning the whole
+  /// table with masks, so neither the schedule nor the memory access
+  /// pattern depends on the exponent bits. Only the length of the loop is
+  /// public: it is the larger of [exponent]'s bit length and
+  /// [exponentBits], so secret exponents should pass the bit length of
+  /// their upper bound.
+  Uint32List powMontgomery(Uint32List base, BigInt exponent,
+      {int exponentBits = 0}) {
+    if (exponent.isNegative) {
+      throw ArgumentError.value(exponent, 'exponent', 'must not be negative');
+    }
+    final len = limbCount;
+    final bits = exponent.bitLength > exponentBits
+        ? exponent.bitLength
+        : exponentBits;
+    final acc = Uint32List.fromList(_one);
+    if (bits == 0) {
+      return acc;
+    }
+    final window = _windowFor(bits);
+    final size = 1 << window;
+    final table = Uint32List(size * len)
+      ..setRange(0, len, _one)
+      ..setRange(len, 2 * len, base);
+    for (var k = 2; k < size; k++) {
+      mul(Uint32List.sublistView(table, k * len, (k + 1) * len),
+          Uint32List.sublistView(table, (k - 1) * len, k * len), base);
+    }
+
+    final digits = _toLimbs(exponent, (bits + limbBits - 1) ~/ limbBits + 1);
+    final entry = Uint32List(len);
+    final windows = (bits + window - 1) ~/ window;
+    _select(acc, table, _windowAt(digits, (windows - 1) * window, window));
+    for (var w = windows - 2; w >= 0; w--) {
+      for (var s = 0; s < window; s++) {
+        mul(acc, acc, acc);
+      }
+      _select(entry, table, _windowAt(digits, w * window, window));
+      mul(acc, acc, entry);
+    }
+    return acc;
+  }
+
+  /// Returns base^exponent mod n; see [powMontgomery] for [exponentBits].
+  BigInt modPow(BigInt base, BigInt exponent, {int exponentBits = 0}) =>
+      fromMontgomery(powMontgomery(toMontgomery(base), exponent,
+          exponentBits: exponentBits));
+
+  /// Copies entry [index] of [table] into [out], touching every entry.
+  void _select(Uint32List out, Uint32List table, int index) {
+    final len = limbCount;
+    for (var j = 0; j < len; j++) {
+      out[j] = 0;
+    }
+    for (var k = 0, offset = 0; offset < table.length; k++, offset += len) {
+      // -1 when k == index, 0 otherwise.
+      final mask = ((k ^ index) - 1) >> 63;
+      for (var j = 0; j < len; j++) {
+        out[j] |= table[offset + j] & mask;
+      }
+    }
+  }
+
+  static int _windowFor(int bits) {
+    if (bits >= 1536) return 6;
+    if (bits >= 384) return 5;
+    if (bits >= 96) return 4;
+    if (bits >= 24) return 3;
+    return 1;
+  }
+
+  static int _windowAt(Uint32List digits, int position, int width) {
+    final limb = position ~/ limbBits;
+    final shift = position % limbBits;
+    var value = digits[limb] >> shift;
+    if (shift + width > limbBits) {
+      value |= digits[limb + 1] << (limbBits - shift);
+    }
+    return value & ((1 << width) - 1);
+  }
+
+  static Uint32List _toLimbs(BigInt x, int count) {
+    final out = Uint32List(count);
+    final mask = BigInt.from(_mask);
+    for (var i = 0; i < count && x != BigInt.zero; i++) {
+      out[i] = (x & mask).toInt();
+      x >>= limbBits;
+    }
+    return out;
+  }
+}
+
+/// Fixed-base exponentiation with a Lim–Lee comb.
+///
+/// An exponent of up to [maxExponentBits] bits is cut into [teeth] rows of
+/// `d = ceil(maxExponentBits / teeth)` bits, and the table holds every
+/// product of `base^(2^(j·d))` over subsets of the rows. One
+/// exponentiation then costs `d` squarings and `d` multiplications, a
+/// fraction of the variable-base cost for the same exponent. As in
+/// [MontgomeryContext.powMontgomery] the schedule is fixed and entries are
+/// read by scanning the whole table with masks.
+class MontgomeryComb {
+  MontgomeryComb(this.context, BigInt base, this.maxExponentBits,
+      {this.teeth = 6})
+      : _spacing = (maxExponentBits + teeth - 1) ~/ teeth,
+        _table = Uint32List((1 << teeth) * context.limbCount) {
+    if (maxExponentBits <= 0 || teeth <= 0 || teeth > 8) {
+      throw ArgumentError('Invalid comb dimensions');
+    }
+    final len = context.limbCount;
+    _table.setRange(0, len, context._one);
+    final power = context.toMontgomery(base);
+    for (var j = 0; j < teeth; j++) {
+      if (j > 0) {
+        for (var s = 0; s < _spacing; s++) {
+          context.mul(power, power, power);
+        }
+      }
+      // Entries with bit j as their highest bit: entry (i | 2^j) is
+      // entry i times base^(2^(j·d)).
+      final high = 1 << j;
+      for (var i = 0; i < high; i++) {
+        final offset = (high + i) * len;
+        context.mul(Uint32List.sublistView(_table, offset, offset + len),
+            Uint32List.sublistView(_table, i * len, (i + 1) * len), power);
+      }
+    }
+  }
+
+  final MontgomeryContext context;
+
+  /// Longest exponent the table covers.
+  final int maxExponentBits;
+  final int teeth;
+  final int _spacing;
+  final Uint32List _table;
+
+  /// Returns base^exponent mod n; [exponent] must fit in
+  /// [maxExponentBits] bits.
+  BigInt modPow(BigInt exponent) {
+    if (exponent.isNegative || exponent.bitLength > maxExponentBits) {
+      throw ArgumentError.value(
+          exponent, 'exponent', 'must fit in $maxExponentBits bits');
+    }
+    const limbBits = MontgomeryContext.limbBits;
+    final digits = MontgomeryContext._toLimbs(
+        exponent, (_spacing * teeth + limbBits - 1) ~/ limbBits);
+    final acc = Uint32List.fromList(context._one);
+    final entry = Uint32List(context.limbCount);
+    for (var k = _spacing - 1; k >= 0; k--) {
+      if (k != _spacing - 1) {
+        context.mul(acc, acc, acc);
+      }
+      var index = 0;
+      for (var j = 0; j < teeth; j++) {
+        final position = j * _spacing + k;
+        final bit = digits[position ~/ limbBits] >> (position % limbBits) & 1;
+        index |= bit << j;
+      }
+      context._select(entry, _table, index);
+      context.mul(acc, acc, entry);
+    }
+    return context.fromMontgomery(acc);
+  }
+}
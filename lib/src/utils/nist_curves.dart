@@ -0,0 +1,755 @@
+/// Dedicated arithmetic for the NIST P-256 and P-384 curves.
+///
+/// Coordinates are Montgomery-form elements on the 30-bit limbs of
+/// [MontgomeryContext] and points are kept in Jacobian coordinates
+/// (x = X/Z², y = Y/Z³), with a = -3 folded into the doubling formula.
+/// Scalar multiplications that involve secrets (key generation, signing
+/// and ECDH) run a fixed schedule and read their tables with masks;
+/// signature verification only handles public values and uses an
+/// interleaved wNAF (Shamir) double-scalar multiplication instead.
+library;
+
+import 'dart:typed_data';
+
+import 'cryptomath.dart';
+import 'montgomery.dart';
+import 'tlshmac.dart';
+
+/// A short Weierstrass curve y² = x³ - 3x + b of prime order [n].
+class NistCurve {
+  NistCurve._(this.name, this.p, this.n, BigInt b, BigInt gx, BigInt gy)
+      : field = MontgomeryContext(p),
+        scalars = MontgomeryContext(n),
+        coordinateLength = (p.bitLength + 7) ~/ 8,
+        scalarLength = (n.bitLength + 7) ~/ 8 {
+    final len = field.limbCount;
+    _b = field.toMontgomery(b);
+    _gx = field.toMontgomery(gx);
+    _gy = field.toMontgomery(gy);
+    _zero = Uint32List(len);
+    _one = field.one();
+    _t = List<Uint32List>.generate(12, (_) => Uint32List(len));
+    _sx = Uint32List(len);
+    _sy = Uint32List(len);
+    _acc = _Jacobian(len);
+    _entry = _Jacobian(len);
+    _sum = _Jacobian(len);
+  }
+
+  /// NIST P-256 (secp256r1, prime256v1).
+  static final NistCurve p256 = NistCurve._(
+    'secp256r1',
+    _hex('ffffffff00000001000000000000000000000000ffffffffffffffffffffffff'),
+    _hex('ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551'),
+    _hex('5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b'),
+    _hex('6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296'),
+    _hex('4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5'),
+  );
+
+  /// NIST P-384 (secp384r1).
+  static final NistCurve p384 = NistCurve._(
+    'secp384r1',
+    _hex('ffffffffffffffffffffffffffffffffffffffffffffffffffffffff'
+        'fffffffeffffffff0000000000000000ffffffff'),
+    _hex('ffffffffffffffffffffffffffffffffffffffffffffffffc7634d81f4372ddf'
+        '581a0db248b0a77aecec196accc52973'),
+    _hex('b3312fa7e23ee7e4988e056be3f82d19181d9c6efe8141120314088f5013875a'
+        'c656398d8a2ed19d2a85c8edd3ec2aef'),
+    _hex('aa87ca22be8b05378eb1c71ef320ad746e1d3b628ba79b9859f741e082542a38'
+        '5502f25dbf55296c3a545e3872760ab7'),
+    _hex('3617de4a96262c6f5d9e98bf9292dc29f8f41dbd289a147ce9da3113b5f0b8c0'
+        '0a60b1ce1d7e819d7a431d7c90ea0e5f'),
+  );
+
+  /// Returns the curve for a name accepted by getCurveByName, or null when
+  /// it is neither P-256 nor P-384.
+  static NistCurve? byName(String curveName) {
+    switch (curveName.toLowerCase()) {
+      case 'secp256r1':
+      case 'prime256v1':
+      case 'nistp256':
+      case 'nist256p':
+        return p256;
+      case 'secp384r1':
+      case 'nistp384':
+      case 'nist384p':
+        return p384;
+      default:
+        return null;
+    }
+  }
+
+  /// Canonical curve name.
+  final String name;
+
+  /// Field prime.
+  final BigInt p;
+
+  /// Order of the base point.
+  final BigInt n;
+
+  /// Arithmetic modulo [p].
+  final MontgomeryContext field;
+
+  /// Arithmetic modulo [n].
+  final MontgomeryContext scalars;
+
+  /// Bytes in one encoded coordinate.
+  final int coordinateLength;
+
+  /// Bytes in one encoded scalar.
+  final int scalarLength;
+
+  late final Uint32List _b;
+  late final Uint32List _gx;
+  late final Uint32List _gy;
+  late final Uint32List _zero;
+  late final Uint32List _one;
+
+  /// Field temporaries of the point formulas.
+  late final List<Uint32List> _t;
+
+  /// Affine table entry selected by [_mulBase].
+  late final Uint32List _sx;
+  late final Uint32List _sy;
+  late final _Jacobian _acc;
+  late final _Jacobian _entry;
+  late final _Jacobian _sum;
+
+  /// Number of 4-bit windows of a scalar.
+  int get _windows => (n.bitLength + 3) >> 2;
+
+  /// d·16^i·G in affine coordinates for every window i and d in 1..15,
+  /// stored as x, y pairs; built on first use with one field inversion.
+  late final Uint32List _baseTable = _buildBaseTable();
+
+  /// G, 3G, ..., 63G in affine coordinates, the width-7 wNAF table used
+  /// by [verify].
+  late final Uint32List _oddBaseMultiples = _buildOddBaseMultiples();
+
+  /// Returns k·G as (x, y); [k] must be in [1, n - 1].
+  (BigInt, BigInt) mulBase(BigInt k) {
+    _checkScalar(k);
+    _mulBase(_acc, k);
+    return _toAffine(_acc);
+  }
+
+  /// Returns the x coordinate of k·(x, y), encoded in [coordinateLength]
+  /// bytes. The point must have passed [isOnCurve]; [k] must be in
+  /// [1, n - 1].
+  Uint8List sharedSecret(BigInt k, BigInt x, BigInt y) {
+    _checkScalar(k);
+    _mul(_acc, field.toMontgomery(x), field.toMontgomery(y), k);
+    final (sx, _) = _toAffine(_acc);
+    return numberToByteArray(sx, howManyBytes: coordinateLength);
+  }
+
+  /// Encodes (x, y) as an uncompressed point.
+  Uint8List encodePoint(BigInt x, BigInt y) {
+    final out = Uint8List(1 + 2 * coordinateLength);
+    out[0] = 0x04;
+    out.setRange(1, 1 + coordinateLength,
+        numberToByteArray(x, howManyBytes: coordinateLength));
+    out.setRange(1 + coordinateLength, out.length,
+        numberToByteArray(y, howManyBytes: coordinateLength));
+    return out;
+  }
+
+  /// Decodes an uncompressed point and checks that it is on the curve.
+  ///
+  /// Throws [ArgumentError] for any other encoding and for points off the
+  /// curve; the group has cofactor one, so no further check is needed.
+  (BigInt, BigInt) decodePoint(Uint8List encoded) {
+    if (encoded.length != 1 + 2 * coordinateLength || encoded[0] != 0x04) {
+      throw ArgumentError('Invalid uncompressed $name point');
+    }
+    final x = bytesToNumber(
+        Uint8List.sublistView(encoded, 1, 1 + coordinateLength));
+    final y =
+        bytesToNumber(Uint8List.sublistView(encoded, 1 + coordinateLength));
+    if (!isOnCurve(x, y)) {
+      throw ArgumentError('Point is not on $name');
+    }
+    return (x, y);
+  }
+
+  /// Whether (x, y) are reduced coordinates satisfying the curve equation.
+  bool isOnCurve(BigInt x, BigInt y) {
+    if (x.isNegative || y.isNegative || x >= p || y >= p) {
+      return false;
+    }
+    final f = field;
+    final mx = f.toMontgomery(x);
+    final my = f.toMontgomery(y);
+    final lhs = _t[0];
+    final rhs = _t[1];
+    f.mul(lhs, my, my);
+    // x³ - 3x + b = (x² - 3)·x + b
+    f.mul(rhs, mx, mx);
+    final three = _t[2];
+    f.add(three, _one, _one);
+    f.add(three, three, _one);
+    f.sub(rhs, rhs, three);
+    f.mul(rhs, rhs, mx);
+    f.add(rhs, rhs, _b);
+    return _equal(lhs, rhs);
+  }
+
+  /// ECDSA signature of [hash] under the private scalar [d], with the
+  /// nonce derived from [d] and [hash] as in RFC 6979 using HMAC-[hashAlg].
+  (BigInt, BigInt) sign(BigInt d, Uint8List hash, String hashAlg) {
+    _checkScalar(d);
+    final e = _hashToInteger(hash);
+    final nonces = _Rfc6979(this, d, hash, hashAlg);
+    final s = scalars;
+    while (true) {
+      final k = nonces.next();
+      _mulBase(_acc, k);
+      final (x, _) = _toAffine(_acc);
+      final r = x % n;
+      if (r == BigInt.zero) {
+        continue;
+      }
+      // s = k⁻¹·(e + r·d) mod n
+      final sum = s.toMontgomery(r);
+      s.mul(sum, sum, s.toMontgomery(d));
+      s.add(sum, sum, s.toMontgomery(e));
+      final kInv = s.inverse(s.toMontgomery(k));
+      s.mul(sum, sum, kInv);
+      final sig = s.fromMontgomery(sum);
+      if (sig != BigInt.zero) {
+        return (r, sig);
+      }
+    }
+  }
+
+  /// Checks the ECDSA signature (r, s) of [hash] under the public point
+  /// (qx, qy). Runs in variable time; every input is public.
+  bool verify(BigInt qx, BigInt qy, Uint8List hash, BigInt r, BigInt s) {
+    if (r <= BigInt.zero || r >= n || s <= BigInt.zero || s >= n) {
+      return false;
+    }
+    if (!isOnCurve(qx, qy)) {
+      return false;
+    }
+    final w = s.modInverse(n);
+    final u1 = (_hashToInteger(hash) * w) % n;
+    final u2 = (r * w) % n;
+
+    final f = field;
+    final len = f.limbCount;
+    final qTable = _oddMultiples(f.toMontgomery(qx), f.toMontgomery(qy), 8);
+    final gTable = _oddBaseMultiples;
+    final nafG = _wnaf(u1, 7);
+    final nafQ = _wnaf(u2, 5);
+    final acc = _acc..setInfinity();
+    final negY = _t[11];
+    final length = nafG.length > nafQ.length ? nafG.length : nafQ.length;
+    for (var i = length - 1; i >= 0; i--) {
+      _double(acc, acc);
+      final dg = i < nafG.length ? nafG[i] : 0;
+      if (dg != 0) {
+        final offset = ((dg.abs() >> 1) * 2) * len;
+        _sx.setRange(0, len, gTable, offset);
+        _sy.setRange(0, len, gTable, offset + len);
+        if (dg < 0) {
+          f.sub(_sy, _zero, _sy);
+        }
+        _addAffine(acc, _sx, _sy, -1);
+      }
+      final dq = i < nafQ.length ? nafQ[i] : 0;
+      if (dq != 0) {
+        final entry = qTable[dq.abs() >> 1];
+        if (dq < 0) {
+          f.sub(negY, _zero, entry.y);
+          _entry
+            ..x.setAll(0, entry.x)
+            ..y.setAll(0, negY)
+            ..z.setAll(0, entry.z);
+          _add(acc, acc, _entry);
+        } else {
+          _add(acc, acc, entry);
+        }
+      }
+    }
+    if (_isZeroMask(acc.z) != 0) {
+      return false;
+    }
+    final (x, _) = _toAffine(acc);
+    return x % n == r;
+  }
+
+  void _checkScalar(BigInt k) {
+    if (k <= BigInt.zero || k >= n) {
+      throw ArgumentError.value(k, 'k', 'must be in [1, n - 1]');
+    }
+  }
+
+  /// The leftmost bits of [hash], as many as [n] has.
+  BigInt _hashToInteger(Uint8List hash) {
+    final e = bytesToNumber(hash);
+    final excess = hash.length * 8 - n.bitLength;
+    return excess > 0 ? e >> excess : e;
+  }
+
+  /// [r] = k·G from the window table: one mixed addition per window and
+  /// no doublings.
+  ///
+  /// The accumulator holds Σ d_j·16^j·G over the windows below i, a
+  /// multiple smaller than 16^i, so for k < n it never equals ±d_i·16^i·G
+  /// and the addition never hits its doubling or cancelling case.
+  void _mulBase(_Jacobian r, BigInt k) {
+    final len = field.limbCount;
+    final table = _baseTable;
+    final digits = _nibbles(k);
+    r.setInfinity();
+    for (var i = 0; i < digits.length; i++) {
+      final digit = digits[i];
+      _zeroLimbs(_sx);
+      _zeroLimbs(_sy);
+      var offset = i * 15 * 2 * len;
+      for (var d = 1; d <= 15; d++, offset += 2 * len) {
+        final mask = ((d ^ digit) - 1) >> 63;
+        for (var j = 0; j < len; j++) {
+          _sx[j] |= table[offset + j] & mask;
+          _sy[j] |= table[offset + len + j] & mask;
+        }
+      }
+      _addAffine(r, _sx, _sy, -digit >> 63);
+    }
+  }
+
+  /// [r] = k·(x, y) with a fixed 4-bit window from the top.
+  ///
+  /// After the doublings the accumulator is 16·a·P for a prefix a of k, so
+  /// for k < n it is never ±d·P for the selected digit d (unless both are
+  /// the point at infinity, which the addition handles with masks).
+  void _mul(_Jacobian r, Uint32List x, Uint32List y, BigInt k) {
+    final f = field;
+    final len = f.limbCount;
+    final table = List<_Jacobian>.generate(16, (_) => _Jacobian(len));
+    table[0].setInfinity();
+    table[1]
+      ..x.setAll(0, x)
+      ..y.setAll(0, y)
+      ..z.setAll(0, _one);
+    _double(table[2], table[1]);
+    for (var d = 3; d < 16; d++) {
+      _add(table[d], table[d - 1], table[1]);
+    }
+
+    final digits = _nibbles(k);
+    final entry = _entry;
+    r.setInfinity();
+    for (var i = digits.length - 1; i >= 0; i--) {
+      for (var s = 0; s < 4; s++) {
+        _double(r, r);
+      }
+      final digit = digits[i];
+      entry.setZero();
+      for (var d = 0; d < 16; d++) {
+        entry.orMasked(table[d], ((d ^ digit) - 1) >> 63);
+      }
+      _add(r, r, entry);
+    }
+  }
+
+  /// The 4-bit digits of [k], least significant first, for every window.
+  Uint8List _nibbles(BigInt k) {
+    final bytes = numberToByteArray(k, howManyBytes: scalarLength);
+    final digits = Uint8List(_windows);
+    for (var i = 0; i < digits.length; i++) {
+      digits[i] = (bytes[bytes.length - 1 - (i >> 1)] >> ((i & 1) << 2)) & 15;
+    }
+    return digits;
+  }
+
+  /// Width-[w] non-adjacent form of [k], least significant digit first.
+  static List<int> _wnaf(BigInt k, int w) {
+    final digits = <int>[];
+    final modulus = 1 << w;
+    while (k > BigInt.zero) {
+      var digit = 0;
+      if (k.isOdd) {
+        digit = (k & BigInt.from(modulus - 1)).toInt();
+        if (digit >= modulus >> 1) {
+          digit -= modulus;
+        }
+        k -= BigInt.from(digit);
+      }
+      digits.add(digit);
+      k >>= 1;
+    }
+    return digits;
+  }
+
+  /// P, 3P, ..., (2·count - 1)·P for the affine Montgomery-form P.
+  List<_Jacobian> _oddMultiples(Uint32List x, Uint32List y, int count) {
+    final len = field.limbCount;
+    final out = List<_Jacobian>.generate(count, (_) => _Jacobian(len));
+    out[0]
+      ..x.setAll(0, x)
+      ..y.setAll(0, y)
+      ..z.setAll(0, _one);
+    final twice = _Jacobian(len);
+    _double(twice, out[0]);
+    for (var i = 1; i < count; i++) {
+      _add(out[i], out[i - 1], twice);
+    }
+    return out;
+  }
+
+  Uint32List _buildOddBaseMultiples() =>
+      _batchToAffine(_oddMultiples(_gx, _gy, 32));
+
+  Uint32List _buildBaseTable() {
+    final len = field.limbCount;
+    final points =
+        List<_Jacobian>.generate(_windows * 15, (_) => _Jacobian(len));
+    final base = _Jacobian(len)
+      ..x.setAll(0, _gx)
+      ..y.setAll(0, _gy)
+      ..z.setAll(0, _one);
+    for (var i = 0; i < _windows; i++) {
+      final row = i * 15;
+      points[row].copyFrom(base);
+      _double(points[row + 1], base);
+      for (var d = 3; d <= 15; d++) {
+        _add(points[row + d - 1], points[row + d - 2], base);
+      }
+      // 16·base for the next window.
+      _double(base, points[row + 7]);
+    }
+    return _batchToAffine(points);
+  }
+
+  /// Affine x, y pairs of [points], none of them at infinity, with a
+  /// single field inversion (Montgomery's trick).
+  Uint32List _batchToAffine(List<_Jacobian> points) {
+    final f = field;
+    final len = f.limbCount;
+    final count = points.length;
+    final prefix = Uint32List(count * len);
+    final acc = f.one();
+    for (var i = 0; i < count; i++) {
+      prefix.setRange(i * len, (i + 1) * len, acc);
+      f.mul(acc, acc, points[i].z);
+    }
+    final inv = f.inverse(acc);
+    final out = Uint32List(count * 2 * len);
+    final zInv = _t[0];
+    final zInv2 = _t[1];
+    final coordinate = _t[2];
+    for (var i = count - 1; i >= 0; i--) {
+      final point = points[i];
+      f.mul(zInv, inv, Uint32List.sublistView(prefix, i * len, (i + 1) * len));
+      f.mul(inv, inv, point.z);
+      f.mul(zInv2, zInv, zInv);
+      f.mul(coordinate, point.x, zInv2);
+      out.setRange(2 * i * len, (2 * i + 1) * len, coordinate);
+      f.mul(zInv2, zInv2, zInv);
+      f.mul(coordinate, point.y, zInv2);
+      out.setRange((2 * i + 1) * len, (2 * i + 2) * len, coordinate);
+    }
+    return out;
+  }
+
+  /// Affine coordinates of [point], which must not be at infinity.
+  (BigInt, BigInt) _toAffine(_Jacobian point) {
+    final f = field;
+    final zInv = f.inverse(point.z);
+    final zInv2 = _t[0];
+    final coordinate = _t[1];
+    f.mul(zInv2, zInv, zInv);
+    f.mul(coordinate, point.x, zInv2);
+    final x = f.fromMontgomery(coordinate);
+    f.mul(zInv2, zInv2, zInv);
+    f.mul(coordinate, point.y, zInv2);
+    return (x, f.fromMontgomery(coordinate));
+  }
+
+  /// [r] = 2·[q] ("dbl-2001-b", a = -3); [r] may alias [q]. The point at
+  /// infinity (Z = 0) doubles to itself.
+  void _double(_Jacobian r, _Jacobian q) {
+    final f = field;
+    final delta = _t[0];
+    final gamma = _t[1];
+    final beta = _t[2];
+    final alpha = _t[3];
+    final t = _t[4];
+    f.mul(delta, q.z, q.z);
+    f.mul(gamma, q.y, q.y);
+    f.mul(beta, q.x, gamma);
+    // alpha = 3·(X - delta)·(X + delta)
+    f.sub(t, q.x, delta);
+    f.add(alpha, q.x, delta);
+    f.mul(alpha, alpha, t);
+    f.add(t, alpha, alpha);
+    f.add(alpha, alpha, t);
+    // Z3 = (Y + Z)² - gamma - delta
+    f.add(t, q.y, q.z);
+    f.mul(t, t, t);
+    f.sub(t, t, gamma);
+    f.sub(r.z, t, delta);
+    // X3 = alpha² - 8·beta
+    f.add(beta, beta, beta);
+    f.add(beta, beta, beta);
+    f.mul(t, alpha, alpha);
+    f.sub(t, t, beta);
+    f.sub(r.x, t, beta);
+    // Y3 = alpha·(4·beta - X3) - 8·gamma²
+    f.sub(t, beta, r.x);
+    f.mul(t, alpha, t);
+    f.mul(gamma, gamma, gamma);
+    f.add(gamma, gamma, gamma);
+    f.add(gamma, gamma, gamma);
+    f.add(gamma, gamma, gamma);
+    f.sub(r.y, t, gamma);
+  }
+
+  /// [r] = [p] + [q] ("add-2007-bl"); [r] may alias either input.
+  ///
+  /// Either input may be the point at infinity, which is resolved with
+  /// masks. When p = q the formula degenerates and the doubling is taken
+  /// on a branch; the secret-scalar callers never reach that case (see
+  /// [_mul]), so the branch only runs on public data.
+  void _add(_Jacobian r, _Jacobian p, _Jacobian q) {
+    final f = field;
+    final z1z1 = _t[0];
+    final z2z2 = _t[1];
+    final u1 = _t[2];
+    final h = _t[3];
+    final s1 = _t[4];
+    final rr = _t[5];
+    final i = _t[6];
+    final j = _t[7];
+    final v = _t[8];
+    final sum = _sum;
+    f.mul(z1z1, p.z, p.z);
+    f.mul(z2z2, q.z, q.z);
+    f.mul(u1, p.x, z2z2);
+    f.mul(h, q.x, z1z1);
+    f.sub(h, h, u1);
+    f.mul(s1, p.y, q.z);
+    f.mul(s1, s1, z2z2);
+    f.mul(rr, q.y, p.z);
+    f.mul(rr, rr, z1z1);
+    f.sub(rr, rr, s1);
+    final pInfinity = _isZeroMask(p.z);
+    final qInfinity = _isZeroMask(q.z);
+    if ((_isZeroMask(h) & _isZeroMask(rr) & ~pInfinity & ~qInfinity) != 0) {
+      _double(r, p);
+      return;
+    }
+    f.add(rr, rr, rr);
+    // Z3 = ((Z1 + Z2)² - Z1Z1 - Z2Z2)·H
+    f.add(sum.z, p.z, q.z);
+    f.mul(sum.z, sum.z, sum.z);
+    f.sub(sum.z, sum.z, z1z1);
+    f.sub(sum.z, sum.z, z2z2);
+    f.mul(sum.z, sum.z, h);
+    // I = (2·H)², J = H·I, V = U1·I
+    f.add(i, h, h);
+    f.mul(i, i, i);
+    f.mul(j, h, i);
+    f.mul(v, u1, i);
+    // X3 = r² - J - 2·V
+    f.mul(sum.x, rr, rr);
+    f.sub(sum.x, sum.x, j);
+    f.sub(sum.x, sum.x, v);
+    f.sub(sum.x, sum.x, v);
+    // Y3 = r·(V - X3) - 2·S1·J
+    f.sub(v, v, sum.x);
+    f.mul(sum.y, rr, v);
+    f.mul(s1, s1, j);
+    f.add(s1, s1, s1);
+    f.sub(sum.y, sum.y, s1);
+
+    sum.select(q, pInfinity);
+    sum.select(p, qInfinity);
+    r.copyFrom(sum);
+  }
+
+  /// [r] += (x, y) ("madd-2007-bl") for an affine point that is present
+  /// when [present] is -1 and stands for infinity when it is 0.
+  ///
+  /// Infinity on either side is resolved with masks; the doubling case is
+  /// taken on a branch, as in [_add].
+  void _addAffine(_Jacobian r, Uint32List x, Uint32List y, int present) {
+    final f = field;
+    final z1z1 = _t[0];
+    final h = _t[1];
+    final rr = _t[2];
+    final hh = _t[3];
+    final i = _t[4];
+    final j = _t[5];
+    final v = _t[6];
+    final sum = _sum;
+    f.mul(z1z1, r.z, r.z);
+    f.mul(h, x, z1z1);
+    f.sub(h, h, r.x);
+    f.mul(rr, y, r.z);
+    f.mul(rr, rr, z1z1);
+    f.sub(rr, rr, r.y);
+    final rInfinity = _isZeroMask(r.z);
+    if ((_isZeroMask(h) & _isZeroMask(rr) & ~rInfinity & present) != 0) {
+      _double(r, r);
+      return;
+    }
+    f.add(rr, rr, rr);
+    f.mul(hh, h, h);
+    // Z3 = (Z1 + H)² - Z1Z1 - HH
+    f.add(sum.z, r.z, h);
+    f.mul(sum.z, sum.z, sum.z);
+    f.sub(sum.z, sum.z, z1z1);
+    f.sub(sum.z, sum.z, hh);
+    // I = 4·HH, J = H·I, V = X1·I
+    f.add(i, hh, hh);
+    f.add(i, i, i);
+    f.mul(j, h, i);
+    f.mul(v, r.x, i);
+    // X3 = r² - J - 2·V
+    f.mul(sum.x, rr, rr);
+    f.sub(sum.x, sum.x, j);
+    f.sub(sum.x, sum.x, v);
+    f.sub(sum.x, sum.x, v);
+    // Y3 = r·(V - X3) - 2·Y1·J
+    f.sub(v, v, sum.x);
+    f.mul(sum.y, rr, v);
+    f.mul(j, r.y, j);
+    f.add(j, j, j);
+    f.sub(sum.y, sum.y, j);
+
+    // Infinity plus (x, y) is (x, y, 1).
+    final lift = rInfinity & present;
+    _select(sum.x, x, lift);
+    _select(sum.y, y, lift);
+    _select(sum.z, _one, lift);
+    r.select(sum, present);
+  }
+
+  static BigInt _hex(String hex) => BigInt.parse(hex, radix: 16);
+}
+
+/// RFC 6979 deterministic nonces for one (key, message) pair.
+class _Rfc6979 {
+  _Rfc6979(this._curve, BigInt d, Uint8List hash, this._hashAlg) {
+    final length = _curve.scalarLength;
+    final x = numberToByteArray(d, howManyBytes: length);
+    var h = _curve._hashToInteger(hash);
+    if (h >= _curve.n) {
+      h -= _curve.n;
+    }
+    final m = numberToByteArray(h, howManyBytes: length);
+    final digestSize = TlsHmac(const [], digestmod: _hashAlg).digestSize;
+    _v = Uint8List(digestSize)..fillRange(0, digestSize, 0x01);
+    _k = Uint8List(digestSize);
+    for (final separator in const [0x00, 0x01]) {
+      _k = _mac(_k, [..._v, separator, ...x, ...m]);
+      _v = _mac(_k, _v);
+    }
+  }
+
+  final NistCurve _curve;
+  final String _hashAlg;
+  late Uint8List _k;
+  late Uint8List _v;
+  bool _first = true;
+
+  /// The next candidate nonce in [1, n - 1].
+  BigInt next() {
+    final length = _curve.scalarLength;
+    while (true) {
+      if (!_first) {
+        _k = _mac(_k, [..._v, 0x00]);
+        _v = _mac(_k, _v);
+      }
+      _first = false;
+      final t = BytesBuilder(copy: false);
+      while (t.length < length) {
+        _v = _mac(_k, _v);
+        t.add(_v);
+      }
+      final k = _curve._hashToInteger(
+          Uint8List.sublistView(t.takeBytes(), 0, length));
+      if (k > BigInt.zero && k < _curve.n) {
+        return k;
+      }
+    }
+  }
+
+  Uint8List _mac(Uint8List key, List<int> data) =>
+      (TlsHmac(key, digestmod: _hashAlg)..update(data)).digest();
+}
+
+/// A point in Jacobian coordinates; Z = 0 is the point at infinity.
+class _Jacobian {
+  _Jacobian(int len)
+      : x = Uint32List(len),
+        y = Uint32List(len),
+        z = Uint32List(len);
+
+  final Uint32List x;
+  final Uint32List y;
+  final Uint32List z;
+
+  void setZero() {
+    _zeroLimbs(x);
+    _zeroLimbs(y);
+    _zeroLimbs(z);
+  }
+
+  void setInfinity() => setZero();
+
+  void copyFrom(_Jacobian other) {
+    x.setAll(0, other.x);
+    y.setAll(0, other.y);
+    z.setAll(0, other.z);
+  }
+
+  /// Replaces this point with [other] where [mask] is -1.
+  void select(_Jacobian other, int mask) {
+    _select(x, other.x, mask);
+    _select(y, other.y, mask);
+    _select(z, other.z, mask);
+  }
+
+  /// ORs in the coordinates of [other] masked by [mask].
+  void orMasked(_Jacobian other, int mask) {
+    for (var j = 0; j < x.length; j++) {
+      x[j] |= other.x[j] & mask;
+      y[j] |= other.y[j] & mask;
+      z[j] |= other.z[j] & mask;
+    }
+  }
+}
+
+void _zeroLimbs(Uint32List a) {
+  for (var j = 0; j < a.length; j++) {
+    a[j] = 0;
+  }
+}
+
+/// Replaces [out] with [a] where [mask] is -1, leaves it where it is 0.
+void _select(Uint32List out, Uint32List a, int mask) {
+  for (var j = 0; j < out.length; j++) {
+    out[j] = (out[j] & ~mask) | (a[j] & mask);
+  }
+}
+
+/// -1 when every limb of [a] is zero, 0 otherwise.
+int _isZeroMask(Uint32List a) {
+  var bits = 0;
+  for (var j = 0; j < a.length; j++) {
+    bits |= a[j];
+  }
+  return (bits - 1) >> 63;
+}
+
+bool _equal(Uint32List a, Uint32List b) {
+  var diff = 0;
+  for (var j = 0; j < a.length; j++) {
+    diff |= a[j] ^ b[j];
+  }
+  return diff == 0;
+}
@@ -1,9 +1,11 @@
 import 'dart:typed_data';
 
 import '../errors.dart';
+import '../experimental/montgomery_asm_x86_64.dart';
 import 'constanttime.dart' as ct;
 import 'cryptomath.dart';
 import 'der.dart';
+import 'montgomery.dart';
 import 'pem.dart';
 import 'pkcs8.dart';
 import 'tlshashlib.dart' as tlshash;
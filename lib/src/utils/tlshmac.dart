@@ -1,47 +1,140 @@
 import 'dart:typed_data';
 
-import 'package:crypto/crypto.dart' as crypto;
-
+import '../crypto/streaming_digest.dart';
 import 'tlshashlib.dart';
 
-/// Minimal HMAC helper compatible
+/// HMAC (RFC 2104) over the cloneable digests of [StreamingDigest].
+///
+/// The inner and outer hash states are taken once, right after absorbing
+/// `key ^ ipad` and `key ^ opad`, and shared by every [copy]; a copy only
+/// clones the running inner state. [macRecord] computes a TLS 1.0-1.2
+/// record MAC straight from the keyed states into a caller buffer, which
+/// is what the record layer uses for CBC and stream cipher suites.
 class TlsHmac {
-  TlsHmac(List<int> key, {dynamic digestmod, List<int>? message})
-      : _algorithm = _resolveAlgorithm(digestmod),
-        _key = Uint8List.fromList(key),
-        _buffer = BytesBuilder() {
+  factory TlsHmac(List<int> key, {dynamic digestmod, List<int>? message}) {
+    final algorithm = _resolveAlgorithm(digestmod);
+    if (!StreamingDigest.isSupported(algorithm)) {
+      throw ArgumentError('Unsupported HMAC algorithm: $algorithm');
+    }
+    final inner = StreamingDigest(algorithm);
+    final outer = StreamingDigest(algorithm);
+    final blockSize = inner.blockSize;
+
+    var keyBytes = Uint8List.fromList(key);
+    if (keyBytes.length > blockSize) {
+      keyBytes = (StreamingDigest(algorithm)..update(keyBytes)).finish();
+    }
+    final pad = Uint8List(blockSize)..setRange(0, keyBytes.length, keyBytes);
+    for (var i = 0; i < blockSize; i++) {
+      pad[i] ^= 0x36;
+    }
+    inner.update(pad);
+    for (var i = 0; i < blockSize; i++) {
+      pad[i] ^= 0x36 ^ 0x5c;
+    }
+    outer.update(pad);
+
+    final mac = TlsHmac._(inner, outer, inner.copy());
     if (message != null && message.isNotEmpty) {
-      update(message);
+      mac.update(message);
     }
+    return mac;
   }
 
-  final String _algorithm;
-  final Uint8List _key;
-  final BytesBuilder _buffer;
+  TlsHmac._(this._innerKeyed, this._outerKeyed, this._inner);
+
+  /// Inner and outer states right after the padded key; never mutated.
+  final StreamingDigest _innerKeyed;
+  final StreamingDigest _outerKeyed;
 
-  int get digestSize => _digestSizeFor(_algorithm);
+  /// Inner state including everything passed to [update].
+  final StreamingDigest _inner;
 
-  int get blockSize => _blockSizeFor(_algorithm);
+  /// Scratch states and record header for [macRecord], allocated on first
+  /// use.
+  StreamingDigest? _innerScratch;
+  StreamingDigest? _outerScratch;
+  Uint8List? _header;
 
-  /// Appends data into the HMAC stream.
-  void update(List<int> data) {
-    _buffer.add(data);
+  int get digestSize => _inner.digestSize;
+
+  int get blockSize => _inner.blockSize;
+
+  /// Appends `data[start:end]` into the HMAC stream.
+  void update(List<int> data, [int start = 0, int? end]) {
+    _inner.update(data, start, end);
   }
 
   /// Returns the HMAC digest for the data seen so far.
   Uint8List digest() {
-    final mac = crypto.Hmac(_selectHash(_algorithm), _key);
-    return Uint8List.fromList(mac.convert(_buffer.toBytes()).bytes);
+    final outer = _outerKeyed.copy()..update(_inner.digest());
+    return outer.finish();
+  }
+
+  /// Drops everything passed to [update], back to the freshly keyed state.
+  void reset() {
+    _inner.replaceWith(_innerKeyed);
+  }
+
+  /// Writes the HMAC of the data seen so far into [out] at [outOffset] and
+  /// returns [digestSize].
+  ///
+  /// Unlike [digest] this consumes the running state instead of cloning
+  /// it, so call [reset] before the next message.
+  int finishInto(Uint8List out, [int outOffset = 0]) {
+    final size = digestSize;
+    if (outOffset < 0 || out.length - outOffset < size) {
+      throw ArgumentError('Output buffer too small');
+    }
+    final outer = (_outerScratch ??= StreamingDigest(_inner.algorithm))
+      ..replaceWith(_outerKeyed)
+      ..update(_inner.finish());
+    out.setRange(outOffset, outOffset + size, outer.finish());
+    return size;
   }
 
   /// Returns a copy of the current HMAC state.
   TlsHmac copy() {
-    final snapshot = _buffer.toBytes();
-    final clone = TlsHmac(_key, digestmod: _algorithm);
-    if (snapshot.isNotEmpty) {
-      clone.update(snapshot);
+    return TlsHmac._(_innerKeyed, _outerKeyed, _inner.copy());
+  }
+
+  /// Writes the TLS record MAC
+  /// `HMAC(seq_num || type || version || length || payload)` into [out] at
+  /// [outOffset] and returns [digestSize].
+  ///
+  /// [version] is `[major, minor]`; pass null to leave it out, as SSLv3
+  /// does. The MAC always starts from the keyed state, so data given to
+  /// [update] does not affect it and this object can be reused for every
+  /// record of a connection without [copy].
+  int macRecord(int seq, int contentType, List<int>? version,
+      Uint8List payload, Uint8List out, [int outOffset = 0]) {
+    final size = digestSize;
+    if (outOffset < 0 || out.length - outOffset < size) {
+      throw ArgumentError('Output buffer too small');
+    }
+    final header = _header ??= Uint8List(13);
+    for (var i = 0; i < 8; i++) {
+      header[7 - i] = (seq >>> (8 * i)) & 0xff;
     }
-    return clone;
+    header[8] = contentType;
+    var headerLength = 9;
+    if (version != null) {
+      header[9] = version[0];
+      header[10] = version[1];
+      headerLength = 11;
+    }
+    header[headerLength] = (payload.length >> 8) & 0xff;
+    header[headerLength + 1] = payload.length & 0xff;
+
+    final inner = (_innerScratch ??= StreamingDigest(_inner.algorithm))
+      ..replaceWith(_innerKeyed)
+      ..update(header, 0, headerLength + 2)
+      ..update(payload);
+    final outer = (_outerScratch ??= StreamingDigest(_inner.algorithm))
+      ..replaceWith(_outerKeyed)
+      ..update(inner.finish());
+    out.setRange(outOffset, outOffset + size, outer.finish());
+    return size;
   }
 }
 
@@ -74,56 +167,3 @@ String _resolveAlgorithm(dynamic digestmod) {
   }
   throw ArgumentError('Unsupported digest spec: ${digestmod.runtimeType}');
 }
-
-crypto.Hash _selectHash(String algorithm) {
-  switch (algorithm) {
-    case 'md5':
-      return crypto.md5;
-    case 'sha1':
-      return crypto.sha1;
-    case 'sha224':
-      return crypto.sha224;
-    case 'sha256':
-      return crypto.sha256;
-    case 'sha384':
-      return crypto.sha384;
-    case 'sha512':
-      return crypto.sha512;
-    default:
-      throw ArgumentError('Unsupported HMAC algorithm: $algorithm');
-  }
-}
-
-int _digestSizeFor(String algorithm) {
-  switch (algorithm) {
-    case 'md5':
-      return 16;
-    case 'sha1':
-      return 20;
-    case 'sha224':
-      return 28;
-    case 'sha256':
-      return 32;
-    case 'sha384':
-      return 48;
-    case 'sha512':
-      return 64;
-    default:
-      throw ArgumentError('Unsupported HMAC algorithm: $algorithm');
-  }
-}
-
-int _blockSizeFor(String algorithm) {
-  switch (algorithm) {
-    case 'md5':
-    case 'sha1':
-    case 'sha224':
-    case 'sha256':
-      return 64;
-    case 'sha384':
-    case 'sha512':
-      return 128;
-    default:
-      throw ArgumentError('Unsupported HMAC algorithm: $algorithm');
-  }
-}
@@ -1,6 +1,7 @@
 import 'dart:typed_data';
 
 import 'cryptomath.dart';
+import 'fe25519.dart';
 
 const int _x25519Bits = 255;
 const int _x448Bits = 448;
@@ -48,12 +49,74 @@ BigInt decodeScalar448(List<int> k) {
   return bytesToNumber(data, endian: 'little');
 }
 
+/// X25519 (RFC 7748) on radix 2^25.5 limbs; see [feMul].
+///
+/// Runs in constant time: the ladder does the same field operations for
+/// every scalar bit and swaps with masks.
 Uint8List x25519(List<int> k, List<int> u) {
-  final scalar = decodeScalar22519(k);
-  final coord = decodeUCoordinate(u, _x25519Bits);
-  final a24 = BigInt.from(121665);
-  final p = (BigInt.one << 255) - BigInt.from(19);
-  return _x25519Generic(scalar, coord, _x25519Bits, a24, p);
+  if (k.length != X25519_ORDER_SIZE || u.length != X25519_ORDER_SIZE) {
+    throw ArgumentError('X25519 inputs must be 32 bytes long');
+  }
+  final e = Uint8List.fromList(k);
+  e[0] &= 248;
+  e[31] &= 127;
+  e[31] |= 64;
+
+  final x1 = feNew();
+  final x2 = feNew();
+  final z2 = feNew();
+  final x3 = feNew();
+  final z3 = feNew();
+  final a = feNew();
+  final aa = feNew();
+  final b = feNew();
+  final bb = feNew();
+  final ee = feNew();
+  final c = feNew();
+  final d = feNew();
+  final da = feNew();
+  final cb = feNew();
+
+  feFromBytes(x1, u);
+  feOne(x2);
+  feCopy(x3, x1);
+  feOne(z3);
+  var swap = 0;
+  for (var t = _x25519Bits - 1; t >= 0; t--) {
+    final kt = (e[t >> 3] >> (t & 7)) & 1;
+    swap ^= kt;
+    feCSwap(x2, x3, swap);
+    feCSwap(z2, z3, swap);
+    swap = kt;
+
+    feAdd(a, x2, z2);
+    feSquare(aa, a);
+    feSub(b, x2, z2);
+    feSquare(bb, b);
+    feSub(ee, aa, bb);
+    feAdd(c, x3, z3);
+    feSub(d, x3, z3);
+    feMul(da, d, a);
+    feMul(cb, c, b);
+    feAdd(x3, da, cb);
+    feSquare(x3, x3);
+    feSub(z3, da, cb);
+    feSquare(z3, z3);
+    feMul(z3, z3, x1);
+    feMul(x2, aa, bb);
+    // z2 = E * (BB + 121666 * E), equal to RFC 7748's E * (AA + a24 * E)
+    feMulSmall(z2, ee, 121666);
+    feAdd(z2, z2, bb);
+    feMul(z2, z2, ee);
+  }
+  feCSwap(x2, x3, swap);
+  feCSwap(z2, z3, swap);
+
+  feInvert(z2, z2);
+  feMul(x2, x2, z2);
+  final out = Uint8List(X25519_ORDER_SIZE);
+  feToBytes(out, x2);
+  return out;
 }
 
 Uint8List x448(List<int> k, List<int> u) {
@@ -1,6 +1,7 @@
 import 'dart:typed_data';
 
 import 'constants.dart';
+import 'signature_cache.dart';
 import 'utils/asn1parser.dart';
 import 'utils/compat.dart';
 import 'utils/cryptomath.dart';
@@ -36,6 +37,9 @@ class X509 {
   /// Parsed signature algorithm identifier (SignatureScheme or legacy tuple).
   dynamic signatureAlgorithm;
 
+  /// DER-encoded signature AlgorithmIdentifier.
+  Uint8List? signatureAlgorithmBytes;
+
   /// DER-encoded issuer distinguished name.
   Uint8List? issuer;
 
@@ -72,6 +76,7 @@ class X509 {
     tbsCertificateBytes = Uint8List.fromList(parser.getChildBytes(0));
     final tbsCertificate = parser.getChild(0);
     
+    signatureAlgorithmBytes = Uint8List.fromList(parser.getChildBytes(1));
     final signatureAlgorithmIdentifier = parser.getChild(1);
     signatureAlgorithm =
         _resolveSignatureAlgorithm(signatureAlgorithmIdentifier);
@@ -118,6 +123,30 @@ class X509 {
     return this;
   }
 
+  /// Verify that [issuerCert]'s key signed this certificate.
+  ///
+  /// Unlike [verify], successful checks are remembered in [cache]
+  /// (the shared [SignatureVerificationCache] by default), so a chain seen
+  /// again is not verified again.
+  bool verifyIssuedBy(X509 issuerCert, {SignatureVerificationCache? cache}) {
+    final issuerKey = issuerCert.publicKey;
+    if (issuerKey == null) {
+      throw StateError('Issuer certificate not parsed or incomplete');
+    }
+    if (tbsCertificateBytes == null ||
+        signatureValue == null ||
+        signatureAlgorithmBytes == null) {
+      throw StateError('Certificate not parsed or incomplete');
+    }
+    return (cache ?? SignatureVerificationCache.shared).verify(
+      publicKey: issuerKey,
+      algorithm: signatureAlgorithmBytes!,
+      signedData: tbsCertificateBytes!,
+      signature: signatureValue!,
+      verifier: () => verify(issuerKey),
+    );
+  }
+
   /// Verify the certificate signature against the issuer's public key.
   bool verify(Object issuerPublicKey) {
     if (tbsCertificateBytes == null || signatureValue == null || signatureAlgorithm == null) {
@@ -127,10 +156,12 @@ class X509 {
     String? hashName;
     String? padding;
     
-    if (signatureAlgorithm is int) {
-        final schemeName = SignatureScheme.toRepr(signatureAlgorithm);
-        if (schemeName == null) throw FormatException('Unknown signature scheme');
-        
+    // Parsed OIDs resolve to SignatureScheme values, which are neither int
+    // nor List; toRepr accepts both those and plain scheme numbers.
+    final schemeName = signatureAlgorithm is List
+        ? null
+        : SignatureScheme.toRepr(signatureAlgorithm);
+    if (schemeName != null) {
         hashName = SignatureScheme.getHash(schemeName);
         padding = SignatureScheme.getPadding(schemeName);
         if (padding.isEmpty) padding = null;
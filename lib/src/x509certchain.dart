@@ -1,3 +1,4 @@
+import 'signature_cache.dart';
 import 'utils/pem.dart';
 import 'x509.dart';
 
@@ -42,6 +43,21 @@ class X509CertChain {
     return x509List.first.getFingerprint();
   }
 
+  /// Check that every certificate is signed by the one after it.
+  ///
+  /// The last certificate is not checked; it is either a trust anchor or
+  /// must be verified against one by the caller. Verified links are
+  /// remembered in [cache] (the shared [SignatureVerificationCache] by
+  /// default), so a chain presented again costs only hashing.
+  bool verifySignatures({SignatureVerificationCache? cache}) {
+    for (var i = 0; i + 1 < x509List.length; i++) {
+      if (!x509List[i].verifyIssuedBy(x509List[i + 1], cache: cache)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   /// TACK validation is not yet ported; conservatively return false.
   bool checkTack(Object tack) {
     // NOTE: TACK support requires utils/tackwrapper.dart (rarely used feature)
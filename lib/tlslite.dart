@@ -18,3 +18,5 @@ export 'src/tls_connection.dart';
 export 'src/x509.dart';
 export 'src/x509certchain.dart';
 export 'src/utils/binary_io.dart';
+export 'src/utils/cipher_backends.dart'
+    show CipherBackends, CipherPrimitive, CpuFeatures;
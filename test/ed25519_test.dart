@@ -65,4 +65,32 @@ void main() {
     var wrongResult = ed.verify(publicKey, wrongMessage, sig);
     assert(wrongResult == false);
   });
+  test('rejects non-canonical s (s + L)', () {
+    var publicKey = ed.PublicKey(HEX.decode(
+        'd75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a'));
+    var sig = Uint8List.fromList(HEX.decode(
+        'e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b'));
+    expect(ed.verify(publicKey, Uint8List(0), sig), isTrue);
+
+    var malleated = Uint8List.fromList(HEX.decode(
+        'e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901554c8c7872aa064e049dbb3013fbf29380d25bf5f0595bbe24655141438e7a101b'));
+    expect(ed.verify(publicKey, Uint8List(0), malleated), isFalse);
+  });
+
+  test('rejects public key that is not on the curve', () {
+    // y = 2 has no matching x on edwards25519
+    var publicKey = ed.PublicKey(Uint8List(32)..[0] = 2);
+    var keyPair = ed.generateKey();
+    var message = utf8.encode('test message');
+    var sig = ed.sign(keyPair.privateKey, message);
+    expect(ed.verify(publicKey, message, sig), isFalse);
+  });
+
+  test('newKeyFromSeed matches rfc8032 public key', () {
+    var seed = Uint8List.fromList(HEX.decode(
+        '4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb'));
+    var privateKey = ed.newKeyFromSeed(seed);
+    expect(HEX.encode(ed.public(privateKey).bytes),
+        '3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c');
+  });
 }
@@ -0,0 +1,71 @@
+import 'package:test/test.dart';
+import 'package:tlslite/src/constants.dart' as tls_constants;
+import 'package:tlslite/src/errors.dart';
+import 'package:tlslite/src/ffdhe_context.dart';
+import 'package:tlslite/src/ffdhe_groups.dart';
+import 'package:tlslite/src/keyexchange.dart';
+import 'package:tlslite/src/utils/cryptomath.dart';
+
+void main() {
+  group('FfdheContext', () {
+    test('uses the RFC 7919 exponent sizes', () {
+      expect(
+        [for (final group in rfc7919Groups) FfdheContext.exponentBitsFor(group.prime)],
+        [225, 275, 325, 375, 400],
+      );
+    });
+
+    test('caches one context per group', () {
+      final a = FfdheContext.of(ffdhe2048.generator, ffdhe2048.prime);
+      final b = FfdheContext.of(ffdhe2048.generator, ffdhe2048.prime);
+      expect(identical(a, b), isTrue);
+      expect(identical(a, FfdheContext.of(ffdhe3072.generator, ffdhe3072.prime)),
+          isFalse);
+    });
+
+    test('comb and peer exponentiation match modPow', () {
+      final context = FfdheContext.of(ffdhe2048.generator, ffdhe2048.prime);
+      final prime = ffdhe2048.prime;
+      for (var i = 0; i < 4; i++) {
+        final x = context.randomExponent();
+        expect(x.bitLength, lessThanOrEqualTo(context.exponentBits));
+        final y = context.publicValue(x);
+        expect(y, ffdhe2048.generator.modPow(x, prime));
+        final peer = bytesToNumber(getRandomBytes(256)) % prime;
+        expect(context.sharedSecret(peer, x), peer.modPow(x, prime));
+      }
+      // Exponents longer than the comb fall back to the generic path.
+      final long = (BigInt.one << 1000) + BigInt.from(12345);
+      expect(context.publicValue(long), ffdhe2048.generator.modPow(long, prime));
+    });
+
+    test('custom groups use the portable engine', () {
+      final prime = (BigInt.one << 521) - BigInt.one;
+      final context = FfdheContext.of(BigInt.from(3), prime);
+      expect(context.usesNativeKernel, isFalse);
+      expect(identical(context, FfdheContext.of(BigInt.from(3), prime)), isTrue);
+      final x = context.randomExponent();
+      expect(context.publicValue(x), BigInt.from(3).modPow(x, prime));
+    });
+  });
+
+  group('FFDHKeyExchange on FfdheContext', () {
+    test('both sides agree on ffdhe3072', () {
+      final client = FFDHKeyExchange(tls_constants.GroupName.ffdhe3072, (3, 4));
+      final server = FFDHKeyExchange(tls_constants.GroupName.ffdhe3072, (3, 4));
+      final a = client.getRandomPrivateKey();
+      final b = server.getRandomPrivateKey();
+      final shareA = client.calcPublicValue(a);
+      final shareB = server.calcPublicValue(b);
+      expect(client.calcSharedKey(a, shareB), server.calcSharedKey(b, shareA));
+    });
+
+    test('rejects an even prime', () {
+      expect(
+        () => FFDHKeyExchange(0, (3, 3),
+            generator: BigInt.two, prime: ffdhe2048.prime + BigInt.one),
+        throwsA(isA<TLSIllegalParameterException>()),
+      );
+    });
+  });
+}
@@ -1,4 +1,5 @@
 import 'dart:typed_data';
+import 'package:crypto/crypto.dart' as crypto;
 import 'package:test/test.dart';
 import 'package:tlslite/src/handshake_hashes.dart';
 
@@ -213,5 +214,68 @@ void main() {
       
       expect(digest.length, equals(32));
     });
+
+    test('digest matches one-shot hash after many incremental updates', () {
+      final hashes = HandshakeHashes();
+      final transcript = <int>[];
+      for (var i = 0; i < 50; i++) {
+        final msg = Uint8List.fromList(List.generate(97 + i, (j) => i ^ j));
+        hashes.update(msg);
+        transcript.addAll(msg);
+        // Interleave digest() calls as a TLS 1.3 key schedule does.
+        expect(hashes.digest('sha256'),
+            equals(crypto.sha256.convert(transcript).bytes));
+      }
+      expect(hashes.digest('sha384'),
+          equals(crypto.sha384.convert(transcript).bytes));
+      expect(hashes.digest('intrinsic'), equals(transcript));
+    });
+
+    test('replaceWith clones state instead of sharing it', () {
+      final source = HandshakeHashes();
+      source.update(Uint8List.fromList([1, 2, 3]));
+      final target = HandshakeHashes();
+      target.update(Uint8List.fromList([9, 9, 9]));
+
+      target.replaceWith(source);
+      source.update(Uint8List.fromList([4]));
+
+      expect(target.digest('sha256'),
+          equals(crypto.sha256.convert([1, 2, 3]).bytes));
+      expect(target.digest('intrinsic'), equals([1, 2, 3]));
+    });
+
+    test('deferred transcript buffers until retainOnly', () {
+      final hashes = HandshakeHashes(deferred: true);
+      expect(hashes.isDeferred, isTrue);
+      expect(hashes.retainedDigests, isEmpty);
+
+      hashes.update(Uint8List.fromList([1, 2, 3]));
+      expect(hashes.digest('sha384'),
+          equals(crypto.sha384.convert([1, 2, 3]).bytes));
+
+      hashes.retainOnly(['sha256']);
+      hashes.update(Uint8List.fromList([4, 5]));
+
+      expect(hashes.isDeferred, isFalse);
+      expect(hashes.retainedDigests, equals(['sha256']));
+      expect(hashes.retainsIntrinsic, isFalse);
+      expect(hashes.digest('sha256'),
+          equals(crypto.sha256.convert([1, 2, 3, 4, 5]).bytes));
+      expect(() => hashes.digest('sha384'), throwsStateError);
+      expect(() => hashes.digest('intrinsic'), throwsStateError);
+    });
+
+    test('retainOnly can keep the raw transcript for EdDSA', () {
+      final hashes = HandshakeHashes(deferred: true);
+      hashes.update(Uint8List.fromList([7, 8]));
+      hashes.retainOnly(['md5', 'sha1'], keepIntrinsic: true);
+      hashes.update(Uint8List.fromList([9]));
+
+      final copy = hashes.copy();
+      expect(copy.digest('intrinsic'), equals([7, 8, 9]));
+      expect(copy.digest(), equals(hashes.digest()));
+      expect(copy.digest('md5'), equals(crypto.md5.convert([7, 8, 9]).bytes));
+    });
   });
 }
@@ -30,6 +30,24 @@ void main() {
       expect(() => settings.validate(), throwsArgumentError);
     });
 
+    test('cipherImplementations defaults to every backend', () {
+      final settings = HandshakeSettings();
+      expect(settings.cipherImplementations, allCipherImplementations);
+      expect(settings.copyWith(cipherImplementations: ['dart'])
+          .cipherImplementations, ['dart']);
+    });
+
+    test('unknown cipher implementation throws', () {
+      final settings =
+          HandshakeSettings(cipherImplementations: ['dart', 'openssl']);
+      expect(() => settings.validate(), throwsArgumentError);
+    });
+
+    test('empty cipherImplementations throws', () {
+      final settings = HandshakeSettings(cipherImplementations: []);
+      expect(() => settings.validate(), throwsArgumentError);
+    });
+
     test('unknown MAC name throws', () {
       final settings = HandshakeSettings(macNames: ['sha256', 'unknown_mac']);
       expect(() => settings.validate(), throwsArgumentError);
@@ -0,0 +1,101 @@
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/crypto/keccak.dart';
+import 'package:tlslite/src/experimental/keccak_x4_avx2_x86_64.dart';
+
+Uint8List _hex(String hex) => Uint8List.fromList([
+      for (var i = 0; i < hex.length; i += 2)
+        int.parse(hex.substring(i, i + 2), radix: 16)
+    ]);
+
+final Uint8List _message =
+    Uint8List.fromList(List.generate(300, (i) => (i * 7 + 3) & 0xff));
+
+void main() {
+  group('Keccak', () {
+    final abc = 'abc'.codeUnits;
+
+    test('SHA3-256 and SHA3-512 of "abc"', () {
+      expect(sha3_256(abc),
+          _hex('3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532'));
+      expect(
+          sha3_512(abc),
+          _hex('b751850b1a57168a5693cd924b6b096e08f621827444f70d884f5d0240d2712e'
+              '10e116e9192af3c91a7ec57647e3934057340b4cf408d5a56592f8274eec53f0'));
+    });
+
+    test('SHAKE of the empty message', () {
+      expect(shake128(const [], 32),
+          _hex('7f9c2ba4e88f827d616045507605853ed73b8093f6efbc88eb1a6eacfa66ef26'));
+      expect(shake256(const [], 32),
+          _hex('46b9dd2b0ba88d13233b3feb743eeb243fcd52ea62b81b82b50c27646ed5762f'));
+    });
+
+    test('multi-block absorb and squeeze', () {
+      expect(Uint8List.sublistView(shake128(_message, 400), 368),
+          _hex('c6e845e193190c3bfc9c126afbac5fb12bfac7bfcf0d87d881139cb5aa5bab5f'));
+      // Exactly one rate-sized block, so the padding goes in a block of its own.
+      expect(shake256(Uint8List.sublistView(_message, 0, 136), 32),
+          _hex('c00f43811e5b4a38e14e3c06d8a5ce34115a19cd604ce5bac6c3823b76046d5c'));
+    });
+
+    test('incremental absorb and squeeze match one shot', () {
+      final expected = shake128(_message, 500);
+      final sponge = KeccakSponge.shake128();
+      for (final (start, end) in const [(0, 1), (1, 13), (13, 200), (200, 300)]) {
+        sponge.absorb(_message, start, end);
+      }
+      final out = Uint8List(500);
+      for (final (offset, length) in const [(0, 3), (3, 165), (168, 1), (169, 331)]) {
+        sponge.squeeze(out, offset, length);
+      }
+      expect(out, expected);
+      expect(() => sponge.absorb([1]), throwsStateError);
+
+      sponge.reset();
+      sponge.absorb(_message);
+      expect(sponge.read(500), expected);
+    });
+
+    test('KeccakX4 matches independent sponges', () {
+      final inputs = [
+        for (var s = 0; s < 3; s++) Uint8List.sublistView(_message, s, 34 + s * 60)
+      ];
+      final x4 = KeccakX4.shake128()..absorbAll(inputs);
+      final outs = [for (var s = 0; s < 3; s++) Uint8List(168 * 3)];
+      x4.squeezeBlocks(outs, 2);
+      x4.squeezeBlocks(outs, 1, 168 * 2);
+      for (var s = 0; s < 3; s++) {
+        expect(outs[s], shake128(inputs[s], 168 * 3));
+      }
+    });
+
+    test('AVX2 four-lane permutation matches keccakF1600', () {
+      if (!KeccakX4Avx2.isSupported) {
+        print('Skipping test - AVX2 not available');
+        return;
+      }
+      final states = [
+        for (var s = 0; s < 4; s++)
+          Uint64List.fromList(
+              List.generate(25, (i) => (i + 1) * 0x9e3779b97f4a7c15 ^ s))
+      ];
+      final wide = Uint64List(100);
+      for (var i = 0; i < 25; i++) {
+        for (var s = 0; s < 4; s++) {
+          wide[4 * i + s] = states[s][i];
+        }
+      }
+      for (var pass = 0; pass < 3; pass++) {
+        KeccakX4Avx2.permute(wide);
+        for (final state in states) {
+          keccakF1600(state);
+        }
+      }
+      for (var s = 0; s < 4; s++) {
+        expect([for (var i = 0; i < 25; i++) wide[4 * i + s]], states[s]);
+      }
+    });
+  });
+}
@@ -6,6 +6,11 @@ import 'package:tlslite/src/handshake_hashes.dart';
 import 'package:tlslite/src/mathtls.dart';
 import 'package:tlslite/src/utils/cryptomath.dart';
 
+Uint8List _hex(String hex) => Uint8List.fromList([
+      for (var i = 0; i < hex.length; i += 2)
+        int.parse(hex.substring(i, i + 2), radix: 16)
+    ]);
+
 void main() {
   group('PRF functions', () {
     test('pHash produces expected output for short input', () {
@@ -62,6 +67,82 @@ void main() {
     });
   });
 
+  group('TlsPrf', () {
+    final label = 'test label'.codeUnits;
+
+    test('TLS 1.2 SHA256 known answer', () {
+      final prf = TlsPrf([3, 3], CipherSuite.TLS_RSA_WITH_AES_128_CBC_SHA256,
+          _hex('9bbe436ba940f017b17652849a71db35'));
+      expect(
+          prf.expand(label, _hex('a0ba9f936cda311827a6f796ffd5198c'), 100),
+          _hex('e3f229ba727be17b8d122620557cd453c2aab21d07c3d495329b52d4e61edb5a'
+              '6b301791e90d35c9c9a46b4e14baf9af0fa022f7077def17abfd3797c0564bab'
+              '4fbc91666e9def9b97fce34f796789baa48082d122ee42c5a72e5a5110fff701'
+              '87347b66'));
+    });
+
+    test('TLS 1.2 SHA384 known answer', () {
+      final prf = TlsPrf([3, 3], CipherSuite.TLS_RSA_WITH_AES_256_GCM_SHA384,
+          _hex('b80b733d6ceefcdc71566ea48e5567df'));
+      final out = prf.expand(label, _hex('cd665cf6a8447dd6ff8b27555edb7465'), 148);
+      expect(out.sublist(0, 32),
+          _hex('7b0c18e9ced410ed1804f2cfa34a336a1c14dffb4900bb5fd7942107e81c83cd'));
+      expect(out.sublist(116),
+          _hex('a9a69236a3e52655c9e9aee691c8f3a26854308d5eaa3be85e0990703d73e56f'));
+    });
+
+    test('TLS 1.0 splits an odd-length secret', () {
+      final prf = TlsPrf([3, 1], 0, List<int>.generate(7, (i) => i + 1));
+      expect(
+          prf.expand('lbl'.codeUnits, 'xyz'.codeUnits, 40),
+          _hex('8421a5e3ebc607a27eb883d9656e41821826bb9e636106462808cdb266a4be60'
+              '9ad3c127cf6d8278'));
+    });
+
+    test('split seeds match concatenated seeds', () {
+      final secret = Uint8List.fromList(List.generate(48, (i) => i));
+      final clientRandom = Uint8List.fromList(List.generate(32, (i) => i + 1));
+      final serverRandom = Uint8List.fromList(List.generate(32, (i) => i + 101));
+      for (final version in [
+        [3, 1],
+        [3, 3],
+      ]) {
+        final prf = TlsPrf(version, 0, secret);
+        expect(
+            prf.keyBlock(clientRandom, serverRandom, 104),
+            calcKey(version, secret, 0, 'key expansion'.codeUnits,
+                clientRandom: clientRandom,
+                serverRandom: serverRandom,
+                outputLength: 104));
+        expect(prf.masterSecret(clientRandom, serverRandom),
+            calcMasterSecret(version, 0, secret, clientRandom, serverRandom));
+      }
+    });
+
+    test('verify_data and extended master secret use the transcript', () {
+      final hashes = HandshakeHashes()
+        ..update(Uint8List.fromList('client hello'.codeUnits));
+      final secret = Uint8List.fromList(List.generate(48, (i) => 0x20 + i));
+      for (final version in [
+        [3, 2],
+        [3, 3],
+      ]) {
+        final prf = TlsPrf(version, 0, secret);
+        expect(prf.verifyData(hashes, true),
+            calcFinished(version, secret, 0, hashes, true));
+        expect(prf.verifyData(hashes, false),
+            calcFinished(version, secret, 0, hashes, false));
+        expect(prf.extendedMasterSecret(hashes),
+            calcExtendedMasterSecret(version, 0, secret, hashes));
+      }
+    });
+
+    test('rejects SSL 3.0 and TLS 1.3', () {
+      expect(() => TlsPrf([3, 0], 0, Uint8List(48)), throwsArgumentError);
+      expect(() => TlsPrf([3, 4], 0, Uint8List(48)), throwsArgumentError);
+    });
+  });
+
   group('calcMasterSecret', () {
     test('TLS 1.0 master secret derivation', () {
       final premasterSecret = Uint8List(48)..fillRange(0, 48, 0xAB);
@@ -0,0 +1,70 @@
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/constants.dart';
+import 'package:tlslite/src/parallel_record_sealer.dart';
+import 'package:tlslite/src/tls_protocol.dart';
+
+Uint8List _bytes(int length, int seed) =>
+    Uint8List.fromList(List.generate(length, (i) => (i * 31 + seed) & 0xff));
+
+void main() {
+  group('ParallelRecordSealer', () {
+    final cases = {
+      'TLS 1.3 AES-128-GCM': RecordSealParams(
+        cipherSuite: CipherSuite.TLS_AES_128_GCM_SHA256,
+        key: _bytes(16, 1),
+        fixedNonce: _bytes(12, 2),
+        recordVersion: const TlsProtocolVersion(3, 3),
+        version: const TlsProtocolVersion(3, 4),
+        tls13: true,
+      ),
+      'TLS 1.2 AES-128-GCM': RecordSealParams(
+        cipherSuite: CipherSuite.TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256,
+        key: _bytes(16, 3),
+        fixedNonce: _bytes(4, 4),
+        recordVersion: const TlsProtocolVersion(3, 3),
+        version: const TlsProtocolVersion(3, 3),
+        tls13: false,
+      ),
+    };
+
+    cases.forEach((name, params) {
+      test('$name matches sequential sealing', () async {
+        final sealer = await ParallelRecordSealer.start(params, workers: 3);
+        addTearDown(sealer.close);
+
+        final records = [
+          for (var i = 0; i < 7; i++) _bytes(100 + 37 * i, i),
+        ];
+        final sealed = await sealer.seal(
+            41, ContentType.application_data, records);
+        final parallel = BytesBuilder(copy: false);
+        sealed.forEach(parallel.add);
+
+        final state = params.createState();
+        final sequential = BytesBuilder();
+        for (var i = 0; i < records.length; i++) {
+          final out = Uint8List(records[i].length + 64);
+          final length = state.sealRecord(
+              41 + i, records[i], ContentType.application_data, out, 0,
+              recordVersion: params.recordVersion,
+              version: params.version,
+              tls13: params.tls13);
+          sequential.add(Uint8List.sublistView(out, 0, length));
+        }
+        expect(sealed, hasLength(3));
+        expect(parallel.takeBytes(), sequential.takeBytes());
+      });
+    });
+
+    test('seal fails after close', () async {
+      final sealer =
+          await ParallelRecordSealer.start(cases.values.first, workers: 1);
+      await sealer.close();
+      expect(
+          () => sealer.seal(0, ContentType.application_data, [Uint8List(1)]),
+          throwsStateError);
+    });
+  });
+}
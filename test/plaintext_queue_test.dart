@@ -0,0 +1,72 @@
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/plaintext_queue.dart';
+
+Uint8List _range(int start, int length) =>
+    Uint8List.fromList(List.generate(length, (i) => start + i));
+
+void main() {
+  group('PlaintextQueue', () {
+    late PlaintextQueue queue;
+    late Uint8List first;
+
+    setUp(() {
+      queue = PlaintextQueue();
+      first = _range(0, 5);
+      queue
+        ..add(first)
+        ..add(Uint8List(0))
+        ..add(_range(5, 3))
+        ..add(_range(8, 4));
+    });
+
+    test('tracks the buffered length', () {
+      expect(queue.length, 12);
+      expect(queue.toBytes(), _range(0, 12));
+      expect(queue.length, 12);
+    });
+
+    test('take within the head record is a view', () {
+      final chunk = queue.take(3);
+      expect(chunk, _range(0, 3));
+      expect(chunk.buffer, same(first.buffer));
+      expect(queue.length, 9);
+      expect(queue.take(2), _range(3, 2));
+    });
+
+    test('take across records copies in order', () {
+      queue.take(4);
+      expect(queue.take(6), _range(4, 6));
+      expect(queue.take(100), _range(10, 2));
+      expect(queue.isEmpty, isTrue);
+      expect(queue.take(1), isEmpty);
+    });
+
+    test('takeChunk yields record-sized views', () {
+      queue.take(2);
+      expect(queue.takeChunk(), _range(2, 3));
+      expect(queue.takeChunk(2), _range(5, 2));
+      expect(queue.takeChunk(), _range(7, 1));
+      expect(queue.takeChunk(), _range(8, 4));
+      expect(queue.takeChunk(), isEmpty);
+    });
+
+    test('copyInto fills the buffer from the offset', () {
+      final buffer = Uint8List(10);
+      expect(queue.copyInto(buffer, 1), 9);
+      expect(Uint8List.sublistView(buffer, 1), _range(0, 9));
+      expect(queue.copyInto(buffer), 3);
+      expect(Uint8List.sublistView(buffer, 0, 3), _range(9, 3));
+      expect(queue.copyInto(buffer), 0);
+    });
+
+    test('clear drops everything', () {
+      queue.take(1);
+      queue.clear();
+      expect(queue.isEmpty, isTrue);
+      queue.add(_range(20, 2));
+      expect(queue.take(2), _range(20, 2));
+    });
+  });
+}
@@ -29,6 +29,82 @@ void main() {
       expect(() => cache[ids.first], throwsStateError);
       expect(cache[ids.last], same(sessions.last));
     });
+
+    test('reinserting an id replaces the entry without duplicates', () {
+      final cache = SessionCache(maxEntries: 2, maxAgeSeconds: 3600);
+      final id = Uint8List.fromList([1, 2, 3]);
+      final other = Uint8List.fromList([4]);
+      cache[id] = _session(id);
+      final replacement = _session(id);
+      cache[id] = replacement;
+      cache[other] = _session(other);
+
+      expect(cache.length, 2);
+      expect(cache[[1, 2, 3]], same(replacement));
+      expect(cache.stats.evictions, 0);
+    });
+
+    test('expires entries by age and reclaims them from the wheel', () {
+      var now = 1000;
+      final cache =
+          SessionCache(maxEntries: 100, maxAgeSeconds: 10, clock: () => now);
+      final early = Uint8List.fromList([1]);
+      final later = Uint8List.fromList([2]);
+      cache[early] = _session(early);
+      now += 6000;
+      cache[later] = _session(later);
+
+      now += 4000;
+      expect(cache.getOrNull(early), isNull);
+      expect(cache.getOrNull(later), isNotNull);
+
+      now += 7000;
+      expect(cache.getOrNull(later), isNull);
+      expect(cache.length, 0);
+      expect(cache.stats.expirations, 2);
+    });
+
+    test('counts hits, misses and evictions', () {
+      final cache = SessionCache(maxEntries: 1, maxAgeSeconds: 3600);
+      final a = Uint8List.fromList([0xaa]);
+      final b = Uint8List.fromList([0xbb]);
+      cache[a] = _session(a);
+      cache.getOrNull(a);
+      cache[b] = _session(b);
+      cache.getOrNull(a);
+
+      final stats = cache.stats;
+      expect(stats.hits, 1);
+      expect(stats.misses, 1);
+      expect(stats.evictions, 1);
+      expect(stats.length, 1);
+    });
+
+    test('spreads large caches over shards', () {
+      final cache = SessionCache(maxEntries: 10000, shards: 16);
+      expect(cache.shardCount, 16);
+      expect(SessionCache(maxEntries: 10).shardCount, 1);
+
+      final ids = List.generate(
+          2000, (i) => Uint8List.fromList([i >> 8, i & 0xff, 7, 7]));
+      for (final id in ids) {
+        cache[id] = _session(id);
+      }
+      expect(cache.length, ids.length);
+      for (final id in ids) {
+        expect(cache.getOrNull(id)!.sessionID, equals(id));
+      }
+    });
+
+    test('sharded capacity adds up to maxEntries', () {
+      final cache = SessionCache(maxEntries: 4097, shards: 16);
+      expect(cache.shardCount, 16);
+      for (var i = 0; i < 20000; i++) {
+        final id = Uint8List.fromList([i >> 8, i & 0xff, 9]);
+        cache[id] = _session(id);
+      }
+      expect(cache.length, 4097);
+    });
   });
 }
 
@@ -0,0 +1,125 @@
+import 'dart:io' as io;
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/signature_cache.dart';
+import 'package:tlslite/src/utils/eddsakey.dart';
+import 'package:tlslite/src/x509.dart';
+import 'package:tlslite/src/x509certchain.dart';
+
+X509 _load(String name) =>
+    X509()..parse(io.File('test/certificates/$name').readAsStringSync());
+
+DartEdDSAKey _key(int seed) => DartEdDSAKey.ed25519(
+    privateKey: Uint8List.fromList(List<int>.filled(32, seed)));
+
+void main() {
+  group('SignatureVerificationCache', () {
+    final key = _key(1);
+
+    bool check(SignatureVerificationCache cache, int id, bool Function() fn,
+            {Object? publicKey}) =>
+        cache.verify(
+          publicKey: publicKey ?? key,
+          algorithm: [4],
+          signedData: [id],
+          signature: [5, 6],
+          verifier: fn,
+        );
+
+    test('runs the verifier once per signature', () {
+      final cache = SignatureVerificationCache();
+      var calls = 0;
+      bool verifier() {
+        calls++;
+        return true;
+      }
+
+      expect(check(cache, 1, verifier), isTrue);
+      expect(check(cache, 1, verifier), isTrue);
+      expect(calls, 1);
+      expect(check(cache, 2, verifier), isTrue);
+      expect(calls, 2);
+      expect(cache.length, 2);
+    });
+
+    test('entries belong to the key that verified them', () {
+      final cache = SignatureVerificationCache();
+      var calls = 0;
+      bool verifier() {
+        calls++;
+        return true;
+      }
+
+      check(cache, 1, verifier);
+      check(cache, 1, verifier, publicKey: _key(2));
+      expect(calls, 2);
+      check(cache, 1, verifier, publicKey: _key(1));
+      expect(calls, 2);
+    });
+
+    test('does not remember failures', () {
+      final cache = SignatureVerificationCache();
+      var calls = 0;
+      bool verifier() {
+        calls++;
+        return false;
+      }
+
+      expect(check(cache, 1, verifier), isFalse);
+      expect(check(cache, 1, verifier), isFalse);
+      expect(calls, 2);
+      expect(cache.length, 0);
+    });
+
+    test('evicts the least recently used entry', () {
+      final cache = SignatureVerificationCache(maxEntries: 2);
+      var calls = 0;
+      bool verifier() {
+        calls++;
+        return true;
+      }
+
+      check(cache, 1, verifier);
+      check(cache, 2, verifier);
+      check(cache, 1, verifier);
+      check(cache, 3, verifier);
+      expect(calls, 3);
+      expect(cache.length, 2);
+      check(cache, 1, verifier);
+      expect(calls, 3);
+      check(cache, 2, verifier);
+      expect(calls, 4);
+    });
+  });
+
+  group('certificate signatures', () {
+    test('verifyIssuedBy memoizes a valid signature', () {
+      final cert = _load('serverEd25519Cert.pem');
+      final cache = SignatureVerificationCache();
+      expect(cert.verifyIssuedBy(cert, cache: cache), isTrue);
+      expect(cache.length, 1);
+      expect(cert.verifyIssuedBy(cert, cache: cache), isTrue);
+      expect(cache.length, 1);
+
+      final forged = _load('serverEd25519Cert.pem');
+      forged.signatureValue = Uint8List.fromList(forged.signatureValue!)
+        ..[10] ^= 1;
+      expect(forged.verifyIssuedBy(cert, cache: cache), isFalse);
+      expect(cache.length, 1);
+    });
+
+    test('X509CertChain.verifySignatures checks every link', () {
+      final cert = _load('serverEd25519Cert.pem');
+      final cache = SignatureVerificationCache();
+      expect(X509CertChain([cert, cert]).verifySignatures(cache: cache),
+          isTrue);
+      expect(cache.length, 1);
+
+      final other = _load('clientEd25519Cert.pem');
+      expect(X509CertChain([cert, other]).verifySignatures(cache: cache),
+          isFalse);
+      expect(X509CertChain([cert]).verifySignatures(cache: cache), isTrue);
+    });
+  });
+}
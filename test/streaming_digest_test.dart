@@ -0,0 +1,79 @@
+import 'dart:typed_data';
+
+import 'package:crypto/crypto.dart' as crypto;
+import 'package:test/test.dart';
+import 'package:tlslite/src/crypto/streaming_digest.dart';
+
+final Map<String, crypto.Hash> _reference = {
+  'md5': crypto.md5,
+  'sha1': crypto.sha1,
+  'sha224': crypto.sha224,
+  'sha256': crypto.sha256,
+  'sha384': crypto.sha384,
+  'sha512': crypto.sha512,
+};
+
+Uint8List _pattern(int length) {
+  final data = Uint8List(length);
+  for (var i = 0; i < length; i++) {
+    data[i] = (i * 31 + 7) & 0xff;
+  }
+  return data;
+}
+
+void main() {
+  group('StreamingDigest', () {
+    for (final entry in _reference.entries) {
+      final name = entry.key;
+      final reference = entry.value;
+
+      test('$name matches package:crypto across block boundaries', () {
+        for (final length in [0, 1, 55, 56, 63, 64, 65, 111, 112, 127, 128,
+            129, 1000]) {
+          final data = _pattern(length);
+          final digest = StreamingDigest(name)..update(data);
+          expect(digest.digest(), equals(reference.convert(data).bytes),
+              reason: 'length $length');
+        }
+      });
+
+      test('$name handles uneven chunks and plain lists', () {
+        final data = _pattern(777);
+        final digest = StreamingDigest(name);
+        var offset = 0;
+        var step = 1;
+        while (offset < data.length) {
+          final end =
+              offset + step < data.length ? offset + step : data.length;
+          digest.update(data.sublist(offset, end).toList());
+          offset = end;
+          step = step * 3 % 97 + 1;
+        }
+        expect(digest.digest(), equals(reference.convert(data).bytes));
+        expect(digest.length, equals(data.length));
+      });
+
+      test('$name copy and digest leave the source state intact', () {
+        final first = _pattern(300);
+        final second = _pattern(50);
+        final digest = StreamingDigest(name)..update(first);
+        final snapshot = digest.copy();
+        expect(digest.digest(), equals(reference.convert(first).bytes));
+
+        digest.update(second);
+        expect(snapshot.digest(), equals(reference.convert(first).bytes));
+        expect(digest.digest(),
+            equals(reference.convert([...first, ...second]).bytes));
+
+        snapshot.replaceWith(digest);
+        expect(snapshot.digest(), equals(digest.digest()));
+      });
+    }
+
+    test('rejects unknown algorithms', () {
+      expect(() => StreamingDigest('sha3_256'), throwsArgumentError);
+      expect(StreamingDigest.isSupported('SHA256'), isTrue);
+      expect(StreamingDigest.isSupported('whirlpool'), isFalse);
+    });
+  });
+}
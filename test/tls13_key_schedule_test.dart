@@ -0,0 +1,88 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/tls13_key_schedule.dart';
+import 'package:tlslite/src/utils/cryptomath.dart';
+
+Uint8List _hex(String hex) => Uint8List.fromList([
+      for (var i = 0; i < hex.length; i += 2)
+        int.parse(hex.substring(i, i + 2), radix: 16)
+    ]);
+
+void main() {
+  // RFC 8448, section 3 (Simple 1-RTT Handshake).
+  group('Tls13KeySchedule', () {
+    final sharedSecret = _hex(
+        '8bd4054fb55b9d63fdfbacf9f04b9f0d35e6d63f537563efd46272900f89492d');
+    final helloHash = _hex(
+        '860c06edc07858ee8e78f0e7428c58edd6b43f2ca3e6e95f02ed063cf0e1cad8');
+
+    test('RFC 8448 handshake secrets and traffic keys', () {
+      final schedule = Tls13KeySchedule('sha256');
+      expect(schedule.earlySecret,
+          _hex('33ad0a1c607ec03b09e6cd9893680ce210adf300aa1f2660e1b22e10f170f92a'));
+      expect(schedule.deriveHandshakeSecret(sharedSecret),
+          _hex('1dc826e93606aa6fdc0aadc12f741b01046aa6b99f691ed221a9f0ca043fbeac'));
+
+      final (client, _) = schedule.handshakeTrafficSecrets(helloHash);
+      expect(client,
+          _hex('b3eddb126e067f35a780b3abf45e2d8f3b1a950738f52e9600746a0e27a55a21'));
+      expect(schedule.hkdf.trafficKey(client, 16),
+          _hex('dbfaa693d1762c5b666af5d950258d01'));
+      expect(schedule.hkdf.trafficIv(client),
+          _hex('5bd3c71b836e0b76bb73265f'));
+
+      expect(schedule.deriveMasterSecret(),
+          _hex('18df06843d13a08bf2a449844c5f8a478001bc4d4c627984d5a41da8d0402919'));
+    });
+
+    test('master secret requires the handshake secret', () {
+      expect(() => Tls13KeySchedule('sha256').deriveMasterSecret(),
+          throwsStateError);
+    });
+  });
+
+  group('Tls13Hkdf', () {
+    for (final hashName in ['sha256', 'sha384']) {
+      test('$hashName matches HKDF_expand_label', () {
+        final hkdf = Tls13Hkdf.of(hashName);
+        final secret = Uint8List.fromList(
+            List.generate(hkdf.hashLength, (i) => i * 7 + 1));
+        final context = Uint8List.fromList(List.generate(hkdf.hashLength, (i) => i));
+        // Called twice so the second round runs on the cached keyed state.
+        for (var round = 0; round < 2; round++) {
+          for (final (label, ctx, length) in [
+            ('key', Uint8List(0), 32),
+            ('iv', Uint8List(0), 12),
+            ('c ap traffic', context, hkdf.hashLength),
+            ('exp master', context, 100),
+          ]) {
+            final labelBytes = Uint8List.fromList(ascii.encode(label));
+            expect(hkdf.expandLabel(secret, labelBytes, ctx, length),
+                HKDF_expand_label(secret, labelBytes, ctx, length, hashName));
+          }
+          expect(hkdf.trafficKey(secret, 16),
+              HKDF_expand_label(secret, Uint8List.fromList(ascii.encode('key')),
+                  Uint8List(0), 16, hashName));
+          expect(
+              hkdf.nextTrafficSecret(secret),
+              HKDF_expand_label(
+                  secret,
+                  Uint8List.fromList(ascii.encode('traffic upd')),
+                  Uint8List(0),
+                  hkdf.hashLength,
+                  hashName));
+          final finishedKey = HKDF_expand_label(
+              secret,
+              Uint8List.fromList(ascii.encode('finished')),
+              Uint8List(0),
+              hkdf.hashLength,
+              hashName);
+          expect(hkdf.finishedVerifyData(secret, context),
+              secureHMAC(finishedKey, context, hashName));
+        }
+      });
+    }
+  });
+}
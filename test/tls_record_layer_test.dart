@@ -334,6 +334,92 @@ void main() {
       // Should complete without error
       await layer.write(Uint8List(0));
     });
+
+    test('cork holds records back until uncork sends them together',
+        () async {
+      final harness = await _TlsRecordLayerHarness.create();
+      addTearDown(() => harness.dispose());
+
+      final received = BytesBuilder();
+      final subscription = harness.peerInput.listen(received.add);
+      addTearDown(subscription.cancel);
+
+      final layer = harness.recordLayer;
+      layer.handshakeStart(client: true);
+      layer.handshakeDone(false);
+      layer.version = const TlsProtocolVersion(3, 3);
+      layer.recordSize = 4;
+
+      layer.cork();
+      expect(layer.corked, isTrue);
+      await layer.write(Uint8List.fromList([1, 2, 3]));
+      await layer.write(Uint8List.fromList([4, 5, 6, 7, 8]));
+      await Future<void>.delayed(const Duration(milliseconds: 50));
+      expect(received.length, 0);
+
+      await layer.uncork();
+      expect(layer.corked, isFalse);
+      while (received.length < 3 * 5 + 8) {
+        await Future<void>.delayed(const Duration(milliseconds: 10));
+      }
+      expect(received.takeBytes(), [
+        ContentType.application_data, 3, 3, 0, 3, 1, 2, 3, //
+        ContentType.application_data, 3, 3, 0, 4, 4, 5, 6, 7, //
+        ContentType.application_data, 3, 3, 0, 1, 8,
+      ]);
+    });
+
+    test('parallel sealing keeps concurrent writes in sequence order',
+        () async {
+      final harness = await _TlsRecordLayerHarness.create();
+      addTearDown(() => harness.dispose());
+
+      final masterSecret =
+          Uint8List.fromList(List.generate(48, (i) => i * 3 + 1));
+      final clientRandom = Uint8List.fromList(List.filled(32, 0x11));
+      final serverRandom = Uint8List.fromList(List.filled(32, 0x22));
+      const suite = CipherSuite.TLS_ECDHE_RSA_WITH_AES_128_GCM_SHA256;
+
+      final writer = harness.recordLayer;
+      writer.handshakeStart(client: true);
+      writer.version = const TlsProtocolVersion(3, 3);
+      writer.calcPendingStates(
+          suite, masterSecret, clientRandom, serverRandom);
+      writer.changeWriteState();
+      writer.handshakeDone(false);
+      writer.recordSize = 1024;
+      writer.enableParallelSealing(workers: 2);
+      addTearDown(writer.disableParallelSealing);
+
+      final reader = harness.createPeerRecordLayer();
+      reader.handshakeStart(client: false);
+      reader.version = const TlsProtocolVersion(3, 3);
+      reader.calcPendingStates(
+          suite, masterSecret, clientRandom, serverRandom);
+      reader.changeReadState();
+      reader.handshakeDone(false);
+
+      // Both are over the parallel threshold (8 records of 1024 bytes)
+      // and span several worker windows.
+      final first =
+          Uint8List.fromList(List.generate(40000, (i) => (i * 7) & 0xff));
+      final second =
+          Uint8List.fromList(List.generate(20500, (i) => (i * 13 + 5) & 0xff));
+      await Future.wait([writer.write(first), writer.write(second)]);
+      // Sealed on the sequential path with the next write sequence number.
+      final tail = Uint8List.fromList([1, 2, 3]);
+      await writer.write(tail);
+
+      // The reader authenticates each record against its own read
+      // sequence number, which goes up by one per record, so every
+      // record must carry exactly the next number for this to succeed.
+      final expected = [...first, ...second, ...tail];
+      final received = BytesBuilder();
+      while (received.length < expected.length) {
+        received.add(await reader.read());
+      }
+      expect(received.takeBytes(), expected);
+    });
   });
 
   group('TLSRecordLayer compatibility wrappers', () {
@@ -610,6 +696,12 @@ class _TlsRecordLayerHarness {
     );
   }
 
+  /// Bytes the record layer sent, as seen by the peer.
+  Stream<Uint8List> get peerInput => _clientSocket;
+
+  /// A record layer on the peer's end of the socket pair.
+  TLSRecordLayer createPeerRecordLayer() => TLSRecordLayer(_clientSocket);
+
   /// Send raw bytes from the client side (peer).
   void sendFromPeer(Uint8List data) {
     _clientSocket.add(data);
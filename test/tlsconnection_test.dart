@@ -1,4 +1,5 @@
 import 'dart:collection';
+import 'dart:convert';
 import 'dart:io';
 import 'dart:typed_data';
 
@@ -15,6 +16,7 @@ import 'package:tlslite/src/mathtls.dart';
 import 'package:tlslite/src/tls_extensions.dart';
 import 'package:tlslite/src/recordlayer.dart';
 import 'package:tlslite/src/session.dart';
+import 'package:tlslite/src/tls13_key_schedule.dart';
 import 'package:tlslite/src/sessioncache.dart';
 import 'package:tlslite/src/tls_protocol.dart';
 import 'package:tlslite/src/tls_connection.dart';
@@ -979,6 +981,60 @@ void main() {
       expect(cached!.tls13Tickets, hasLength(2));
     });
   });
+
+  group('TlsConnection TLS 1.3 client PSK key schedule', () {
+    // The client offers the external PSK at index 0 and the ticket at 1.
+    test('ticket resumption derives the PSK from the ticket nonce', () async {
+      final harness = await _TlsConnectionHarness.create();
+      addTearDown(() async => harness.dispose());
+      final conn = harness.connection;
+
+      // Stops at EncryptedExtensions: nothing else is queued.
+      await expectLater(_resumeWithPsk(conn, 1), throwsStateError);
+
+      final ticket = conn.session.tls13Tickets.single;
+      final psk = HKDF_expand_label(
+          _resumptionSecret,
+          Uint8List.fromList(ascii.encode('resumption')),
+          ticket.ticketNonce,
+          32,
+          'sha256');
+      expect(conn.session.clHandshakeSecret,
+          equals(_expectedClientHandshakeSecret(conn, psk)));
+      expect(conn.session.clHandshakeSecret,
+          isNot(equals(_expectedClientHandshakeSecret(conn, _resumptionSecret))));
+    });
+
+    test('external PSK uses the configured secret', () async {
+      final harness = await _TlsConnectionHarness.create();
+      addTearDown(() async => harness.dispose());
+      final conn = harness.connection;
+
+      await expectLater(_resumeWithPsk(conn, 0), throwsStateError);
+
+      expect(conn.session.clHandshakeSecret,
+          equals(_expectedClientHandshakeSecret(conn, _externalPsk.secret)));
+    });
+
+    test('unknown selected identity is an illegal parameter', () async {
+      final harness = await _TlsConnectionHarness.create();
+      addTearDown(() async => harness.dispose());
+      final conn = harness.connection;
+
+      await expectLater(_resumeWithPsk(conn, 2),
+          throwsA(isA<TLSIllegalParameterException>()));
+
+      final alert = conn.sentRecords.last;
+      expect(alert.contentType, ContentType.alert);
+      expect(
+          alert.data,
+          equals(Uint8List.fromList([
+            AlertLevel.fatal,
+            AlertDescription.illegal_parameter,
+          ])));
+      expect(conn.session.clHandshakeSecret, isEmpty);
+    });
+  });
 }
 
 class _TlsConnectionHarness {
@@ -1134,3 +1190,69 @@ TlsNewSessionTicket _newSessionTicket() {
     extensions: Uint8List(0),
   );
 }
+
+final Uint8List _resumptionSecret =
+    Uint8List.fromList(List<int>.filled(32, 0x05));
+
+final PskConfig _externalPsk = PskConfig(
+  identity: const <int>[0xAA, 0xBB],
+  secret: List<int>.filled(32, 0x42),
+);
+
+final Uint8List _serverKeySharePrivate =
+    Uint8List.fromList(List<int>.generate(32, (i) => i + 0x40));
+
+/// Runs [TlsConnection.handshakeClient] offering [_externalPsk] and one
+/// ticket, against a ServerHello that selects [selectedIdentity].
+Future<void> _resumeWithPsk(_FakeTlsConnection conn, int selectedIdentity) {
+  final kex = ECDHKeyExchange(GroupName.x25519, (3, 4));
+  _queueHandshakeMessage(
+    conn,
+    TlsServerHello(
+      serverVersion: TlsProtocolVersion.tls12,
+      random: Uint8List.fromList(List<int>.filled(32, 0x44)),
+      sessionId: Uint8List(32),
+      cipherSuite: CipherSuite.TLS_AES_128_GCM_SHA256,
+      compressionMethod: 0,
+      extensions: TlsExtensionBlock(extensions: <TlsExtension>[
+        TlsSupportedVersionsExtension.server(TlsProtocolVersion.tls13),
+        TlsKeyShareExtension.server(TlsKeyShareEntry(
+          group: GroupName.x25519,
+          keyExchange: kex.calcPublicValue(_serverKeySharePrivate),
+        )),
+        TlsServerPreSharedKeyExtension(selectedIdentity: selectedIdentity),
+      ]),
+    ),
+  );
+  final session = Session()
+    ..resumptionMasterSecret = _resumptionSecret
+    ..tls13Tickets = [_newSessionTicket()];
+  return conn.handshakeClient(
+    settings: HandshakeSettings(
+      pskConfigs: [_externalPsk],
+      keyShares: const ['x25519'],
+    ),
+    session: session,
+  );
+}
+
+/// The client handshake traffic secret [conn] should hold after the
+/// ServerHello when the early secret is keyed with [psk].
+Uint8List _expectedClientHandshakeSecret(
+    _FakeTlsConnection conn, List<int> psk) {
+  final clientHello = TlsHandshakeMessage.parseFragment(
+    conn.sentRecords.first.data,
+  ).single as TlsClientHello;
+  final keyShare = clientHello.extensions!
+      .byType(ExtensionType.key_share) as TlsKeyShareExtension;
+  final clientShare =
+      keyShare.clientShares.singleWhere((s) => s.group == GroupName.x25519);
+  final sharedSecret = ECDHKeyExchange(GroupName.x25519, (3, 4))
+      .calcSharedKey(_serverKeySharePrivate, clientShare.keyExchange);
+  final schedule =
+      Tls13KeySchedule('sha256', psk: Uint8List.fromList(psk));
+  schedule.deriveHandshakeSecret(sharedSecret);
+  final (client, _) = schedule
+      .handshakeTrafficSecrets(conn.handshakeHashes.digest('sha256'));
+  return client;
+}
@@ -0,0 +1,128 @@
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/utils/aes.dart';
+import 'package:tlslite/src/utils/aes_engine.dart';
+import 'package:tlslite/src/utils/dart_aes.dart' as dart_aes;
+import 'package:tlslite/src/utils/rijndael_slow.dart';
+
+Uint8List _hex(String hex) => Uint8List.fromList([
+      for (var i = 0; i < hex.length; i += 2)
+        int.parse(hex.substring(i, i + 2), radix: 16)
+    ]);
+
+Uint8List _bytes(int length, int seed) =>
+    Uint8List.fromList(List.generate(length, (i) => (i * 31 + seed) & 0xff));
+
+void main() {
+  group('AesEngine', () {
+    // FIPS-197, appendix C.
+    final plaintext = _hex('00112233445566778899aabbccddeeff');
+    const vectors = {
+      '000102030405060708090a0b0c0d0e0f': '69c4e0d86a7b0430d8cdb78070b4c55a',
+      '000102030405060708090a0b0c0d0e0f1011121314151617':
+          'dda97ca4864cdfe06eaf70a0ec0d7191',
+      '000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f':
+          '8ea2b7ca516745bfeafc49904b496089',
+    };
+
+    vectors.forEach((key, ciphertext) {
+      test('FIPS-197 AES-${key.length * 4}', () {
+        final engine = AesEngine(_hex(key));
+        expect(engine.encrypt(plaintext), _hex(ciphertext));
+        expect(engine.decrypt(_hex(ciphertext)), plaintext);
+      });
+    });
+
+    test('matches rijndael_slow for every key size', () {
+      for (final keyLength in [16, 24, 32]) {
+        final key = _bytes(keyLength, keyLength);
+        final engine = AesEngine(key);
+        final reference = Rijndael(Uint8List.fromList(key), blockSize: 16);
+        for (var seed = 0; seed < 8; seed++) {
+          final block = _bytes(16, seed * 7);
+          expect(engine.encrypt(block), reference.encrypt(block));
+          expect(engine.decrypt(block), reference.decrypt(block));
+        }
+      }
+    });
+
+    test('encryptBlocks and decryptBlocks work in place', () {
+      final engine = AesEngine(_bytes(32, 3));
+      final data = _bytes(16 * 9, 5);
+      final buffer = Uint8List(16 * 10)..setRange(16, 16 * 10, data);
+      engine.encryptBlocks(buffer, 16, buffer, 16, 9);
+      for (var b = 0; b < 9; b++) {
+        final block = Uint8List.sublistView(data, 16 * b, 16 * b + 16);
+        expect(Uint8List.sublistView(buffer, 16 + 16 * b, 32 + 16 * b),
+            engine.encrypt(block));
+      }
+      engine.decryptBlocks(buffer, 16, buffer, 16, 9);
+      expect(Uint8List.sublistView(buffer, 16), data);
+    });
+
+    test('ctrXor continues across calls and wraps only the counter field',
+        () {
+      final engine = AesEngine(_bytes(16, 9));
+      final start = _hex('000102030405060708090a0bfffffffe');
+      final input = _bytes(40, 1);
+
+      final whole = Uint8List(40);
+      engine.ctrXor(Uint8List.fromList(start), 4, input, whole, 0);
+
+      final counter = Uint8List.fromList(start);
+      final split = Uint8List(40);
+      engine.ctrXor(counter, 4, Uint8List.sublistView(input, 0, 16), split, 0);
+      engine.ctrXor(counter, 4, Uint8List.sublistView(input, 16), split, 16);
+      expect(split, whole);
+      expect(counter, _hex('000102030405060708090a0b00000001'));
+
+      final expected = Uint8List(48);
+      for (final (i, last) in const [
+        (0, 'fffffffe'),
+        (1, 'ffffffff'),
+        (2, '00000000'),
+      ]) {
+        expected.setRange(16 * i, 16 * i + 16,
+            engine.encrypt(_hex('000102030405060708090a0b$last')));
+      }
+      for (var i = 0; i < 40; i++) {
+        expect(whole[i], input[i] ^ expected[i]);
+      }
+    });
+  });
+
+  // NIST SP 800-38A, F.2.1 and F.5.1 (first two blocks).
+  group('dart_aes modes', () {
+    final key = _hex('2b7e151628aed2a6abf7158809cf4f3c');
+    final plaintext = _hex('6bc1bee22e409f96e93d7e117393172a'
+        'ae2d8a571e03ac9c9eb76fac45af8e51');
+
+    test('CBC', () {
+      final iv = _hex('000102030405060708090a0b0c0d0e0f');
+      final ciphertext = _hex('7649abac8119b246cee98e9b12e9197d'
+          '5086cb9b507219ee95db113a917678b2');
+      final encryptor = dart_aes.newAES(key, aesModeCBC, iv);
+      expect(encryptor.encrypt(Uint8List.sublistView(plaintext, 0, 16)),
+          Uint8List.sublistView(ciphertext, 0, 16));
+      expect(encryptor.encrypt(Uint8List.sublistView(plaintext, 16)),
+          Uint8List.sublistView(ciphertext, 16));
+      expect(dart_aes.newAES(key, aesModeCBC, iv).decrypt(ciphertext),
+          plaintext);
+    });
+
+    test('CTR', () {
+      final counter = _hex('f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff');
+      final ciphertext = _hex('874d6191b620e3261bef6864990db6ce'
+          '9806f66b7970fdff8617187bb9fffdff');
+      expect(dart_aes.newAES(key, aesModeCTR_OR_GCM, counter).encrypt(plaintext),
+          ciphertext);
+    });
+
+    test('CTR refuses to wrap the counter part', () {
+      final cipher = dart_aes.newAES(key, aesModeCTR_OR_GCM, Uint8List(15));
+      cipher.encrypt(Uint8List(16 * 254));
+      expect(() => cipher.encrypt(Uint8List(32)), throwsStateError);
+    });
+  });
+}
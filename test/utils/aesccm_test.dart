@@ -255,6 +255,23 @@ void main() {
       expect(aes.open(nonce, first, aad), equals(plaintext));
       expect(aes.open(nonce, second, aad), equals(plaintext));
     });
+
+    test('sealInto and openInPlace match seal and open', () {
+      for (final tagLength in [16, 8]) {
+        final aes = dart_aesccm.newAESCCM(Uint8List.fromList(List<int>.filled(16, 0x01)), tagLength: tagLength);
+        final nonce = Uint8List.fromList(List<int>.filled(12, 0x02));
+        final plaintext = asciiBytes('text to encrypt, a bit longer.');
+        final aad = asciiBytes('header');
+        final out = Uint8List(8 + plaintext.length + tagLength);
+        final written = aes.sealInto(nonce, plaintext, aad, out, 8);
+        expect(written, equals(plaintext.length + tagLength));
+        expect(out.sublist(8), equals(aes.seal(nonce, plaintext, aad)));
+
+        final opened = aes.openInPlace(nonce, Uint8List.sublistView(out, 8), aad);
+        expect(opened, equals(plaintext));
+        expect(out.sublist(8, 8 + plaintext.length), equals(plaintext));
+      }
+    });
   });
 }
 
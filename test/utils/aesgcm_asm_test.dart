@@ -6,6 +6,7 @@ import 'package:test/test.dart';
 
 import 'package:tlslite/src/experimental/aesgcm_asm_x86_64.dart';
 import 'package:tlslite/src/experimental/rijndael_fast_asm_x86_64.dart';
+import 'package:tlslite/src/utils/dart_aesgcm.dart' as dart_aesgcm;
 
 void main() {
   group('PclmulqdqSupport', () {
@@ -210,4 +211,60 @@ void main() {
       }
     });
   });
+
+  group('AesGcmFusedKernel', () {
+    test('coincide com AESGCM puro em vários tamanhos', () {
+      if (!AesGcmFusedKernel.isSupported) {
+        print('Pulando teste - hardware não suportado');
+        return;
+      }
+
+      for (final keyLength in [16, 32]) {
+        final key = Uint8List.fromList(List.generate(keyLength, (i) => i * 7 + 1));
+        final reference = dart_aesgcm.newAESGCM(key);
+        final kernel = AesGcmFusedKernel(key);
+        try {
+          for (final length in [0, 1, 15, 16, 17, 63, 64, 65, 100, 256, 1000]) {
+            final nonce = Uint8List.fromList(List.generate(12, (i) => i + length));
+            final aad = Uint8List.fromList(List.generate(length % 29, (i) => i ^ 0x5a));
+            final plaintext = Uint8List.fromList(List.generate(length, (i) => i * 31));
+            final expected = reference.seal(nonce, plaintext, aad);
+
+            final out = Uint8List(length + 16);
+            kernel.seal(nonce, plaintext, aad, out, 0);
+            expect(out, equals(expected), reason: 'seal key=$keyLength len=$length');
+
+            final body = Uint8List.sublistView(out, 0, length);
+            final tag = Uint8List.fromList(out.sublist(length));
+            expect(kernel.openInPlace(nonce, body, tag, aad), isTrue);
+            expect(body, equals(plaintext), reason: 'open key=$keyLength len=$length');
+          }
+        } finally {
+          kernel.dispose();
+        }
+      }
+    });
+
+    test('restaura o ciphertext quando a tag não confere', () {
+      if (!AesGcmFusedKernel.isSupported) {
+        print('Pulando teste - hardware não suportado');
+        return;
+      }
+
+      final key = Uint8List.fromList(List.generate(16, (i) => i));
+      final nonce = Uint8List.fromList(List.generate(12, (i) => i));
+      final kernel = AesGcmFusedKernel(key);
+      try {
+        final out = Uint8List(100 + 16);
+        kernel.seal(nonce, Uint8List(100), Uint8List(0), out, 0);
+        final body = Uint8List.sublistView(out, 0, 100);
+        final ciphertext = Uint8List.fromList(body);
+        final badTag = Uint8List.fromList(out.sublist(100))..[0] ^= 1;
+        expect(kernel.openInPlace(nonce, body, badTag, Uint8List(0)), isFalse);
+        expect(body, equals(ciphertext));
+      } finally {
+        kernel.dispose();
+      }
+    });
+  });
 }
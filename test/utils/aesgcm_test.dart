@@ -155,6 +155,41 @@ void main() {
       final result = aes.seal(Uint8List(12), Uint8List(16), Uint8List(0));
       expect(result, equals(hex('cea7403d4d606b6e074ec5d3baf39d18d0d1c8a799996bf0265b98b5d48ab919')));
     });
+
+    test('sealInto writes ciphertext and tag at an offset', () {
+      final aes = dart_aesgcm.newAESGCM(Uint8List.fromList(List<int>.filled(16, 0x01)));
+      final nonce = Uint8List.fromList(List<int>.filled(12, 0x02));
+      final plaintext = asciiBytes('a message spanning two and a bit blocks');
+      final aad = asciiBytes('header');
+      final out = Uint8List(7 + plaintext.length + 16 + 3);
+      final written = aes.sealInto(nonce, plaintext, aad, out, 7);
+      expect(written, equals(plaintext.length + 16));
+      expect(out.sublist(7, 7 + written), equals(aes.seal(nonce, plaintext, aad)));
+      expect(out.sublist(0, 7), equals(Uint8List(7)));
+    });
+
+    test('sealInto and openInPlace work in place', () {
+      final aes = dart_aesgcm.newAESGCM(Uint8List.fromList(List<int>.filled(16, 0x01)));
+      final nonce = Uint8List.fromList(List<int>.filled(12, 0x02));
+      final plaintext = asciiBytes('text to encrypt, in place.');
+      final record = Uint8List(5 + plaintext.length + 16)..setRange(5, 5 + plaintext.length, plaintext);
+      aes.sealInto(nonce, Uint8List.sublistView(record, 5, 5 + plaintext.length), Uint8List(0), record, 5);
+      expect(record.sublist(5), equals(aes.seal(nonce, plaintext, Uint8List(0))));
+
+      final body = Uint8List.sublistView(record, 5);
+      final opened = aes.openInPlace(nonce, body, Uint8List(0));
+      expect(opened, equals(plaintext));
+      expect(opened!.buffer, same(record.buffer));
+    });
+
+    test('openInPlace leaves buffer untouched on bad tag', () {
+      final aes = dart_aesgcm.newAESGCM(Uint8List(16));
+      final sealed = aes.seal(Uint8List(12), asciiBytes('text to encrypt.'), Uint8List(0));
+      sealed[sealed.length - 1] ^= 1;
+      final copy = Uint8List.fromList(sealed);
+      expect(aes.openInPlace(Uint8List(12), sealed, Uint8List(0)), isNull);
+      expect(sealed, equals(copy));
+    });
   });
 }
 
@@ -0,0 +1,80 @@
+import 'dart:async';
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/constants.dart';
+import 'package:tlslite/src/recordlayer.dart';
+import 'package:tlslite/src/tls_protocol.dart';
+import 'package:tlslite/src/utils/binary_io.dart';
+
+void main() {
+  group('SocketBinaryInput', () {
+    test('views returned by readBytes survive later reads', () async {
+      final controller = StreamController<List<int>>();
+      final input = SocketBinaryInput(controller.stream, initialCapacity: 8);
+
+      controller.add([1, 2, 3, 4]);
+      await input.ensureBytes(4);
+      final first = input.readBytes(4);
+
+      // Fully consumed buffer must not be rewound and overwritten.
+      controller.add([9, 9, 9, 9, 9, 9]);
+      await input.ensureBytes(6);
+      final second = input.readBytes(6);
+
+      expect(first, equals([1, 2, 3, 4]));
+      expect(second, equals([9, 9, 9, 9, 9, 9]));
+      await controller.close();
+    });
+
+    test('integer reads across chunk boundaries', () async {
+      final controller = StreamController<List<int>>();
+      final input = SocketBinaryInput(controller.stream, initialCapacity: 2);
+
+      controller.add([0x12]);
+      controller.add([0x34, 0x56, 0x78]);
+      await input.ensureBytes(4);
+      expect(input.readInt32(), equals(0x12345678));
+      await controller.close();
+    });
+  });
+
+  group('RecordSocket.recv', () {
+    test('parses SSLv3 header and returns the payload without copying',
+        () async {
+      final record = Uint8List.fromList([
+        ContentType.application_data, 3, 3, 0x00, 0x03, //
+        0xAA, 0xBB, 0xCC,
+      ]);
+      final socket = RecordSocket.fromTransport(
+        input: MemoryBinaryInput(record),
+        output: MemoryBinaryOutput(),
+      );
+
+      final (header, data) = await socket.recv();
+      expect(header, isA<RecordHeader3>());
+      expect(header.type, equals(ContentType.application_data));
+      expect(header.version, equals(const TlsProtocolVersion(3, 3)));
+      expect(header.length, equals(3));
+      expect(data, equals([0xAA, 0xBB, 0xCC]));
+      expect(identical(data.buffer, record.buffer), isTrue);
+    });
+
+    test('parses SSLv2 header with padding', () async {
+      final record = Uint8List.fromList([
+        0x00, 0x08, 0x02, //
+        1, 2, 3, 4, 5, 6, 7, 8,
+      ]);
+      final socket = RecordSocket.fromTransport(
+        input: MemoryBinaryInput(record),
+        output: MemoryBinaryOutput(),
+      );
+
+      final (header, data) = await socket.recv();
+      expect(header, isA<RecordHeader2>());
+      expect(header.length, equals(8));
+      expect(header.padding, equals(2));
+      expect(data, hasLength(8));
+    });
+  });
+}
@@ -0,0 +1,105 @@
+// dart format width=5000
+// Testes para o kernel ChaCha20-Poly1305 nativo (SSSE3/AVX2)
+
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/experimental/chacha20_poly1305_asm_x86_64.dart';
+import 'package:tlslite/src/utils/chacha.dart';
+import 'package:tlslite/src/utils/chacha20_poly1305.dart';
+import 'package:tlslite/src/utils/cipherfactory.dart' as cipherfactory;
+
+Uint8List _bytes(int length, int seed) => Uint8List.fromList(List.generate(length, (i) => (i * 31 + seed) & 0xFF));
+
+void main() {
+  // Tamanhos que cobrem cauda parcial, passada exata de 4 e de 8 blocos e
+  // registros TLS completos
+  const sizes = [0, 1, 15, 16, 63, 64, 65, 255, 256, 257, 511, 512, 513, 1000, 16384, 16401];
+
+  group('ChaCha20Poly1305AsmSupport', () {
+    test('detecta suporte', () {
+      final supported = ChaCha20Poly1305AsmSupport.isSupported;
+      print('SSSE3: $supported, AVX2: ${ChaCha20Poly1305AsmSupport.isAvx2Supported}');
+      expect(supported, isA<bool>());
+    });
+  });
+
+  group('Chacha20Poly1305Asm', () {
+    test('coincide com a versão Dart nos caminhos SSSE3 e AVX2', () {
+      if (!Chacha20Poly1305Asm.isSupported) {
+        print('Pulando teste - hardware não suportado');
+        return;
+      }
+      final paths = [false, if (ChaCha20Poly1305AsmSupport.isAvx2Supported) true];
+      final key = _bytes(32, 7);
+      final nonce = _bytes(12, 3);
+      final reference = Chacha20Poly1305(key, 'dart');
+      for (final avx2 in paths) {
+        final aead = Chacha20Poly1305Asm(key, useAvx2: avx2);
+        try {
+          for (final size in sizes) {
+            final plaintext = _bytes(size, size);
+            final aad = _bytes(size % 29, 11);
+            final expected = reference.seal(nonce, plaintext, aad);
+            final sealed = aead.seal(nonce, plaintext, aad);
+            expect(sealed, equals(expected), reason: 'seal avx2=$avx2 size=$size');
+            expect(aead.open(nonce, sealed, aad), equals(plaintext), reason: 'open avx2=$avx2 size=$size');
+          }
+        } finally {
+          aead.dispose();
+        }
+      }
+    });
+
+    test('seal confere com o vetor da RFC 8439', () {
+      if (!Chacha20Poly1305Asm.isSupported) {
+        print('Pulando teste - hardware não suportado');
+        return;
+      }
+      final key = Uint8List.fromList(List.generate(32, (i) => 0x80 + i));
+      final nonce = Uint8List.fromList([0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47]);
+      final aad = Uint8List.fromList([0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7]);
+      final plaintext = Uint8List.fromList("Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be it.".codeUnits);
+      final aead = Chacha20Poly1305Asm(key);
+      final sealed = aead.seal(nonce, plaintext, aad);
+      aead.dispose();
+      expect(sealed.sublist(plaintext.length), equals([0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09, 0xe2, 0x6a, 0x7e, 0x90, 0x2e, 0xcb, 0xd0, 0x60, 0x06, 0x91]));
+    });
+
+    test('openInPlace devolve null e preserva o buffer com tag inválida', () {
+      if (!Chacha20Poly1305Asm.isSupported) {
+        print('Pulando teste - hardware não suportado');
+        return;
+      }
+      final aead = Chacha20Poly1305Asm(_bytes(32, 1));
+      final nonce = _bytes(12, 2);
+      final aad = _bytes(13, 4);
+      final sealed = aead.seal(nonce, _bytes(700, 5), aad);
+      sealed[sealed.length - 1] ^= 1;
+      final copy = Uint8List.fromList(sealed);
+      expect(aead.openInPlace(nonce, sealed, aad), isNull);
+      expect(sealed, equals(copy));
+      aead.dispose();
+    });
+
+    test('xorKeyStream coincide com ChaCha', () {
+      if (!Chacha20Poly1305Asm.isSupported) {
+        print('Pulando teste - hardware não suportado');
+        return;
+      }
+      final key = _bytes(32, 9);
+      final nonce = _bytes(12, 8);
+      final kernel = ChaCha20Poly1305Kernel(key);
+      final data = _bytes(1234, 6);
+      final out = Uint8List(data.length);
+      kernel.xorKeyStream(nonce, 5, data, out, 0);
+      kernel.dispose();
+      expect(out, equals(ChaCha(key, nonce, initialCounter: 5).encrypt(data)));
+    });
+
+    test('cipherfactory seleciona asm-x86_64 quando disponível', () {
+      final aead = cipherfactory.createCHACHA20(Uint8List(32), implementations: ['asm-x86_64', 'dart']);
+      expect(aead.implementation, Chacha20Poly1305Asm.isSupported ? 'asm-x86_64' : 'dart');
+    });
+  });
+}
@@ -107,6 +107,30 @@ void main() {
       final aead = Chacha20Poly1305(Uint8List(32), 'dart');
       expect(aead.open(Uint8List(12), Uint8List(32), Uint8List(0)), isNull);
     });
+
+    test('sealInto and openInPlace match seal and open', () {
+      final aead = Chacha20Poly1305(Uint8List.fromList(List<int>.filled(32, 7)), 'dart');
+      final nonce = Uint8List.fromList(List<int>.filled(12, 3));
+      final plaintext = asciiBytes('sixty-five bytes of plaintext to cross a chacha block boundary!!');
+      final aad = asciiBytes('aad');
+      final out = Uint8List(4 + plaintext.length + 16);
+      final written = aead.sealInto(nonce, plaintext, aad, out, 4);
+      expect(written, equals(plaintext.length + 16));
+      expect(out.sublist(4), equals(aead.seal(nonce, plaintext, aad)));
+
+      final opened = aead.openInPlace(nonce, Uint8List.sublistView(out, 4), aad);
+      expect(opened, equals(plaintext));
+      expect(out.sublist(4, 4 + plaintext.length), equals(plaintext));
+    });
+
+    test('openInPlace leaves buffer untouched on bad tag', () {
+      final aead = Chacha20Poly1305(Uint8List(32), 'dart');
+      final sealed = aead.seal(Uint8List(12), asciiBytes('payload'), Uint8List(0));
+      sealed[0] ^= 1;
+      final copy = Uint8List.fromList(sealed);
+      expect(aead.openInPlace(Uint8List(12), sealed, Uint8List(0)), isNull);
+      expect(sealed, equals(copy));
+    });
   });
 }
 
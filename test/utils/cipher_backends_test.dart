@@ -0,0 +1,97 @@
+// dart format width=5000
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/utils/cipher_backends.dart';
+import 'package:tlslite/src/utils/cipherfactory.dart' as cipherfactory;
+
+Uint8List _bytes(int length, int seed) =>
+    Uint8List.fromList(List.generate(length, (i) => (i * 31 + seed) & 0xff));
+
+void main() {
+  const none = CpuFeatures();
+  const gcmCpu = CpuFeatures(aesNi: true, pclmulqdq: true, sse2: true);
+  const legacyCpu = CpuFeatures(pclmulqdq: true, sse2: true, ssse3: true);
+
+  group('CipherBackends', () {
+    test('dart is always available', () {
+      for (final primitive in CipherPrimitive.values) {
+        expect(CipherBackends.isAvailable('dart', primitive, none), isTrue);
+      }
+    });
+
+    test('asm-x86_64 follows the CPU features', () {
+      expect(CipherBackends.isAvailable('asm-x86_64', CipherPrimitive.aesGcm, none), isFalse);
+      expect(CipherBackends.isAvailable('asm-x86_64', CipherPrimitive.aesGcm, gcmCpu), isTrue);
+      expect(CipherBackends.isAvailable('asm-x86_64', CipherPrimitive.aesGcm, legacyCpu), isFalse);
+      expect(CipherBackends.isAvailable('asm-x86_64', CipherPrimitive.aesCbc, gcmCpu), isTrue);
+      expect(CipherBackends.isAvailable('asm-x86_64', CipherPrimitive.chacha20Poly1305, gcmCpu), isFalse);
+      expect(CipherBackends.isAvailable('asm-x86_64', CipherPrimitive.chacha20Poly1305, legacyCpu), isTrue);
+    });
+
+    test('select returns the first usable entry', () {
+      expect(CipherBackends.select(CipherPrimitive.aesGcm, CipherBackends.all, gcmCpu), 'asm-x86_64');
+      expect(CipherBackends.select(CipherPrimitive.aesGcm, CipherBackends.all, legacyCpu), 'dart');
+      expect(CipherBackends.select(CipherPrimitive.aesGcm, ['openssl', 'dart'], gcmCpu), 'dart');
+      expect(CipherBackends.select(CipherPrimitive.aesGcm, ['asm-x86_64'], none), isNull);
+    });
+
+    test('selected covers every primitive', () {
+      print('CPU: ${CpuFeatures.current}');
+      final selected = CipherBackends.selected;
+      expect(selected.keys, unorderedEquals(CipherPrimitive.values));
+      expect(selected.values, everyElement(isIn(CipherBackends.all)));
+    });
+  });
+
+  group('cipherfactory dispatch', () {
+    test('AES-GCM backends agree', () {
+      final backend = CipherBackends.select(CipherPrimitive.aesGcm, CipherBackends.all);
+      for (final keyLength in [16, 32]) {
+        final key = _bytes(keyLength, 1);
+        final nonce = _bytes(12, 2);
+        final aad = _bytes(13, 3);
+        final fast = cipherfactory.createAESGCM(key, implementations: CipherBackends.all);
+        final slow = cipherfactory.createAESGCM(key);
+        expect(fast.implementation, backend);
+        expect(slow.implementation, 'dart');
+        for (final length in [0, 1, 16, 65, 1000]) {
+          final plaintext = _bytes(length, 4);
+          final sealed = fast.seal(nonce, plaintext, aad);
+          expect(sealed, slow.seal(nonce, plaintext, aad));
+          expect(slow.open(nonce, sealed, aad), plaintext);
+        }
+      }
+    });
+
+    test('AES-CBC backends agree and keep the IV chain', () {
+      final backend = CipherBackends.select(CipherPrimitive.aesCbc, CipherBackends.all);
+      for (final keyLength in [16, 32]) {
+        final key = _bytes(keyLength, 5);
+        final iv = _bytes(16, 6);
+        final plaintext = _bytes(80, 7);
+        final fast = cipherfactory.createAES(key, iv, implementations: CipherBackends.all);
+        final slow = cipherfactory.createAES(key, iv);
+        expect(fast.implementation, backend);
+        final first = fast.encrypt(plaintext);
+        expect(first, slow.encrypt(plaintext));
+        // Second call continues from the last ciphertext block.
+        expect(fast.encrypt(plaintext), slow.encrypt(plaintext));
+
+        final decryptor = cipherfactory.createAES(key, iv, implementations: CipherBackends.all);
+        expect(decryptor.decrypt(first), plaintext);
+      }
+    });
+
+    test('ChaCha20-Poly1305 reports the selected backend', () {
+      final backend = CipherBackends.select(CipherPrimitive.chacha20Poly1305, CipherBackends.all);
+      final cipher = cipherfactory.createCHACHA20(_bytes(32, 8), implementations: CipherBackends.all);
+      expect(cipher.implementation, backend);
+    });
+
+    test('dart-only lists never pick a native backend', () {
+      final cipher = cipherfactory.createAESGCM(_bytes(16, 9), implementations: ['dart']);
+      expect(cipher.implementation, 'dart');
+    });
+  });
+}
@@ -47,6 +47,47 @@ void main() {
     expect(parsed.hasPrivateKey(), isFalse);
   });
 
+  group('Ed25519 batch verification', () {
+    late List<(DartEdDSAKey, Uint8List, Uint8List)> batch;
+
+    setUp(() {
+      batch = [
+        for (var i = 0; i < 5; i++)
+          () {
+            final key = DartEdDSAKey.ed25519(
+              privateKey: Uint8List.fromList(
+                  List<int>.generate(32, (index) => index * 7 + i)),
+            );
+            final message = Uint8List.fromList(List<int>.filled(i * 13, i));
+            return (
+              DartEdDSAKey.ed25519(publicKey: key.publicKeyBytes),
+              message,
+              key.hashAndSign(message),
+            );
+          }(),
+      ];
+    });
+
+    test('accepts a batch of valid signatures', () {
+      expect(DartEdDSAKey.verifyBatch(batch), isTrue);
+      expect(DartEdDSAKey.verifyBatch(batch.sublist(0, 1)), isTrue);
+      expect(DartEdDSAKey.verifyBatch([]), isTrue);
+    });
+
+    test('rejects a batch with one bad signature', () {
+      final (key, message, signature) = batch[3];
+      final tampered = Uint8List.fromList(signature)..[5] ^= 1;
+      batch[3] = (key, message, tampered);
+      expect(DartEdDSAKey.verifyBatch(batch), isFalse);
+
+      batch[3] = (key, Uint8List.fromList([...message, 0]), signature);
+      expect(DartEdDSAKey.verifyBatch(batch), isFalse);
+
+      batch[3] = (batch[2].$1, message, signature);
+      expect(DartEdDSAKey.verifyBatch(batch), isFalse);
+    });
+  });
+
   group('Ed448 keys', () {
     late Uint8List ed448Seed;
     late Uint8List ed448Public;
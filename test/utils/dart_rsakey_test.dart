@@ -62,6 +62,16 @@ void main() {
     );
   });
 
+  test('CRT signing matches the plain exponent across blinding updates', () {
+    final plain = DartRSAKey(n: key.n, e: key.e, d: key.privateExponent);
+    final expected = _hexBytes(_pkcs1Sha1Hex);
+    for (final signer in [key, key, key, plain]) {
+      final signature =
+          signer.hashAndSign(_pythonMessage(), rsaScheme: 'PKCS1', hAlg: 'sha1');
+      expect(signature, expected);
+    }
+  });
+
   test('encrypt/decrypt roundtrip', () {
     final plaintext = Uint8List.fromList('tlslite dart'.codeUnits);
     final ciphertext = key.encrypt(plaintext);
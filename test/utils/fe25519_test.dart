@@ -0,0 +1,77 @@
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+
+import 'package:tlslite/src/utils/fe25519.dart';
+
+Int32List _fe(List<int> bytes) {
+  final h = feNew();
+  feFromBytes(h, Uint8List.fromList(bytes));
+  return h;
+}
+
+Uint8List _bytes(Int32List f) {
+  final s = Uint8List(32);
+  feToBytes(s, f);
+  return s;
+}
+
+void main() {
+  // p = 2^255 - 19, little-endian
+  final p = Uint8List(32)
+    ..fillRange(0, 32, 0xff)
+    ..[0] = 0xed
+    ..[31] = 0x7f;
+
+  group('fe25519', () {
+    test('round-trips canonical values', () {
+      final s = Uint8List.fromList(List.generate(32, (i) => i * 13 + 5))
+        ..[31] &= 0x3f;
+      expect(_bytes(_fe(s)), equals(s));
+    });
+
+    test('reduces p and p + 1 to canonical form', () {
+      expect(_bytes(_fe(p)), equals(Uint8List(32)));
+      final p1 = Uint8List.fromList(p)..[0] += 1;
+      expect(_bytes(_fe(p1)), equals(Uint8List(32)..[0] = 1));
+      expect(feIsZero(_fe(p)), 1);
+    });
+
+    test('mul and square agree', () {
+      final f = _fe(List.generate(32, (i) => 255 - i * 3));
+      final sq = feNew();
+      final mul = feNew();
+      feSquare(sq, f);
+      feMul(mul, f, f);
+      expect(_bytes(sq), equals(_bytes(mul)));
+    });
+
+    test('invert gives the multiplicative inverse', () {
+      final z = _fe(List.generate(32, (i) => i * 29 + 7));
+      final inv = feNew();
+      final one = feNew();
+      feInvert(inv, z);
+      feMul(one, z, inv);
+      expect(_bytes(one), equals(Uint8List(32)..[0] = 1));
+    });
+
+    test('sub below zero wraps modulo p', () {
+      final zero = feNew();
+      final one = feNew()..[0] = 1;
+      final r = feNew();
+      feSub(r, zero, one);
+      final pMinus1 = Uint8List.fromList(p)..[0] -= 1;
+      expect(_bytes(r), equals(pMinus1));
+    });
+
+    test('cswap swaps only when asked', () {
+      final a = _fe([1, ...List.filled(31, 0)]);
+      final b = _fe([2, ...List.filled(31, 0)]);
+      feCSwap(a, b, 0);
+      expect(a[0], 1);
+      feCSwap(a, b, 1);
+      expect(a[0], 2);
+      expect(b[0], 1);
+    });
+  });
+}
@@ -0,0 +1,54 @@
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/utils/ghash.dart';
+
+Uint8List _hex(String hex) => Uint8List.fromList([
+      for (var i = 0; i < hex.length; i += 2)
+        int.parse(hex.substring(i, i + 2), radix: 16)
+    ]);
+
+void main() {
+  // GHASH values from McGrew & Viega, "The Galois/Counter Mode of
+  // Operation", test cases 2-4.
+  group('Ghash', () {
+    test('test case 2', () {
+      final ghash = Ghash(_hex('66e94bd4ef8a2c3b884cfa59ca342b2e'));
+      ghash.update(_hex('0388dace60b6a392f328c2b971b2fe78'));
+      expect(ghash.finalize(0, 16), _hex('f38cbb1ad69223dcc3457ae5b6b0f885'));
+    });
+
+    final h = _hex('b83b533708bf535d0aa6e52980d53b78');
+    final ciphertext = _hex('42831ec2217774244b7221b784d0d49c'
+        'e3aa212f2c02a4e035c17e2329aca12e'
+        '21d514b25466931c7d8f6a5aac84aa05'
+        '1ba30b396a0aac973d58e091473f5985');
+
+    test('test case 3', () {
+      final ghash = Ghash(h);
+      ghash.update(ciphertext);
+      expect(ghash.finalize(0, 64), _hex('7f1b32b81b820d02614f8895ac1d4eac'));
+    });
+
+    test('test case 4 pads AAD and ciphertext separately', () {
+      final aad = _hex('feedfacedeadbeeffeedfacedeadbeefabaddad2');
+      final ghash = Ghash(h);
+      ghash.update(aad);
+      ghash.update(Uint8List.sublistView(ciphertext, 0, 60));
+      expect(ghash.finalize(20, 60), _hex('698e57f70e6ecc7fd9463b7260a9ae5f'));
+    });
+
+    test('reset keeps the key', () {
+      final ghash = Ghash(h);
+      ghash.update(_hex('00112233445566778899aabbccddeeff'));
+      ghash.finalize(0, 16);
+      ghash.reset();
+      ghash.update(ciphertext);
+      expect(ghash.finalize(0, 64), _hex('7f1b32b81b820d02614f8895ac1d4eac'));
+    });
+
+    test('rejects keys that are not 16 bytes', () {
+      expect(() => Ghash(Uint8List(8)), throwsArgumentError);
+    });
+  });
+}
@@ -0,0 +1,50 @@
+// dart format width=5000
+// Testes para o modPow nativo MULX/ADX (2048 a 4096 bits)
+
+import 'dart:typed_data';
+
+import 'package:test/test.dart';
+import 'package:tlslite/src/experimental/montgomery_asm_x86_64.dart';
+
+/// Bytes pseudo-aleatórios determinísticos (big-endian)
+Uint8List _bytes(int length, int seed) {
+  var state = seed;
+  return Uint8List.fromList(List.generate(length, (_) {
+    state = (state * 1103515245 + 12345) & 0x7fffffff;
+    return state >> 16 & 0xff;
+  }));
+}
+
+BigInt _toBigInt(Uint8List bytes) => bytes.fold(BigInt.zero, (acc, b) => (acc << 8) | BigInt.from(b));
+
+void main() {
+  group('MontgomeryAsmContext MULX', () {
+    for (final bits in const [640, 2048, 3072, 4096]) {
+      test('modPow coincide com BigInt.modPow em $bits bits', () {
+        if (!MontgomeryAsmSupport.isX64Supported || !MontgomeryAsmSupport.isModernSupported) {
+          print('Pulando teste - hardware não suportado');
+          return;
+        }
+        final modBytes = _bytes(bits ~/ 8, bits)
+          ..[0] |= 0x80
+          ..[bits ~/ 8 - 1] |= 1;
+        final modulus = _toBigInt(modBytes);
+        final ctx = MontgomeryAsmContext.fromModulus(modBytes);
+        addTearDown(ctx.dispose);
+        expect(ctx.usesMulxKernel, isTrue);
+
+        final cases = <(Uint8List, Uint8List)>[
+          (_bytes(bits ~/ 8 - 1, 1), Uint8List.fromList([0x01, 0x00, 0x01])),
+          (_bytes(bits ~/ 8, 2), _bytes(bits ~/ 8, 3)),
+          // Base maior que o módulo e expoente com zeros à esquerda
+          (_bytes(bits ~/ 8 + 5, 4), Uint8List.fromList([0, 0, 0, 0, 0, 0, 0, 0, 0, 7])),
+          (Uint8List.fromList([2]), Uint8List.fromList([0])),
+        ];
+        for (final (base, exp) in cases) {
+          final expected = _toBigInt(base).modPow(_toBigInt(exp), modulus);
+          expect(_toBigInt(ctx.modPow(base, exp)), expected);
+        }
+      });
+    }
+  });
+}
@@ -0,0 +1,61 @@
+import 'package:test/test.dart';
+import 'package:tlslite/src/utils/montgomery.dart';
+
+/// Deterministic pseudo-random BigInt of [bits] bits (top bit set).
+BigInt _number(int bits, int seed) {
+  var state = seed;
+  var result = BigInt.one;
+  for (var i = 1; i < bits; i++) {
+    state = (state * 1103515245 + 12345) & 0x7fffffff;
+    result = (result << 1) | BigInt.from((state >> 16) & 1);
+  }
+  return result;
+}
+
+void main() {
+  group('MontgomeryContext', () {
+    test('rejects even moduli', () {
+      expect(() => MontgomeryContext(BigInt.from(10)), throwsArgumentError);
+      expect(() => MontgomeryContext(BigInt.one), throwsArgumentError);
+    });
+
+    test('round-trips through the Montgomery form', () {
+      final modulus = _number(521, 7) | BigInt.one;
+      final ctx = MontgomeryContext(modulus);
+      final x = _number(600, 8);
+      expect(ctx.fromMontgomery(ctx.toMontgomery(x)), x % modulus);
+      expect(ctx.toBigInt(ctx.fromBigInt(x)), x % modulus);
+    });
+
+    test('mul matches BigInt with aliased operands', () {
+      // All-ones limbs stress the carry chain.
+      final modulus = (BigInt.one << 1020) - BigInt.one;
+      final ctx = MontgomeryContext(modulus);
+      final a = ctx.toMontgomery(modulus - BigInt.two);
+      final b = ctx.toMontgomery(_number(1000, 3));
+      ctx.mul(a, a, b);
+      expect(ctx.fromMontgomery(a),
+          ((modulus - BigInt.two) * _number(1000, 3)) % modulus);
+      ctx.mul(a, a, a);
+      expect(ctx.fromMontgomery(a),
+          ((modulus - BigInt.two) * _number(1000, 3)).pow(2) % modulus);
+    });
+
+    for (final bits in const [3, 61, 256, 1024, 2048]) {
+      test('modPow matches BigInt.modPow for $bits-bit moduli', () {
+        final modulus =
+            bits == 3 ? BigInt.from(7) : _number(bits, bits) | BigInt.one;
+        final ctx = MontgomeryContext(modulus);
+        for (final exponentBits in [0, 1, 17, bits]) {
+          final base = _number(bits + 3, exponentBits + 1);
+          final exponent = exponentBits == 0
+              ? BigInt.zero
+              : _number(exponentBits, bits + exponentBits);
+          expect(ctx.modPow(base, exponent, exponentBits: bits),
+              base.modPow(exponent, modulus));
+          expect(ctx.modPow(base, exponent), base.modPow(exponent, modulus));
+        }
+      });
+    }
+  });
+}
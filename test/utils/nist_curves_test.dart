@@ -0,0 +1,107 @@
+import 'dart:typed_data';
+
+import 'package:pointycastle/api.dart' as pc show PrivateKeyParameter;
+import 'package:pointycastle/digests/sha384.dart';
+import 'package:pointycastle/ecc/api.dart' as ecc;
+import 'package:pointycastle/macs/hmac.dart';
+import 'package:pointycastle/signers/ecdsa_signer.dart';
+import 'package:test/test.dart';
+import 'package:tlslite/src/constants.dart';
+import 'package:tlslite/src/errors.dart';
+import 'package:tlslite/src/keyexchange.dart';
+import 'package:tlslite/src/utils/cryptomath.dart';
+import 'package:tlslite/src/utils/ecc.dart';
+import 'package:tlslite/src/utils/nist_curves.dart';
+
+BigInt _hex(String hex) => BigInt.parse(hex, radix: 16);
+
+void main() {
+  group('NistCurve', () {
+    test('RFC 6979 A.2.5: P-256, SHA-256, "sample"', () {
+      final curve = NistCurve.p256;
+      final d = _hex(
+          'c9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721');
+      final (qx, qy) = curve.mulBase(d);
+      expect(qx,
+          _hex('60fed4ba255a9d31c961eb74c6356d68c049b8923b61fa6ce669622e60f29fb6'));
+      expect(qy,
+          _hex('7903fe1008b8bc99a41ae9e95628bc64f2f1b20c2d7e9f5177a3c294d4462299'));
+
+      final hash = secureHash(Uint8List.fromList('sample'.codeUnits), 'sha256');
+      final (r, s) = curve.sign(d, hash, 'sha256');
+      expect(r,
+          _hex('efd48b2aacb6a8fd1140dd9cd45e81d69d2c877b56aaf991c34d0ea84eaf3716'));
+      expect(s,
+          _hex('f7cb1c942d657c41d436c7a1b6e29f65f3e900dbb9aff4064dc4ab2f843acda8'));
+      expect(curve.verify(qx, qy, hash, r, s), isTrue);
+      expect(curve.verify(qx, qy, hash, r, s + BigInt.one), isFalse);
+      expect(curve.verify(qx, qy, hash, BigInt.zero, s), isFalse);
+    });
+
+    for (final curve in [NistCurve.p256, NistCurve.p384]) {
+      final domain = getCurveByName(curve.name);
+
+      test('${curve.name} base and variable-base multiplication', () {
+        for (final k in [
+          BigInt.one,
+          BigInt.from(16),
+          curve.n - BigInt.one,
+          bytesToNumber(getRandomBytes(curve.scalarLength)) % curve.n,
+        ]) {
+          final expected = (domain.G * k)!;
+          final (x, y) = curve.mulBase(k);
+          expect(x, expected.x!.toBigInteger());
+          expect(y, expected.y!.toBigInteger());
+
+          final peer = (domain.G * BigInt.from(0x1234567))!;
+          final shared = curve.sharedSecret(
+              k, peer.x!.toBigInteger()!, peer.y!.toBigInteger()!);
+          expect(bytesToNumber(shared), (peer * k)!.x!.toBigInteger());
+        }
+      });
+
+      test('${curve.name} signatures match pointycastle', () {
+        final d = bytesToNumber(getRandomBytes(curve.scalarLength)) % curve.n;
+        final hash = Uint8List.fromList(
+            secureHash(Uint8List.fromList([1, 2, 3]), 'sha384'));
+        final signer = ECDSASigner(null, HMac(SHA384Digest(), 128))
+          ..init(true, pc.PrivateKeyParameter(ecc.ECPrivateKey(d, domain)));
+        final expected = signer.generateSignature(hash) as ecc.ECSignature;
+        final (r, s) = curve.sign(d, hash, 'sha384');
+        expect(r, expected.r);
+        expect(s, expected.s);
+        final (qx, qy) = curve.mulBase(d);
+        expect(curve.verify(qx, qy, hash, r, s), isTrue);
+        hash[0] ^= 1;
+        expect(curve.verify(qx, qy, hash, r, s), isFalse);
+      });
+
+      test('${curve.name} rejects points off the curve', () {
+        final (x, y) = curve.mulBase(BigInt.from(7));
+        final encoded = curve.encodePoint(x, y);
+        expect(curve.decodePoint(encoded), (x, y));
+        encoded[encoded.length - 1] ^= 1;
+        expect(() => curve.decodePoint(encoded), throwsArgumentError);
+        expect(() => curve.decodePoint(Uint8List.sublistView(encoded, 1)),
+            throwsArgumentError);
+      });
+    }
+  });
+
+  group('ECDHKeyExchange on NistCurve', () {
+    for (final group in [GroupName.secp256r1, GroupName.secp384r1]) {
+      test('${GroupName.toStr(group)} key agreement', () {
+        final kex = ECDHKeyExchange(group, (3, 4));
+        final a = kex.getRandomPrivateKey();
+        final b = kex.getRandomPrivateKey();
+        final shareA = kex.calcPublicValue(a);
+        final shareB = kex.calcPublicValue(b);
+        expect(kex.calcSharedKey(a, shareB), kex.calcSharedKey(b, shareA));
+
+        shareB[shareB.length - 1] ^= 1;
+        expect(() => kex.calcSharedKey(a, shareB),
+            throwsA(isA<TLSIllegalParameterException>()));
+      });
+    }
+  });
+}
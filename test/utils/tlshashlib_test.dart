@@ -32,6 +32,26 @@ void main() {
       expect(clone.digest(), equals(originalBytes));
     });
 
+    test('copy forks running state for every algorithm', () {
+      final prefix = List<int>.generate(200, (i) => i & 0xff);
+      for (final name in ['md5', 'sha1', 'sha224', 'sha256', 'sha384',
+          'sha512']) {
+        final hash = newHash(name, prefix);
+        final fork = hash.copy()..update([0xAA]);
+        hash.update([0xBB]);
+        expect(fork.digest(), isNot(equals(hash.digest())), reason: name);
+        expect(hash.digest().length, equals(hash.digestSize), reason: name);
+      }
+    });
+
+    test('update honours start and end offsets', () {
+      final data = Uint8List.fromList(List<int>.generate(300, (i) => i & 0xff));
+      final hash = newHash('sha384');
+      hash.update(data, 10, 290);
+      expect(hash.digest(),
+          equals(crypto.sha384.convert(data.sublist(10, 290)).bytes));
+    });
+
     test('throws on unsupported algorithm', () {
       expect(() => newHash('ripemd160'), throwsArgumentError);
     });
@@ -27,6 +27,41 @@ void main() {
       expect(clone.digest(), equals(expectedClone));
     });
 
+    test('hashes keys longer than the block size', () {
+      final key = List<int>.generate(200, (i) => i & 0xff);
+      final data = utf8.encode('payload');
+      for (final (name, hash) in [
+        ('sha1', crypto.sha1),
+        ('sha256', crypto.sha256),
+        ('sha384', crypto.sha384),
+      ]) {
+        final mac = TlsHmac(key, digestmod: name, message: data);
+        expect(mac.digest(), equals(crypto.Hmac(hash, key).convert(data).bytes));
+      }
+    });
+
+    test('macRecord matches the TLS record MAC input', () {
+      final key = List<int>.generate(32, (i) => i * 7 & 0xff);
+      final payload = Uint8List.fromList(List.generate(300, (i) => i & 0xff));
+      final mac = TlsHmac(key, digestmod: 'sha256');
+      // State absorbed through update() must not leak into record MACs.
+      mac.update([1, 2, 3]);
+
+      final out = Uint8List(40);
+      expect(mac.macRecord(0x0102030405060708, 23, [3, 3], payload, out, 8),
+          32);
+      final header = [1, 2, 3, 4, 5, 6, 7, 8, 23, 3, 3, 0x01, 0x2c];
+      final expected =
+          crypto.Hmac(crypto.sha256, key).convert([...header, ...payload]);
+      expect(out.sublist(8), equals(expected.bytes));
+
+      // Without a version (SSLv3 layout) and reusing the same context.
+      mac.macRecord(1, 21, null, Uint8List(0), out);
+      final sslv3 = crypto.Hmac(crypto.sha256, key)
+          .convert([0, 0, 0, 0, 0, 0, 0, 1, 21, 0, 0]);
+      expect(out.sublist(0, 32), equals(sslv3.bytes));
+    });
+
     test('accepts TlsHash instance as digestmod', () {
       final hash = md5();
       final mac = TlsHmac([0x41], digestmod: hash);
@@ -0,0 +1,55 @@
+// dart format width=5000
+// Testes para o X25519 nativo (MULX/ADX)
+
+import 'dart:typed_data';
+
+import 'package:convert/convert.dart';
+import 'package:test/test.dart';
+import 'package:tlslite/src/experimental/x25519_mulx_x86_64.dart';
+import 'package:tlslite/src/utils/x25519.dart';
+
+Uint8List _hex(String value) => Uint8List.fromList(hex.decode(value));
+
+void main() {
+  group('X25519Mulx', () {
+    test('vetores da RFC 7748', () {
+      if (!X25519Mulx.isSupported) {
+        print('Pulando teste - hardware não suportado');
+        return;
+      }
+      final k = _hex('a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4');
+      final u = _hex('e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c');
+      expect(hex.encode(X25519Mulx.scalarMult(k, u)), 'c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552');
+
+      final k2 = _hex('4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d');
+      final u2 = _hex('e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493');
+      expect(hex.encode(X25519Mulx.scalarMult(k2, u2)), '95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957');
+    });
+
+    test('coincide com a versão Dart, inclusive u não canônico e de ordem baixa', () {
+      if (!X25519Mulx.isSupported) {
+        print('Pulando teste - hardware não suportado');
+        return;
+      }
+      final points = <Uint8List>[
+        Uint8List.fromList(X25519_G),
+        Uint8List(32),
+        Uint8List(32)..[0] = 1,
+        Uint8List(32)
+          ..fillRange(0, 32, 0xff)
+          ..[0] = 0xee, // p + 1 com o bit 255 ligado
+        Uint8List.fromList(List.generate(32, (i) => i * 37 + 11)),
+      ];
+      for (int i = 0; i < 20; i++) {
+        final k = Uint8List.fromList(List.generate(32, (j) => (i * 131 + j * 17) & 0xff));
+        for (final u in points) {
+          expect(X25519Mulx.scalarMult(k, u), equals(x25519(k, u)));
+        }
+      }
+    });
+
+    test('rejeita entradas com tamanho errado', () {
+      expect(() => X25519Mulx.scalarMult(Uint8List(31), Uint8List(32)), throwsArgumentError);
+    });
+  });
+}